@@ -1,6 +1,6 @@
 
-#ifndef UNICODE__JAPANESE
-#define UNICODE__JAPANESE
+#ifndef UNICODE__JAPANESE_H__
+#define UNICODE__JAPANESE_H__
 
 /* $Id: Japanese.h,v 1.11 2002/06/30 23:12:58 hio Exp $ */
 
@@ -34,6 +34,13 @@
 typedef unsigned char u_char;
 #endif
 
+/* fixed size integers, as c_lib/xs_compat.h defines them. */
+#ifndef UJ_UINT8
+#define UJ_UINT8  unsigned char
+#define UJ_UINT16 unsigned short
+#define UJ_UINT32 unsigned int
+#endif
+
 /* util */
 #define new_SV_UNDEF() newSVsv(&PL_sv_undef)
 
@@ -53,12 +60,16 @@ EXTERN_C
   SV* xs_jis_sjis(SV* sv_str);
 
   /* sjis(i-mode)<=>utf8 */
-  SV* xs_sjis_imode_utf8(SV* sv_str);
-  SV* xs_utf8_sjis_imode(SV* sv_str);
+  SV* xs_sjis_imode1_utf8(SV* sv_str);
+  SV* xs_sjis_imode2_utf8(SV* sv_str);
+  SV* xs_utf8_sjis_imode1(SV* sv_str);
+  SV* xs_utf8_sjis_imode2(SV* sv_str);
 
   /* sjis(j-sky)<=>utf8 */
-  SV* xs_sjis_jsky_utf8(SV* sv_str);
-  SV* xs_utf8_sjis_jsky(SV* sv_str);
+  SV* xs_sjis_jsky1_utf8(SV* sv_str);
+  SV* xs_sjis_jsky2_utf8(SV* sv_str);
+  SV* xs_utf8_sjis_jsky1(SV* sv_str);
+  SV* xs_utf8_sjis_jsky2(SV* sv_str);
 
   /* sjis(dot-i)<=>utf8 */
   SV* xs_sjis_doti_utf8(SV* sv_str);
@@ -68,8 +79,29 @@ EXTERN_C
   SV* xs_ucs2_utf8(SV* sv_str);
   SV* xs_utf8_ucs2(SV* sv_str);
 
+  /* utf16 <=> utf8 (utf16.c) */
+  SV* xs_utf16_utf8(SV* sv_str);
+  SV* xs_utf8_utf16(SV* sv_str);
+  SV* xs_utf16le_utf8(SV* sv_str);
+  SV* xs_utf8_utf16le(SV* sv_str);
+
+  /* ucs4 <=> utf8 (ucs4.c) */
+  SV* xs_ucs4_utf8(SV* sv_str);
+  SV* xs_utf8_ucs4(SV* sv_str);
+  SV* xs_ucs4le_utf8(SV* sv_str);
+  SV* xs_utf8_ucs4le(SV* sv_str);
+
+  /* utf8 validation (utf8.c) */
+  SV* xs_validate_utf8(SV* sv_str);
+
+  /* in-place shrinking conversions (inplace.c) */
+  void xs_utf8_sjis_inplace(SV* sv_str);
+  void xs_utf8_eucjp_inplace(SV* sv_str);
+  void xs_jis_sjis_inplace(SV* sv_str);
+
   /* ޥåץեϢ */
   void do_memmap();
+  void do_memmap_clone();
   void do_memunmap();
 
   /* SJIS <=> UTF8 Ѵơ֥ */
@@ -96,4 +128,4 @@ EXTERN_C
 }
 
 
-#endif /* UNICODE__JAPANESE */
+#endif /* UNICODE__JAPANESE_H__ */
@@ -86,18 +86,34 @@ OUTPUT:
 #========================#
 
 SV*
-_si2u(this_,str)
+_si2u1(this_,str)
     SV* str;
 CODE:
-    RETVAL = xs_sjis_imode_utf8(str);
+    RETVAL = xs_sjis_imode1_utf8(str);
 OUTPUT:
     RETVAL
 
 SV*
-_u2si(this_,str)
+_si2u2(this_,str)
     SV* str;
 CODE:
-    RETVAL = xs_utf8_sjis_imode(str);
+    RETVAL = xs_sjis_imode2_utf8(str);
+OUTPUT:
+    RETVAL
+
+SV*
+_u2si1(this_,str)
+    SV* str;
+CODE:
+    RETVAL = xs_utf8_sjis_imode1(str);
+OUTPUT:
+    RETVAL
+
+SV*
+_u2si2(this_,str)
+    SV* str;
+CODE:
+    RETVAL = xs_utf8_sjis_imode2(str);
 OUTPUT:
     RETVAL
 
@@ -106,18 +122,34 @@ OUTPUT:
 #========================#
 
 SV*
-_sj2u(this_,str)
+_sj2u1(this_,str)
     SV* str;
 CODE:
-    RETVAL = xs_sjis_jsky_utf8(str);
+    RETVAL = xs_sjis_jsky1_utf8(str);
 OUTPUT:
     RETVAL
 
 SV*
-_u2sj(this_,str)
+_sj2u2(this_,str)
     SV* str;
 CODE:
-    RETVAL = xs_utf8_sjis_jsky(str);
+    RETVAL = xs_sjis_jsky2_utf8(str);
+OUTPUT:
+    RETVAL
+
+SV*
+_u2sj1(this_,str)
+    SV* str;
+CODE:
+    RETVAL = xs_utf8_sjis_jsky1(str);
+OUTPUT:
+    RETVAL
+
+SV*
+_u2sj2(this_,str)
+    SV* str;
+CODE:
+    RETVAL = xs_utf8_sjis_jsky2(str);
 OUTPUT:
     RETVAL
 
@@ -161,6 +193,112 @@ CODE:
 OUTPUT:
     RETVAL
 
+#========================#
+# utf16 <=> utf8         #
+#========================#
+
+SV*
+_utf16_utf8(this_,str)
+    SV* str;
+CODE:
+    RETVAL = xs_utf16_utf8(str);
+OUTPUT:
+    RETVAL
+
+SV*
+_utf8_utf16(this_,str)
+    SV* str;
+CODE:
+    RETVAL = xs_utf8_utf16(str);
+OUTPUT:
+    RETVAL
+
+SV*
+_utf16le_utf8(this_,str)
+    SV* str;
+CODE:
+    RETVAL = xs_utf16le_utf8(str);
+OUTPUT:
+    RETVAL
+
+SV*
+_utf8_utf16le(this_,str)
+    SV* str;
+CODE:
+    RETVAL = xs_utf8_utf16le(str);
+OUTPUT:
+    RETVAL
+
+#========================#
+# ucs4 <=> utf8          #
+#========================#
+
+SV*
+_ucs4_utf8(this_,str)
+    SV* str;
+CODE:
+    RETVAL = xs_ucs4_utf8(str);
+OUTPUT:
+    RETVAL
+
+SV*
+_utf8_ucs4(this_,str)
+    SV* str;
+CODE:
+    RETVAL = xs_utf8_ucs4(str);
+OUTPUT:
+    RETVAL
+
+SV*
+_ucs4le_utf8(this_,str)
+    SV* str;
+CODE:
+    RETVAL = xs_ucs4le_utf8(str);
+OUTPUT:
+    RETVAL
+
+SV*
+_utf8_ucs4le(this_,str)
+    SV* str;
+CODE:
+    RETVAL = xs_utf8_ucs4le(str);
+OUTPUT:
+    RETVAL
+
+#========================#
+# utf8 validation        #
+#========================#
+
+SV*
+_validate_utf8(this_,str)
+    SV* str;
+CODE:
+    RETVAL = xs_validate_utf8(str);
+OUTPUT:
+    RETVAL
+
+#=======================#
+# in-place conversion   #
+#=======================#
+
+void
+_u2s_inplace(this_,str)
+    SV* str;
+CODE:
+    xs_utf8_sjis_inplace(str);
+
+void
+_u2e_inplace(this_,str)
+    SV* str;
+CODE:
+    xs_utf8_eucjp_inplace(str);
+
+void
+_j2s_inplace(this_,str)
+    SV* str;
+CODE:
+    xs_jis_sjis_inplace(str);
+
 #=======================#
 # memory mapped file    #
 #=======================#
@@ -170,3 +308,8 @@ do_memmap()
 
 void
 do_memunmap()
+
+void
+CLONE(...)
+CODE:
+    do_memmap_clone();
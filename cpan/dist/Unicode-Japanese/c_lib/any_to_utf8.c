@@ -20,7 +20,7 @@ uj_conv_t* _uj_any_to_utf8(const uj_conv_t* in, uj_conv_t* out, uj_charcode_t ic
 {
   if( icode==ujc_auto )
   {
-    icode = uj_getcode(in->buf, in->buf_len);
+    return _uj_auto_to_utf8(in, out);
   }
   switch( icode )
   {
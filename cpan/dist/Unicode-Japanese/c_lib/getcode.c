@@ -33,6 +33,31 @@
 #define NO_XSUBS
 #include "../getcode.c"
 
+/* code of a state machine. */
+static uj_charcode_t _uj_getcode_code(charcode_t code)
+{
+  switch(code)
+  {
+  case cc_unknown:    return ujc_undefined;
+  case cc_ascii:      return ujc_ascii;
+  case cc_sjis:       return ujc_sjis;
+  case cc_eucjp:      return ujc_eucjp;
+  case cc_jis:        return ujc_jis;
+  // case cc_jis_au:     return ujc_jis_au;
+  // case cc_jis_jsky:   return ujc_jis_jsky;
+  case cc_utf8:       return ujc_utf8;
+  // case cc_utf16:      return ujc_utf16;
+  // case cc_utf32:      return ujc_utf32;
+  // case cc_utf32_be:   return ujc_utf32_be;
+  // case cc_utf32_le:   return ujc_utf32_le;
+  // case cc_sjis_jsky:  return ujc_sjis_jsky;
+  // case cc_sjis_imode: return ujc_sjis_imode;
+  // case cc_sjis_doti:  return ujc_sjis_doti;
+  // case cc_sjis_au:    return ujc_sjis_au;
+  default: return ujc_undefined;
+  }
+}
+
 /* ----------------------------------------------------------------------------
 : uj_getcode(str, len).
 +--------------------------------------------------------------------------- */
@@ -52,32 +77,149 @@ uj_charcode_t uj_getcode(const uj_uint8* str, uj_size_t len)
     fprintf(stderr,"  %d of 0..%d\n",index,matches-1);
     fprintf(stderr,"  %s\n",charcodeToStr(check[index].code));
 #endif
-    switch(check[index].code)
-    {
-    case cc_unknown:    return ujc_undefined;
-    case cc_ascii:      return ujc_ascii;
-    case cc_sjis:       return ujc_sjis;
-    case cc_eucjp:      return ujc_eucjp;
-    case cc_jis:        return ujc_jis;
-    // case cc_jis_au:     return ujc_jis_au;
-    // case cc_jis_jsky:   return ujc_jis_jsky;
-    case cc_utf8:       return ujc_utf8;
-    // case cc_utf16:      return ujc_utf16;
-    // case cc_utf32:      return ujc_utf32;
-    // case cc_utf32_be:   return ujc_utf32_be;
-    // case cc_utf32_le:   return ujc_utf32_le;
-    // case cc_sjis_jsky:  return ujc_sjis_jsky;
-    // case cc_sjis_imode: return ujc_sjis_imode;
-    // case cc_sjis_doti:  return ujc_sjis_doti;
-    // case cc_sjis_au:    return ujc_sjis_au;
-    default: return ujc_undefined;
-    }
+    return _uj_getcode_code(check[index].code);
   }else
   {
     return ujc_undefined;
   }
 }
 
+/* ----------------------------------------------------------------------------
+: _uj_auto_to_utf8(in, out).
+:   guesses the code of in and converts it to utf8 in one pass.
+:
+:   the state machines run over the input a chunk at a time, and each
+:   chunk is decoded right away as the code of the leading (highest
+:   priority) machine while it is still in the cache.  a chunk is decoded
+:   when that machine stopped at a char boundary, ie. in its base state;
+:   otherwise it waits for the next one.  only ascii, sjis, eucjp and
+:   utf8 are decoded this way, as their decoders carry no state from one
+:   char to the next, and ascii text decodes the same in all of them.
+:
+:   when the guess at the end is not the code being decoded, the output
+:   so far is dropped and the whole input is decoded again, so the result
+:   is always the same as uj_getcode followed by the decoder.
++--------------------------------------------------------------------------- */
+#define UJ_AUTO_CHUNK 16384
+
+static int _uj_auto_can_chunk(uj_charcode_t code)
+{
+  return code==ujc_ascii || code==ujc_sjis || code==ujc_eucjp || code==ujc_utf8;
+}
+
+/* decodes in[begin..end) as code and appends it to acc. */
+static int _uj_auto_decode(const uj_conv_t* in, uj_size_t begin, uj_size_t end, uj_charcode_t code, uj_conv_t* acc)
+{
+  uj_conv_t part_in;
+  uj_conv_t part_out;
+
+  _uj_conv_set_const(&part_in, in->alloc, in->buf+begin, end-begin);
+  if( _uj_any_to_utf8(&part_in, &part_out, code)==NULL )
+  {
+    return -1;
+  }
+  if( acc->buf_bufsize < acc->buf_len+part_out.buf_len+1 )
+  { /* grows twice, as acc takes the whole text a chunk at a time. */
+    uj_size_t bufsize = acc->buf_bufsize*2;
+    uj_uint8* buf;
+    if( bufsize < acc->buf_len+part_out.buf_len+1 )
+    {
+      bufsize = acc->buf_len+part_out.buf_len+1;
+    }
+    buf = _uj_realloc(acc->alloc, acc->buf, bufsize);
+    if( buf==NULL )
+    {
+      _uj_conv_free_buffer(&part_out);
+      return -1;
+    }
+    acc->buf = buf;
+    acc->buf_bufsize = bufsize;
+  }
+  memcpy(acc->buf+acc->buf_len, part_out.buf, part_out.buf_len);
+  acc->buf_len += part_out.buf_len;
+  _uj_conv_free_buffer(&part_out);
+  return 0;
+}
+
+uj_conv_t* _uj_auto_to_utf8(const uj_conv_t* in, uj_conv_t* out)
+{
+  CodeCheck check[cc_tmpl_max];
+  int cc_max;
+  uj_charcode_t spec;   /* code being decoded (ujc_auto: stopped). */
+  uj_charcode_t code;
+  uj_size_t decoded;    /* input decoded into acc so far. */
+  uj_size_t pos;
+  uj_conv_t acc;
+
+  cc_max = getcode_bom(in->buf, in->buf_len, check);
+  if( cc_max>=0 )
+  {
+    code = cc_max>0 ? _uj_getcode_code(check[0].code) : ujc_undefined;
+    return _uj_any_to_utf8(in, out, code);
+  }
+
+  memcpy(check, cc_tmpl, sizeof(cc_tmpl));
+  cc_max  = cc_tmpl_max;
+  spec    = ujc_ascii;
+  decoded = 0;
+  acc.alloc       = in->alloc;
+  acc.buf         = _uj_alloc(in->alloc, in->buf_len+1);
+  acc.buf_len     = 0;
+  acc.buf_bufsize = in->buf_len+1;
+  if( acc.buf==NULL )
+  {
+    return NULL;
+  }
+
+  for( pos=0; pos<in->buf_len && cc_max>0; )
+  {
+    uj_size_t end = in->buf_len-pos>UJ_AUTO_CHUNK ? pos+UJ_AUTO_CHUNK : in->buf_len;
+    cc_max = getcode_feed(check, cc_max, in->buf+pos, in->buf+end);
+    pos = end;
+    if( spec==ujc_auto || cc_max==0 )
+    {
+      continue;
+    }
+
+    code = _uj_getcode_code(check[0].code);
+    if( code!=spec )
+    {
+      if( spec==ujc_ascii && _uj_auto_can_chunk(code) )
+      { /* the ascii decoded so far is the same in the new code. */
+        spec = code;
+      }else
+      { /* mispredicted: decode it all again at the end. */
+        spec = ujc_auto;
+        continue;
+      }
+    }
+    if( check[0].table==check[0].base )
+    {
+      if( _uj_auto_decode(in, decoded, pos, spec, &acc)!=0 )
+      {
+        _uj_conv_free_buffer(&acc);
+        return NULL;
+      }
+      decoded = pos;
+    }
+  }
+
+  cc_max = getcode_finish(check, cc_max);
+  code = cc_max>0 ? _uj_getcode_code(check[0].code) : ujc_undefined;
+  if( spec!=code && !(spec==ujc_ascii && _uj_auto_can_chunk(code)) )
+  {
+    _uj_conv_free_buffer(&acc);
+    return _uj_any_to_utf8(in, out, code);
+  }
+  if( decoded<in->buf_len && _uj_auto_decode(in, decoded, in->buf_len, code, &acc)!=0 )
+  {
+    _uj_conv_free_buffer(&acc);
+    return NULL;
+  }
+  *out = acc;
+  return out;
+}
+
 #if 0
 /* getcode_list関数 */
 int xs_getcode_list(SV* sv_str)
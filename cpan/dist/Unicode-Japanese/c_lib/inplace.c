@@ -0,0 +1,114 @@
+/* ----------------------------------------------------------------------------
+ * inplace.c
+ * ----------------------------------------------------------------------------
+ * Mastering programmed by YAMASHINA Hio
+ *
+ * Copyright 2008 YAMASHINA Hio
+ * ----------------------------------------------------------------------------
+ * $Id$
+ * ------------------------------------------------------------------------- */
+
+#include "unijp.h"
+#include "unijp_build.h"
+#include "../inplace.h"
+
+#include <string.h>
+
+typedef uj_conv_t* (*uj_inplace_conv_t)(const uj_conv_t* in, uj_conv_t* out);
+typedef size_t (*uj_inplace_split_t)(const unsigned char* src, size_t len, size_t want);
+
+/* ----------------------------------------------------------------------------
+: _uj_inplace(alloc, &buf, &len, conv, split).
+:   converts buf[0..len) in buf itself, a chunk at a time (see inplace.h).
+:   buf is grown with alloc when an entity reference needs room.
+:   returns -1 when out of memory, and the text is lost then.
++--------------------------------------------------------------------------- */
+static int _uj_inplace(const uj_alloc_t* alloc, uj_uint8** p_buf, uj_size_t* p_len, uj_inplace_conv_t conv, uj_inplace_split_t split)
+{
+  uj_uint8* buf = *p_buf;
+  uj_size_t len = *p_len;
+  uj_size_t r = 0; /* read from. */
+  uj_size_t w = 0; /* write to. */
+
+  while( r<len )
+  {
+    uj_size_t n = split(buf+r, len-r, UJ_INPLACE_CHUNK);
+    uj_conv_t in;
+    uj_conv_t out;
+
+    _uj_conv_set_const(&in, alloc, buf+r, n);
+    if( conv(&in, &out)==NULL )
+    {
+      return -1;
+    }
+    r += n;
+    if( w+out.buf_len > r )
+    { /* an entity reference would pass the text not read yet. */
+      uj_size_t extra = w+out.buf_len-r+UJ_INPLACE_CHUNK;
+      uj_uint8* grown = _uj_realloc(alloc, buf, len+extra+1);
+      if( grown==NULL )
+      {
+        _uj_conv_free_buffer(&out);
+        return -1;
+      }
+      buf = grown;
+      *p_buf = buf;
+      memmove(buf+r+extra, buf+r, len-r);
+      r   += extra;
+      len += extra;
+    }
+    /* out may still point into buf when the chunk was plain ascii. */
+    memmove(buf+w, out.buf, out.buf_len);
+    w += out.buf_len;
+    _uj_conv_free_buffer(&out);
+  }
+  *p_len = w;
+  return 0;
+}
+
+/* ----------------------------------------------------------------------------
+: str = uj_conv_inplace(uj, ocode, &len).
++--------------------------------------------------------------------------- */
+uj_uint8* uj_conv_inplace(unijp_t* uj, uj_charcode_t ocode, uj_size_t* p_len)
+{
+  uj_uint8* buf = uj->data;
+  uj_size_t len = uj->data_len;
+  int ret;
+
+  switch( ocode )
+  {
+  case ujc_utf8:
+    ret = 0;
+    break;
+  case ujc_sjis:
+    ret = _uj_inplace(uj->alloc, &buf, &len, _uj_utf8_to_sjis, uj_inplace_split_utf8);
+    break;
+  case ujc_eucjp:
+    ret = _uj_inplace(uj->alloc, &buf, &len, _uj_utf8_to_eucjp, uj_inplace_split_utf8);
+    break;
+  default:
+    /* the other codes grow; convert as usual and drop the text. */
+    buf = uj_conv(uj, ocode, &len);
+    _uj_free(uj->alloc, uj->data);
+    ret = buf!=NULL ? 0 : -1;
+    break;
+  }
+
+  /* the text now belongs to the caller (or is gone). */
+  uj->data     = NULL;
+  uj->data_len = 0;
+  if( ret!=0 )
+  {
+    _uj_free(uj->alloc, buf);
+    return NULL;
+  }
+  if( p_len )
+  {
+    *p_len = len;
+  }
+  return buf;
+}
+
+/* ----------------------------------------------------------------------------
+ * End of File.
+ * ------------------------------------------------------------------------- */
@@ -11,7 +11,7 @@ int main(int argc, const char* argv[])
   uj_uint8*   out;
   uj_size_t   out_len;
 
-  printf("1..7\n");
+  printf("1..10\n");
 
   uj = uj_new((uj_uint8*)in_str, in_len, ujc_utf8);
   printf("ok 1 - new\n");
@@ -26,5 +26,19 @@ int main(int argc, const char* argv[])
   uj_delete(uj);
   printf("ok 7 - delete\n");
 
+  {
+    /* overlong and out of range forms are replaced with '?'. */
+    const char* bad_str = "0123456789abcdef" "0123456789abcdef"
+      "a\xC0\xAF" "b\xE0\x80\xAF" "c\xE0\xA0\x80" "d\xF0\x8F\xBF\xBF"
+      "e\xF4\x90\x80\x80" "f\xFC\x80\x80\x80\x80\x80" "g\xE0\x80";
+    const char* fixed = "0123456789abcdef" "0123456789abcdef"
+      "a?" "b?" "c\xE0\xA0\x80" "d?" "e?" "f?" "g\xE0\x80";
+    uj = uj_new((uj_uint8*)bad_str, strlen(bad_str), ujc_utf8);
+    printf("%s 8 - validate.len(%d)==%d\n", uj->data_len==strlen(fixed) ? "ok" : "not ok", (int)uj->data_len, (int)strlen(fixed));
+    printf("%s 9 - validate\n", memcmp(uj->data, fixed, strlen(fixed))==0 ? "ok" : "not ok");
+    uj_delete(uj);
+    printf("ok 10 - delete\n");
+  }
+
   return 0;
 }
@@ -11,7 +11,7 @@ int main(int argc, const char* argv[])
   uj_size_t   sjis_len = 2;
   uj_size_t   utf8_len = 3;
 
-  printf("1..10\n");
+  printf("1..13\n");
 
   uj = uj_new((uj_uint8*)love_sjis, sjis_len, ujc_sjis);
   printf("ok 1 - new\n");
@@ -39,5 +39,27 @@ int main(int argc, const char* argv[])
   uj_delete(uj);
   printf("ok 10 - delete\n");
 
+  {
+    /* ascii is passed through as is, past the vector blocks too. */
+    const char* ascii = "Subject: [elena:00123] re: weekly meeting minutes";
+    uj_size_t   ascii_len = strlen(ascii);
+    uj_uint8*   out;
+    uj_size_t   out_len;
+
+    uj = uj_new((const uj_uint8*)ascii, ascii_len, ujc_sjis);
+    printf("%s 11 - ascii data\n", uj->data_len==ascii_len && memcmp(uj->data, ascii, ascii_len)==0 ? "ok" : "not ok");
+    out = uj_to_sjis(uj, &out_len);
+    printf("%s 12 - ascii sjis\n", out_len==ascii_len && memcmp(out, ascii, ascii_len)==0 ? "ok" : "not ok");
+    uj_delete(uj);
+  }
+
+  {
+    /* ESC is not plain ascii; it still goes through the converter. */
+    const char* esc = "0123456789abcdef\x1b(B" "0123456789abcdef";
+    uj = uj_new((const uj_uint8*)esc, strlen(esc), ujc_sjis);
+    printf("%s 13 - ascii with esc\n", uj->data_len==strlen(esc) && memcmp(uj->data, esc, strlen(esc))==0 ? "ok" : "not ok");
+    uj_delete(uj);
+  }
+
   return 0;
 }
@@ -0,0 +1,116 @@
+#include "unijp.h"
+#include "unijp_build.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+/* dumps a digest of every unicode transcoder output over generated
+ * input.  09_simd.t runs this with and without UNIJP_NO_SIMD and
+ * compares, so the vector kernels must match the scalar code exactly. */
+
+static unsigned long rnd_state = 1;
+static unsigned rnd(unsigned n)
+{
+  rnd_state = rnd_state*1103515245 + 12345;
+  return (unsigned)((rnd_state>>16) & 0x7fff) % n;
+}
+
+static unsigned long fnv(const uj_uint8* p, uj_size_t len)
+{
+  unsigned long h = 2166136261UL;
+  uj_size_t i;
+  for( i=0; i<len; ++i )
+  {
+    h = ((h ^ p[i]) * 16777619UL) & 0xffffffffUL;
+  }
+  return h;
+}
+
+static uj_size_t put_utf8(uj_uint8* p, unsigned long ucs)
+{
+  if( ucs<0x80 )    { p[0] = ucs; return 1; }
+  if( ucs<0x800 )   { p[0] = 0xc0|(ucs>>6); p[1] = 0x80|(ucs&0x3f); return 2; }
+  if( ucs<0x10000 ) { p[0] = 0xe0|(ucs>>12); p[1] = 0x80|((ucs>>6)&0x3f); p[2] = 0x80|(ucs&0x3f); return 3; }
+  p[0] = 0xf0|(ucs>>18); p[1] = 0x80|((ucs>>12)&0x3f); p[2] = 0x80|((ucs>>6)&0x3f); p[3] = 0x80|(ucs&0x3f);
+  return 4;
+}
+
+/* runs of ascii and kanji long enough to hit the kernels, mixed with
+ * latin, astral, surrogate and broken sequences. */
+static uj_size_t gen_utf8(uj_uint8* buf, uj_size_t max, int valid)
+{
+  uj_size_t len = 0;
+  while( len+8*4 < max )
+  {
+    unsigned kind = rnd(valid ? 5 : 7);
+    unsigned run  = 1 + rnd(40);
+    unsigned i;
+    for( i=0; i<run && len+8*4<max; ++i )
+    {
+      switch( kind )
+      {
+      case 0: case 1: buf[len++] = 0x20 + rnd(0x5f); break;
+      case 2: len += put_utf8(buf+len, 0x3041 + rnd(0x5000)); break;
+      case 3: len += put_utf8(buf+len, 0x80 + rnd(0x780)); break;
+      case 4: len += put_utf8(buf+len, 0x10000 + rnd(0x1000)); break;
+      case 5: len += put_utf8(buf+len, 0xd800 + rnd(0x800)); break;
+      default: buf[len++] = 0x80 + rnd(0x80); break;
+      }
+    }
+  }
+  return len;
+}
+
+typedef uj_conv_t* (*conv_f)(const uj_conv_t* in, uj_conv_t* out);
+
+static const struct { const char* name; conv_f from_utf8; conv_f to_utf8; } pairs[] = {
+  { "utf16",   _uj_utf8_to_utf16,   _uj_utf16_to_utf8   },
+  { "utf16le", _uj_utf8_to_utf16le, _uj_utf16le_to_utf8 },
+  { "ucs2",    _uj_utf8_to_ucs2,    _uj_ucs2_to_utf8    },
+  { "ucs4",    _uj_utf8_to_ucs4,    _uj_ucs4_to_utf8    },
+  { "ucs4le",  _uj_utf8_to_ucs4le,  _uj_ucs4le_to_utf8  },
+};
+
+int main(int argc, const char* argv[])
+{
+  static uj_uint8 buf[4096];
+  int n;
+  unsigned p;
+
+  for( n=0; n<400; ++n )
+  {
+    const int valid = n%2==0;
+    const uj_size_t len = gen_utf8(buf, 64 + rnd(sizeof(buf)-64), valid);
+    for( p=0; p<sizeof(pairs)/sizeof(pairs[0]); ++p )
+    {
+      uj_conv_t in, enc, dec;
+      _uj_conv_set_const(&in, NULL, buf, len);
+      pairs[p].from_utf8(&in, &enc);
+      pairs[p].to_utf8(&enc, &dec);
+      printf("%d %s %08lx %08lx", n, pairs[p].name,
+             fnv(enc.buf, enc.buf_len), fnv(dec.buf, dec.buf_len));
+      if( valid && p!=2 )
+      {
+        /* ucs2 drops astral chars, others must round trip. */
+        printf(" %s", dec.buf_len==len && memcmp(dec.buf, buf, len)==0 ? "roundtrip" : "BROKEN");
+      }
+      printf("\n");
+
+      /* the encoded form with random bytes flipped, too. */
+      if( enc.buf_len>=4 )
+      {
+        uj_size_t i;
+        for( i=0; i<4; ++i )
+        {
+          enc.buf[rnd(enc.buf_len)] ^= 1<<rnd(8);
+        }
+        _uj_conv_free_buffer(&dec);
+        pairs[p].to_utf8(&enc, &dec);
+        printf("%d %s~ %08lx\n", n, pairs[p].name, fnv(dec.buf, dec.buf_len));
+      }
+      _uj_conv_free_buffer(&enc);
+      _uj_conv_free_buffer(&dec);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,29 @@
+#! /usr/bin/perl
+
+use strict;
+use warnings;
+
+my $prog = $0;
+$prog =~ s/\.t$// or die "invalid prog name";
+
+my $src = "$prog.c";
+
+$prog =~ /\// or $prog = "./$prog";
+
+my $cc      = 'gcc';
+my $cflags  = '-I. -I..';
+my $ldflags = '-L. -L..';
+my $ldlibs  = '-lunijp';
+
+my $cmd = "$cc $cflags $ldflags $src $ldlibs -o $prog";
+system($cmd)==0 or die "system: $? <<$cmd>>";
+
+print "1..3\n";
+
+my $simd = `$prog`;
+print $?==0 && $simd ne '' ? "ok 1 - run\n" : "not ok 1 - run\n";
+
+my $scalar = do{ local($ENV{UNIJP_NO_SIMD}) = 1; `$prog` };
+print $simd eq $scalar ? "ok 2 - simd == scalar\n" : "not ok 2 - simd == scalar\n";
+
+print $simd !~ /BROKEN/ ? "ok 3 - roundtrip\n" : "not ok 3 - roundtrip\n";
@@ -0,0 +1,86 @@
+#include "unijp.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+/* ujc_auto decodes while it guesses; the result must be the same as
+ * uj_getcode and then the decoder, also when the guess changes on the
+ * way. */
+
+static int test_no = 0;
+
+static void check(const char* name, const uj_uint8* src, uj_size_t len, uj_charcode_t code)
+{
+  unijp_t*   a;
+  unijp_t*   b;
+  uj_charcode_t guess = uj_getcode(src, len);
+
+  ++test_no;
+  printf("%s %d - %s: getcode(%s)\n", guess==code ? "ok" : "not ok", test_no, name, uj_charcode_str(guess));
+
+  a = uj_new(src, len, ujc_auto);
+  b = uj_new(src, len, code);
+  ++test_no;
+  printf("%s %d - %s: auto\n", a->data_len==b->data_len && memcmp(a->data, b->data, a->data_len)==0 ? "ok" : "not ok", test_no, name);
+  uj_delete(a);
+  uj_delete(b);
+}
+
+/* pad ascii, then rep x text. */
+static uj_uint8* make(uj_size_t pad, const char* text, int rep, const char* tail, uj_size_t* p_len)
+{
+  uj_size_t text_len = strlen(text);
+  uj_size_t tail_len = strlen(tail);
+  uj_uint8* buf = malloc(pad + text_len*rep + tail_len);
+  uj_size_t len = 0;
+  int i;
+  for( ; len<pad; ++len )
+  {
+    buf[len] = len%64==63 ? '\n' : 'a' + len%26;
+  }
+  for( i=0; i<rep; ++i )
+  {
+    memcpy(buf+len, text, text_len);
+    len += text_len;
+  }
+  memcpy(buf+len, tail, tail_len);
+  len += tail_len;
+  *p_len = len;
+  return buf;
+}
+
+int main(int argc, const char* argv[])
+{
+  uj_uint8* buf;
+  uj_size_t len;
+
+  printf("1..12\n");
+
+  buf = make(100, "", 0, "", &len);
+  check("ascii", buf, len, ujc_ascii);
+  free(buf);
+
+  /* sjis past the first chunks of ascii. */
+  buf = make(40000, "\x88\xa4 love ", 5000, "", &len);
+  check("sjis", buf, len, ujc_sjis);
+  free(buf);
+
+  buf = make(40000, "\xb0\xa6 love ", 5000, "", &len);
+  check("eucjp", buf, len, ujc_eucjp);
+  free(buf);
+
+  buf = make(10, "\xe6\x84\x9b love ", 5000, "", &len);
+  check("utf8", buf, len, ujc_utf8);
+  free(buf);
+
+  buf = make(10, "\x1b$B0&\x1b(B love ", 5000, "", &len);
+  check("jis", buf, len, ujc_jis);
+  free(buf);
+
+  /* reads as eucjp until the sjis kanji at the end. */
+  buf = make(10, "\xb0\xa6 love ", 5000, "\x88\x9f", &len);
+  check("eucjp then sjis", buf, len, ujc_sjis);
+  free(buf);
+
+  return 0;
+}
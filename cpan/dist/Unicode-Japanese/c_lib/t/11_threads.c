@@ -0,0 +1,111 @@
+#include "unijp.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+/* converts the same texts on many threads at once, also through one
+ * shared unijp_t; every thread must get what one thread alone gets. */
+
+#define NR_THREADS 8
+#define NR_ROUNDS  20
+
+static const uj_charcode_t codes[] = { ujc_utf8, ujc_sjis, ujc_eucjp, ujc_jis, ujc_ucs2, ujc_utf16 };
+#define NR_CODES (sizeof(codes)/sizeof(codes[0]))
+
+static uj_uint8* text;
+static uj_size_t text_len;
+static unijp_t*  shared;
+static uj_uint8* expect[NR_CODES];
+static uj_size_t expect_len[NR_CODES];
+
+static int check_all(const unijp_t* uj)
+{
+  unsigned i;
+  for( i=0; i<NR_CODES; ++i )
+  {
+    uj_size_t len;
+    uj_uint8* out = uj_conv((unijp_t*)uj, codes[i], &len);
+    int same = len==expect_len[i] && memcmp(out, expect[i], len)==0;
+    free(out);
+    if( !same )
+    {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+static void* worker(void* arg)
+{
+  int* ok = arg;
+  int round;
+  *ok = 1;
+  for( round=0; round<NR_ROUNDS; ++round )
+  {
+    unijp_t* uj = uj_new(text, text_len, ujc_auto);
+    if( uj_getcode(text, text_len)!=ujc_sjis || !check_all(uj) || !check_all(shared) )
+    {
+      *ok = 0;
+    }
+    uj_delete(uj);
+  }
+  return NULL;
+}
+
+int main(int argc, const char* argv[])
+{
+  static const char* words[] = { "\x88\xa4", "love ", "\x83\x81\x81\x5b\x83\x8b", "\xb1\xb2", "\r\n" };
+  pthread_t th[NR_THREADS];
+  int ok[NR_THREADS];
+  uj_size_t cap = 100000;
+  unsigned i;
+  int all_ok;
+
+  printf("1..2\n");
+
+  text = malloc(cap);
+  text_len = 0;
+  for( i=0; text_len+8<cap; ++i )
+  {
+    const char* w = words[(i*7+i/3)%5];
+    memcpy(text+text_len, w, strlen(w));
+    text_len += strlen(w);
+  }
+  shared = uj_new(text, text_len, ujc_sjis);
+  for( i=0; i<NR_CODES; ++i )
+  {
+    expect[i] = uj_conv(shared, codes[i], &expect_len[i]);
+  }
+
+  all_ok = 1;
+  for( i=0; i<NR_THREADS; ++i )
+  {
+    if( pthread_create(&th[i], NULL, worker, &ok[i])!=0 )
+    {
+      all_ok = 0;
+      ok[i] = 1;
+      th[i] = 0;
+    }
+  }
+  printf("%s 1 - start threads\n", all_ok ? "ok" : "not ok");
+
+  all_ok = 1;
+  for( i=0; i<NR_THREADS; ++i )
+  {
+    if( th[i]!=0 )
+    {
+      pthread_join(th[i], NULL);
+    }
+    all_ok = all_ok && ok[i];
+  }
+  printf("%s 2 - same results on every thread\n", all_ok ? "ok" : "not ok");
+
+  for( i=0; i<NR_CODES; ++i )
+  {
+    free(expect[i]);
+  }
+  uj_delete(shared);
+  free(text);
+  return 0;
+}
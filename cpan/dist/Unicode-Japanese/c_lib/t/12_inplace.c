@@ -0,0 +1,73 @@
+#include "unijp.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+/* uj_conv_inplace must give the same text as uj_conv, over many chunks
+ * and when entity references make the text longer than the input. */
+
+static int test_no = 0;
+
+static void check(const char* name, const uj_uint8* src, uj_size_t len)
+{
+  static const uj_charcode_t codes[] = { ujc_sjis, ujc_eucjp, ujc_jis, ujc_utf8 };
+  unsigned i;
+  for( i=0; i<sizeof(codes)/sizeof(codes[0]); ++i )
+  {
+    unijp_t*  uj = uj_new(src, len, ujc_utf8);
+    uj_size_t expect_len;
+    uj_uint8* expect = uj_conv(uj, codes[i], &expect_len);
+    uj_size_t out_len;
+    uj_uint8* out = uj_conv_inplace(uj, codes[i], &out_len);
+    ++test_no;
+    printf("%s %d - %s: %s\n",
+           out!=NULL && out_len==expect_len && memcmp(out, expect, out_len)==0 ? "ok" : "not ok",
+           test_no, name, uj_charcode_str(codes[i]));
+    free(expect);
+    free(out);
+    uj_delete(uj);
+  }
+}
+
+/* rep x text. */
+static uj_uint8* make(const char* text, int rep, uj_size_t* p_len)
+{
+  uj_size_t text_len = strlen(text);
+  uj_uint8* buf = malloc(text_len*rep+1);
+  int i;
+  for( i=0; i<rep; ++i )
+  {
+    memcpy(buf+text_len*i, text, text_len);
+  }
+  *p_len = text_len*rep;
+  return buf;
+}
+
+int main(int argc, const char* argv[])
+{
+  uj_uint8* buf;
+  uj_size_t len;
+
+  printf("1..16\n");
+
+  buf = make("", 0, &len);
+  check("empty", buf, len);
+  free(buf);
+
+  /* kanji, kana and half width kana, cut at every byte of a char. */
+  buf = make("\xe6\x84\x9b \xe3\x81\x82\xef\xbd\xb1\r\n", 30001, &len);
+  check("kanji", buf, len);
+  free(buf);
+
+  /* latin letters are entity references in sjis, and longer. */
+  buf = make("caf\xc3\xa9 ", 40000, &len);
+  check("entity", buf, len);
+  free(buf);
+
+  /* broken sequences across the chunks. */
+  buf = make("\xe6\x84\x9b\x84\x9b\x9b\x9b\x9b\x9b\x9b\x9b\xf0\x80", 20000, &len);
+  check("broken", buf, len);
+  free(buf);
+
+  return 0;
+}
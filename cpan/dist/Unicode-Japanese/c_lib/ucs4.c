@@ -15,6 +15,8 @@
 
 #define xs_ucs4_utf8(decl) _uj_xs_ucs4_utf8(const uj_conv_t* sv_str, uj_conv_t* __out)
 #define xs_utf8_ucs4(decl) _uj_xs_utf8_ucs4(const uj_conv_t* sv_str, uj_conv_t* __out)
+#define xs_ucs4le_utf8(decl) _uj_xs_ucs4le_utf8(const uj_conv_t* sv_str, uj_conv_t* __out)
+#define xs_utf8_ucs4le(decl) _uj_xs_utf8_ucs4le(const uj_conv_t* sv_str, uj_conv_t* __out)
 
 #include <stdlib.h>
 #include <netinet/in.h>
@@ -24,8 +26,12 @@
 
 #undef xs_ucs4_utf8
 #undef xs_utf8_ucs4
+#undef xs_ucs4le_utf8
+#undef xs_utf8_ucs4le
 #define xs_ucs4_utf8(in,out) _uj_xs_ucs4_utf8(in,out)
 #define xs_utf8_ucs4(in,out) _uj_xs_utf8_ucs4(in,out)
+#define xs_ucs4le_utf8(in,out) _uj_xs_ucs4le_utf8(in,out)
+#define xs_utf8_ucs4le(in,out) _uj_xs_utf8_ucs4le(in,out)
 
 uj_conv_t* _uj_ucs4_to_utf8(const uj_conv_t* in, uj_conv_t* out)
 {
@@ -43,6 +49,22 @@ uj_conv_t* _uj_utf8_to_ucs4(const uj_conv_t* in, uj_conv_t* out)
   return ret;
 }
 
+uj_conv_t* _uj_ucs4le_to_utf8(const uj_conv_t* in, uj_conv_t* out)
+{
+  uj_conv_t* ret;
+  ret = xs_ucs4le_utf8(in, out);
+  /* ret == out|NULL */
+  return ret;
+}
+
+uj_conv_t* _uj_utf8_to_ucs4le(const uj_conv_t* in, uj_conv_t* out)
+{
+  uj_conv_t* ret;
+  ret = xs_utf8_ucs4le(in, out);
+  /* ret == out|NULL */
+  return ret;
+}
+
 /* ----------------------------------------------------------------------------
 : uj_to_ucs4(uj, &len).
 +--------------------------------------------------------------------------- */
@@ -0,0 +1,740 @@
+/* ----------------------------------------------------------------------------
+ * ujbench.c
+ * throughput of every conversion in libunijp.
+ * ----------------------------------------------------------------------------
+ * Mastering programmed by YAMASHINA Hio
+ *
+ * Copyright 2008 YAMASHINA Hio
+ * ----------------------------------------------------------------------------
+ * $Id$
+ * ------------------------------------------------------------------------- */
+
+/* every _uj_X_to_utf8 / _uj_utf8_to_X, uj_to_X and uj_getcode is run over
+ * the same corpora, which are made from a fixed seed (and the files given
+ * on the command line), so two runs on the same machine can be compared.
+ *
+ * one tab separated line is written for each (corpus, op, input):
+ *   corpus op input in_bytes out_bytes calls mb_s cycles_byte allocs reallocs alloc_bytes
+ * mb_s is 10^6 bytes of input a second, cycles_byte is tsc ticks per byte
+ * of input ("-" without a tsc), and the alloc columns are for one call.
+ * lines starting with "#" are comments.
+ */
+
+#include "unijp.h"
+#include "unijp_build.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define UJBENCH_VERSION "0.01"
+
+/* default corpus size and time for each op. */
+#define UJBENCH_SIZE (1024*1024)
+#define UJBENCH_TIME 0.5
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#define UJBENCH_HAVE_TSC 1
+#define ujbench_tsc() ((unsigned long long)__builtin_ia32_rdtsc())
+#else
+#define UJBENCH_HAVE_TSC 0
+#define ujbench_tsc() 0ULL
+#endif
+
+/* ----------------------------------------------------------------------------
+ * allocator which counts the calls.
+ * ------------------------------------------------------------------------- */
+typedef struct ujbench_count_s
+{
+  unsigned long allocs;
+  unsigned long reallocs;
+  unsigned long bytes;
+} ujbench_count_t;
+
+static ujbench_count_t s_count;
+
+static void* ujbench_alloc(void* baton, uj_size_t size)
+{
+  ++s_count.allocs;
+  s_count.bytes += size;
+  return malloc(size);
+}
+static void* ujbench_realloc(void* baton, void* ptr, uj_size_t size)
+{
+  ++s_count.reallocs;
+  s_count.bytes += size;
+  return realloc(ptr, size);
+}
+static void ujbench_free(void* baton, void* ptr)
+{
+  free(ptr);
+}
+
+static const uj_alloc_t s_alloc = {
+  UJ_ALLOC_MAGIC, NULL, ujbench_alloc, ujbench_realloc, ujbench_free,
+};
+
+/* ----------------------------------------------------------------------------
+ * encodings of a corpus.
+ * ------------------------------------------------------------------------- */
+enum ujbench_enc_e
+{
+  UJBENCH_UTF8,
+  UJBENCH_SJIS,
+  UJBENCH_EUCJP,
+  UJBENCH_JIS,
+  UJBENCH_UCS2,
+  UJBENCH_UCS4,
+  UJBENCH_UCS4LE,
+  UJBENCH_UTF16,
+  UJBENCH_UTF16LE,
+  UJBENCH_NR_ENCS,
+};
+
+typedef uj_conv_t* (*ujbench_conv_t)(const uj_conv_t* in, uj_conv_t* out);
+typedef uj_uint8* (*ujbench_to_t)(const unijp_t* uj, uj_size_t* p_len);
+
+static const struct
+{
+  const char*    name;
+  ujbench_conv_t encode; /* utf8 => this (NULL for utf8). */
+} s_encs[UJBENCH_NR_ENCS] = {
+  { "utf8",    NULL, },
+  { "sjis",    _uj_utf8_to_sjis, },
+  { "eucjp",   _uj_utf8_to_eucjp, },
+  { "jis",     _uj_utf8_to_jis, },
+  { "ucs2",    _uj_utf8_to_ucs2, },
+  { "ucs4",    _uj_utf8_to_ucs4, },
+  { "ucs4le",  _uj_utf8_to_ucs4le, },
+  { "utf16",   _uj_utf8_to_utf16, },
+  { "utf16le", _uj_utf8_to_utf16le, },
+};
+
+typedef struct ujbench_corpus_s
+{
+  char      name[64];
+  uj_uint8* text[UJBENCH_NR_ENCS];
+  uj_size_t len[UJBENCH_NR_ENCS];
+  unijp_t*  uj; /* for uj_to_X. */
+} ujbench_corpus_t;
+
+/* ----------------------------------------------------------------------------
+ * the ops.
+ * ------------------------------------------------------------------------- */
+enum ujbench_kind_e
+{
+  UJBENCH_GETCODE, /* uj_getcode(input). */
+  UJBENCH_CONV,    /* conv(input). */
+  UJBENCH_TO,      /* to(uj), uj made from utf8. */
+};
+
+typedef struct ujbench_op_s
+{
+  const char*    name;
+  int            kind;
+  int            input;
+  ujbench_conv_t conv;
+  ujbench_to_t   to;
+} ujbench_op_t;
+
+static const ujbench_op_t s_ops[] = {
+  { "getcode",         UJBENCH_GETCODE, UJBENCH_UTF8,    NULL, NULL, },
+  { "getcode",         UJBENCH_GETCODE, UJBENCH_SJIS,    NULL, NULL, },
+  { "getcode",         UJBENCH_GETCODE, UJBENCH_EUCJP,   NULL, NULL, },
+  { "getcode",         UJBENCH_GETCODE, UJBENCH_JIS,     NULL, NULL, },
+  { "getcode",         UJBENCH_GETCODE, UJBENCH_UCS2,    NULL, NULL, },
+  { "getcode",         UJBENCH_GETCODE, UJBENCH_UCS4,    NULL, NULL, },
+  { "getcode",         UJBENCH_GETCODE, UJBENCH_UTF16,   NULL, NULL, },
+  { "auto_to_utf8",    UJBENCH_CONV, UJBENCH_UTF8,    _uj_auto_to_utf8,    NULL, },
+  { "auto_to_utf8",    UJBENCH_CONV, UJBENCH_SJIS,    _uj_auto_to_utf8,    NULL, },
+  { "auto_to_utf8",    UJBENCH_CONV, UJBENCH_EUCJP,   _uj_auto_to_utf8,    NULL, },
+  { "auto_to_utf8",    UJBENCH_CONV, UJBENCH_JIS,     _uj_auto_to_utf8,    NULL, },
+  { "validate_utf8",   UJBENCH_CONV, UJBENCH_UTF8,    _uj_validate_utf8,   NULL, },
+  { "sjis_to_utf8",    UJBENCH_CONV, UJBENCH_SJIS,    _uj_sjis_to_utf8,    NULL, },
+  { "eucjp_to_utf8",   UJBENCH_CONV, UJBENCH_EUCJP,   _uj_eucjp_to_utf8,   NULL, },
+  { "jis_to_utf8",     UJBENCH_CONV, UJBENCH_JIS,     _uj_jis_to_utf8,     NULL, },
+  { "ucs2_to_utf8",    UJBENCH_CONV, UJBENCH_UCS2,    _uj_ucs2_to_utf8,    NULL, },
+  { "ucs4_to_utf8",    UJBENCH_CONV, UJBENCH_UCS4,    _uj_ucs4_to_utf8,    NULL, },
+  { "ucs4le_to_utf8",  UJBENCH_CONV, UJBENCH_UCS4LE,  _uj_ucs4le_to_utf8,  NULL, },
+  { "utf16_to_utf8",   UJBENCH_CONV, UJBENCH_UTF16,   _uj_utf16_to_utf8,   NULL, },
+  { "utf16le_to_utf8", UJBENCH_CONV, UJBENCH_UTF16LE, _uj_utf16le_to_utf8, NULL, },
+  { "utf8_to_sjis",    UJBENCH_CONV, UJBENCH_UTF8,    _uj_utf8_to_sjis,    NULL, },
+  { "utf8_to_eucjp",   UJBENCH_CONV, UJBENCH_UTF8,    _uj_utf8_to_eucjp,   NULL, },
+  { "utf8_to_jis",     UJBENCH_CONV, UJBENCH_UTF8,    _uj_utf8_to_jis,     NULL, },
+  { "utf8_to_ucs2",    UJBENCH_CONV, UJBENCH_UTF8,    _uj_utf8_to_ucs2,    NULL, },
+  { "utf8_to_ucs4",    UJBENCH_CONV, UJBENCH_UTF8,    _uj_utf8_to_ucs4,    NULL, },
+  { "utf8_to_ucs4le",  UJBENCH_CONV, UJBENCH_UTF8,    _uj_utf8_to_ucs4le,  NULL, },
+  { "utf8_to_utf16",   UJBENCH_CONV, UJBENCH_UTF8,    _uj_utf8_to_utf16,   NULL, },
+  { "utf8_to_utf16le", UJBENCH_CONV, UJBENCH_UTF8,    _uj_utf8_to_utf16le, NULL, },
+  { "uj_to_utf8",      UJBENCH_TO,   UJBENCH_UTF8,    NULL, uj_to_utf8,  },
+  { "uj_to_sjis",      UJBENCH_TO,   UJBENCH_UTF8,    NULL, uj_to_sjis,  },
+  { "uj_to_eucjp",     UJBENCH_TO,   UJBENCH_UTF8,    NULL, uj_to_eucjp, },
+  { "uj_to_jis",       UJBENCH_TO,   UJBENCH_UTF8,    NULL, uj_to_jis,   },
+  { "uj_to_ucs2",      UJBENCH_TO,   UJBENCH_UTF8,    NULL, uj_to_ucs2,  },
+  { "uj_to_ucs4",      UJBENCH_TO,   UJBENCH_UTF8,    NULL, uj_to_ucs4,  },
+  { "uj_to_utf16",     UJBENCH_TO,   UJBENCH_UTF8,    NULL, uj_to_utf16, },
+};
+#define UJBENCH_NR_OPS (sizeof(s_ops)/sizeof(s_ops[0]))
+
+/* ----------------------------------------------------------------------------
+ * making the corpora.
+ * ------------------------------------------------------------------------- */
+typedef struct ujbench_buf_s
+{
+  uj_uint8* buf;
+  uj_size_t len;
+  uj_size_t size;
+} ujbench_buf_t;
+
+static void buf_add(ujbench_buf_t* b, const void* p, uj_size_t n)
+{
+  if( b->len+n > b->size )
+  {
+    b->size = (b->len+n)*2;
+    b->buf  = realloc(b->buf, b->size);
+    if( b->buf==NULL )
+    {
+      fprintf(stderr, "realloc: %s\n", strerror(errno));
+      exit(1);
+    }
+  }
+  memcpy(b->buf+b->len, p, n);
+  b->len += n;
+}
+
+static void buf_add_ucs(ujbench_buf_t* b, unsigned long ucs)
+{
+  uj_uint8 s[4];
+  if( ucs<0x80 )
+  {
+    s[0] = ucs;
+    buf_add(b, s, 1);
+  }else if( ucs<0x800 )
+  {
+    s[0] = 0xc0 | (ucs>>6);
+    s[1] = 0x80 | (ucs & 0x3f);
+    buf_add(b, s, 2);
+  }else if( ucs<0x10000 )
+  {
+    s[0] = 0xe0 | (ucs>>12);
+    s[1] = 0x80 | ((ucs>>6) & 0x3f);
+    s[2] = 0x80 | (ucs & 0x3f);
+    buf_add(b, s, 3);
+  }else
+  {
+    s[0] = 0xf0 | (ucs>>18);
+    s[1] = 0x80 | ((ucs>>12) & 0x3f);
+    s[2] = 0x80 | ((ucs>>6) & 0x3f);
+    s[3] = 0x80 | (ucs & 0x3f);
+    buf_add(b, s, 4);
+  }
+}
+
+/* the same numbers on every machine. */
+static unsigned long s_seed;
+static unsigned long rnd(unsigned long n)
+{
+  s_seed = (s_seed*1103515245UL + 12345UL) & 0x7fffffffUL;
+  return (s_seed>>8) % n;
+}
+
+/* kanji of jis level 1 (0xb0a1..0xcefe in eucjp), 3 bytes each in utf8. */
+static uj_uint8* s_kanji;
+static uj_size_t s_nr_kanji;
+
+static void make_kanji(void)
+{
+  ujbench_buf_t b = { NULL, 0, 0 };
+  uj_conv_t in, out;
+  int hi, lo;
+  for( hi=0xb0; hi<=0xce; ++hi )
+  {
+    for( lo=0xa1; lo<=0xfe; ++lo )
+    {
+      uj_uint8 s[2] = { hi, lo };
+      buf_add(&b, s, 2);
+    }
+  }
+  _uj_conv_set_const(&in, NULL, b.buf, b.len);
+  if( _uj_eucjp_to_utf8(&in, &out)==NULL || out.buf_len!=b.len/2*3 )
+  {
+    fprintf(stderr, "ujbench: can not make the kanji table\n");
+    exit(1);
+  }
+  s_kanji    = _uj_conv_own_string(&out);
+  s_nr_kanji = out.buf_len/3;
+  free(b.buf);
+}
+
+static void add_kanji(ujbench_buf_t* b)
+{
+  buf_add(b, s_kanji+rnd(s_nr_kanji)*3, 3);
+}
+static void add_hiragana(ujbench_buf_t* b) { buf_add_ucs(b, 0x3041+rnd(0x53)); }
+static void add_katakana(ujbench_buf_t* b) { buf_add_ucs(b, 0x30a1+rnd(0x56)); }
+static void add_punct(ujbench_buf_t* b)    { buf_add_ucs(b, rnd(2) ? 0x3001 : 0x3002); }
+static void add_emoji(ujbench_buf_t* b)
+{ /* pictographs (4 bytes) and miscellaneous symbols (3 bytes). */
+  buf_add_ucs(b, rnd(2) ? 0x1f300+rnd(0x300) : 0x2600+rnd(0x100));
+}
+
+static void gen_ascii(ujbench_buf_t* b, uj_size_t size)
+{
+  uj_size_t col = 0;
+  while( b->len<size )
+  {
+    int n = 2+rnd(8);
+    for( ; n>0; --n, ++col )
+    {
+      buf_add_ucs(b, 'a'+rnd(26));
+    }
+    if( col>=72 )
+    {
+      buf_add(b, ".\n", 2);
+      col = 0;
+    }else
+    {
+      buf_add(b, " ", 1);
+      ++col;
+    }
+  }
+}
+
+/* weights are percent for: kanji, hiragana, katakana, punctuation, emoji;
+ * the rest is ascii. */
+static void gen_mix(ujbench_buf_t* b, uj_size_t size, const int* w)
+{
+  int col = 0;
+  while( b->len<size )
+  {
+    int r = rnd(100);
+    if( (r-=w[0])<0 )      add_kanji(b);
+    else if( (r-=w[1])<0 ) add_hiragana(b);
+    else if( (r-=w[2])<0 ) add_katakana(b);
+    else if( (r-=w[3])<0 ) add_punct(b);
+    else if( (r-=w[4])<0 ) add_emoji(b);
+    else                   buf_add_ucs(b, 'a'+rnd(26));
+    if( ++col==40 )
+    {
+      buf_add(b, "\n", 1);
+      col = 0;
+    }
+  }
+}
+
+static void gen_kanji(ujbench_buf_t* b, uj_size_t size)
+{
+  static const int w[] = { 75, 15, 0, 5, 0, };
+  gen_mix(b, size, w);
+}
+static void gen_kana(ujbench_buf_t* b, uj_size_t size)
+{
+  static const int w[] = { 10, 45, 35, 5, 0, };
+  gen_mix(b, size, w);
+}
+static void gen_emoji(ujbench_buf_t* b, uj_size_t size)
+{
+  static const int w[] = { 20, 30, 0, 10, 30, };
+  gen_mix(b, size, w);
+}
+
+/* sample mails, repeated up to size. */
+static const char s_mail_ascii[] =
+  "Return-Path: <elena@example.org>\n"
+  "Received: from mx.example.org (mx.example.org [192.0.2.25])\n"
+  "\tby lists.example.com (Postfix) with ESMTP id 4F2A81C03B\n"
+  "\tfor <fml-help@example.com>; Mon, 19 Oct 2009 09:12:44 +0900 (JST)\n"
+  "From: Elena Ortiz <elena@example.org>\n"
+  "To: fml-help@example.com\n"
+  "Subject: [fml-help:01234] Re: digest delivery stops after restart\n"
+  "Date: Mon, 19 Oct 2009 09:12:40 +0900\n"
+  "Message-ID: <20091019001240.GA1234@example.org>\n"
+  "MIME-Version: 1.0\n"
+  "Content-Type: text/plain; charset=us-ascii\n"
+  "\n"
+  "Hi,\n"
+  "\n"
+  "> Could you send the output of \"makefml config elena-ml\"?\n"
+  "\n"
+  "Here it is. The digest has not been sent since the machine was\n"
+  "restarted on Friday, although the articles are still archived and\n"
+  "the sequence file is updated as usual. The log only says that the\n"
+  "digest queue is empty, which does not look right to me.\n"
+  "\n"
+  "Thanks in advance,\n"
+  "-- \n"
+  "Elena\n"
+  "\n";
+
+static const char s_mail_ja[] =
+  "Return-Path: <hanako@example.jp>\n"
+  "Received: from mx.example.jp (mx.example.jp [192.0.2.80])\n"
+  "\tby lists.example.com (Postfix) with ESMTP id 7C09E2D11A\n"
+  "\tfor <fml-support@example.com>; Tue, 20 Oct 2009 18:03:10 +0900 (JST)\n"
+  "From: =?ISO-2022-JP?B?GyRCOzNFRDJWO1IbKEI=?= <hanako@example.jp>\n"
+  "To: fml-support@example.com\n"
+  "Subject: [fml-support:05678] =?ISO-2022-JP?B?GyRCJV4lJCVrJWolOSVIGyhC?=\n"
+  "Date: Tue, 20 Oct 2009 18:03:05 +0900\n"
+  "Message-ID: <200910200903.n9K935xY012345@example.jp>\n"
+  "MIME-Version: 1.0\n"
+  "Content-Type: text/plain; charset=ISO-2022-JP\n"
+  "\n"
+  "山田です。\n"
+  "\n"
+  "先週からメーリングリストの配送が遅くなっています。\n"
+  "ログを見ると、一通ごとに会員リストを最初から読み直している\n"
+  "ようです。会員はおよそ三千人で、サーバーの負荷はそれほど\n"
+  "高くありません。\n"
+  "\n"
+  "設定ファイルは以下の通りです。何か気付いた点があれば\n"
+  "教えていただけると助かります。\n"
+  "\n"
+  "  $default_mail_charset = \"iso-2022-jp\";\n"
+  "  $use_article_digest_function = yes\n"
+  "\n"
+  "よろしくお願いします。\n"
+  "-- \n"
+  "山田 花子\n"
+  "\n";
+
+static void gen_repeat(ujbench_buf_t* b, uj_size_t size, const char* text)
+{
+  uj_size_t len = strlen(text);
+  do
+  {
+    buf_add(b, text, len);
+  }while( b->len+len<=size );
+}
+static void gen_mail_ascii(ujbench_buf_t* b, uj_size_t size) { gen_repeat(b, size, s_mail_ascii); }
+static void gen_mail_ja(ujbench_buf_t* b, uj_size_t size)    { gen_repeat(b, size, s_mail_ja); }
+
+static const struct
+{
+  const char* name;
+  void (*gen)(ujbench_buf_t* b, uj_size_t size);
+} s_gens[] = {
+  { "ascii",      gen_ascii,      },
+  { "kanji",      gen_kanji,      },
+  { "kana",       gen_kana,       },
+  { "emoji",      gen_emoji,      },
+  { "mail_ascii", gen_mail_ascii, },
+  { "mail_ja",    gen_mail_ja,    },
+};
+#define UJBENCH_NR_GENS (sizeof(s_gens)/sizeof(s_gens[0]))
+
+/* the utf8 text is owned by the corpus from now. */
+static int corpus_init(ujbench_corpus_t* c, const char* name, uj_uint8* utf8, uj_size_t len)
+{
+  int i;
+  snprintf(c->name, sizeof(c->name), "%s", name);
+  c->text[UJBENCH_UTF8] = utf8;
+  c->len[UJBENCH_UTF8]  = len;
+  for( i=UJBENCH_UTF8+1; i<UJBENCH_NR_ENCS; ++i )
+  {
+    uj_conv_t in, out;
+    _uj_conv_set_const(&in, NULL, utf8, len);
+    if( s_encs[i].encode(&in, &out)==NULL )
+    {
+      fprintf(stderr, "ujbench: %s: can not make %s\n", name, s_encs[i].name);
+      return -1;
+    }
+    c->text[i] = _uj_conv_own_string(&out);
+    c->len[i]  = out.buf_len;
+  }
+  c->uj = uj_new(utf8, len, ujc_utf8);
+  if( c->uj==NULL )
+  {
+    fprintf(stderr, "uj_new: %s: %s\n", name, strerror(errno));
+    return -1;
+  }
+  return 0;
+}
+
+static int corpus_gen(ujbench_corpus_t* c, int gen, uj_size_t size)
+{
+  ujbench_buf_t b = { NULL, 0, 0 };
+  s_seed = gen+1;
+  s_gens[gen].gen(&b, size);
+  return corpus_init(c, s_gens[gen].name, b.buf, b.len);
+}
+
+/* a file in any encoding, as uj_new guesses it. */
+static int corpus_file(ujbench_corpus_t* c, const char* path)
+{
+  ujbench_buf_t b = { NULL, 0, 0 };
+  char chunk[64*1024];
+  size_t n;
+  unijp_t* uj;
+  uj_uint8* utf8;
+  uj_size_t len;
+  const char* name;
+  FILE* fp = fopen(path, "rb");
+  if( fp==NULL )
+  {
+    fprintf(stderr, "fopen: %s: %s\n", path, strerror(errno));
+    return -1;
+  }
+  while( (n = fread(chunk, 1, sizeof(chunk), fp))!=0 )
+  {
+    buf_add(&b, chunk, n);
+  }
+  fclose(fp);
+
+  uj = uj_new(b.buf, b.len, ujc_auto);
+  free(b.buf);
+  if( uj==NULL )
+  {
+    fprintf(stderr, "uj_new: %s: %s\n", path, strerror(errno));
+    return -1;
+  }
+  utf8 = uj_to_utf8(uj, &len);
+  uj_delete(uj);
+  if( utf8==NULL )
+  {
+    fprintf(stderr, "uj_to_utf8: %s: %s\n", path, strerror(errno));
+    return -1;
+  }
+  name = strrchr(path, '/');
+  return corpus_init(c, name!=NULL ? name+1 : path, utf8, len);
+}
+
+/* ----------------------------------------------------------------------------
+ * running.
+ * ------------------------------------------------------------------------- */
+static double now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec/1e9;
+}
+
+/* kept so the guess is not optimized away. */
+static volatile uj_charcode_t s_code;
+
+/* one call; returns the output length, or -1 on error. */
+static long call_op(const ujbench_corpus_t* c, const ujbench_op_t* op)
+{
+  const uj_uint8* src = c->text[op->input];
+  uj_size_t len = c->len[op->input];
+  uj_conv_t in, out;
+  uj_uint8* p;
+  switch( op->kind )
+  {
+  case UJBENCH_GETCODE:
+    s_code = uj_getcode(src, len);
+    return 0;
+  case UJBENCH_CONV:
+    _uj_conv_set_const(&in, &s_alloc, src, len);
+    if( op->conv(&in, &out)==NULL )
+    {
+      return -1;
+    }
+    len = out.buf_len;
+    _uj_conv_free_buffer(&out);
+    return len;
+  case UJBENCH_TO:
+    p = op->to(c->uj, &len);
+    if( p==NULL )
+    {
+      return -1;
+    }
+    _uj_free(c->uj->alloc, p);
+    return len;
+  }
+  return -1;
+}
+
+static int run_op(const ujbench_corpus_t* c, const ujbench_op_t* op, double min_time)
+{
+  uj_size_t in_len = c->len[op->input];
+  ujbench_count_t count;
+  unsigned long calls;
+  unsigned long long tsc;
+  double start, elapsed;
+  long out_len;
+
+  /* the first call is not timed; it counts the allocations. */
+  memset(&s_count, 0, sizeof(s_count));
+  out_len = call_op(c, op);
+  count = s_count;
+  if( out_len<0 )
+  {
+    fprintf(stderr, "ujbench: %s: %s(%s) failed\n", c->name, op->name, s_encs[op->input].name);
+    return -1;
+  }
+
+  calls = 0;
+  start = now();
+  tsc   = ujbench_tsc();
+  do
+  {
+    call_op(c, op);
+    ++calls;
+    elapsed = now()-start;
+  }while( elapsed<min_time );
+  tsc = ujbench_tsc()-tsc;
+
+  printf("%s\t%s\t%s\t%lu\t", c->name, op->name, s_encs[op->input].name, (unsigned long)in_len);
+  if( op->kind==UJBENCH_GETCODE )
+  {
+    printf("-\t");
+  }else
+  {
+    printf("%ld\t", out_len);
+  }
+  printf("%lu\t%.1f\t", calls, (double)in_len*calls/1e6/elapsed);
+  if( UJBENCH_HAVE_TSC && in_len!=0 )
+  {
+    printf("%.2f\t", (double)tsc/((double)in_len*calls));
+  }else
+  {
+    printf("-\t");
+  }
+  printf("%lu\t%lu\t%lu\n", count.allocs, count.reallocs, count.bytes);
+  fflush(stdout);
+  return 0;
+}
+
+static void print_usage(void)
+{
+  printf("usage: ujbench [options..] [files..]\n");
+  printf("options:\n");
+  printf("-s, --size bytes  size of the made corpora (default %d)\n", UJBENCH_SIZE);
+  printf("-t, --time secs   time to run each op for (default %.1f)\n", UJBENCH_TIME);
+  printf("-c, --corpus name run only the corpora named so\n");
+  printf("-o, --op text     run only the ops whose name contains text\n");
+  printf("-n, --no-gen      do not make the corpora, use the files only\n");
+  printf("-h, --help        show this usage\n");
+  printf("-V, --version     show version information\n");
+  printf("files are added as corpora, in the encoding uj_new guesses.\n");
+  return;
+}
+
+int main(int argc, const char* argv[])
+{
+  uj_size_t size = UJBENCH_SIZE;
+  double min_time = UJBENCH_TIME;
+  const char* only_corpus = NULL;
+  const char* only_op = NULL;
+  int no_gen = 0;
+  ujbench_corpus_t* corpora;
+  int nr_corpora = 0;
+  int i, j;
+  int ret = 0;
+
+  for( i=1; i<argc && argv[i][0]=='-'; ++i )
+  {
+    if( strcmp(argv[i], "-s")==0 || strcmp(argv[i], "--size")==0 )
+    {
+      if( ++i==argc || (size = strtoul(argv[i], NULL, 10))==0 )
+      {
+        fprintf(stderr, "ujbench: --size needs a positive number\n");
+        return 1;
+      }
+    }else if( strcmp(argv[i], "-t")==0 || strcmp(argv[i], "--time")==0 )
+    {
+      if( ++i==argc || (min_time = strtod(argv[i], NULL))<=0 )
+      {
+        fprintf(stderr, "ujbench: --time needs a positive number\n");
+        return 1;
+      }
+    }else if( strcmp(argv[i], "-c")==0 || strcmp(argv[i], "--corpus")==0 )
+    {
+      if( ++i==argc )
+      {
+        fprintf(stderr, "ujbench: --corpus needs a name\n");
+        return 1;
+      }
+      only_corpus = argv[i];
+    }else if( strcmp(argv[i], "-o")==0 || strcmp(argv[i], "--op")==0 )
+    {
+      if( ++i==argc )
+      {
+        fprintf(stderr, "ujbench: --op needs a text\n");
+        return 1;
+      }
+      only_op = argv[i];
+    }else if( strcmp(argv[i], "-n")==0 || strcmp(argv[i], "--no-gen")==0 )
+    {
+      no_gen = 1;
+    }else if( strcmp(argv[i], "-h")==0 || strcmp(argv[i], "--help")==0 )
+    {
+      print_usage();
+      return 0;
+    }else if( strcmp(argv[i], "-V")==0 || strcmp(argv[i], "--version")==0 )
+    {
+      printf("version %s\n", UJBENCH_VERSION);
+      printf("libunijp version %s\n", UNIJP_VERSION_STRING);
+      return 0;
+    }else if( strcmp(argv[i], "--")==0 )
+    {
+      ++i;
+      break;
+    }else
+    {
+      fprintf(stderr, "ujbench: unknown option: %s\n", argv[i]);
+      return 1;
+    }
+  }
+
+  /* every allocation in the library is counted. */
+  _uj_default_alloc = &s_alloc;
+
+  corpora = calloc(UJBENCH_NR_GENS+argc, sizeof(*corpora));
+  if( corpora==NULL )
+  {
+    fprintf(stderr, "calloc: %s\n", strerror(errno));
+    return 1;
+  }
+  make_kanji();
+  for( j=0; !no_gen && j<UJBENCH_NR_GENS; ++j )
+  {
+    if( only_corpus!=NULL && strcmp(only_corpus, s_gens[j].name)!=0 )
+    {
+      continue;
+    }
+    if( corpus_gen(&corpora[nr_corpora], j, size)!=0 )
+    {
+      return 1;
+    }
+    ++nr_corpora;
+  }
+  for( ; i<argc; ++i )
+  {
+    if( corpus_file(&corpora[nr_corpora], argv[i])!=0 )
+    {
+      return 1;
+    }
+    if( only_corpus!=NULL && strcmp(only_corpus, corpora[nr_corpora].name)!=0 )
+    {
+      continue;
+    }
+    ++nr_corpora;
+  }
+
+  printf("# ujbench %s, libunijp %s, size %lu, time %.2f, tsc %s\n",
+    UJBENCH_VERSION, UNIJP_VERSION_STRING, (unsigned long)size, min_time,
+    UJBENCH_HAVE_TSC ? "yes" : "no");
+  printf("#corpus\top\tinput\tin_bytes\tout_bytes\tcalls\tmb_s\tcycles_byte\tallocs\treallocs\talloc_bytes\n");
+  for( i=0; i<nr_corpora; ++i )
+  {
+    for( j=0; j<UJBENCH_NR_OPS; ++j )
+    {
+      if( only_op!=NULL && strstr(s_ops[j].name, only_op)==NULL )
+      {
+        continue;
+      }
+      if( run_op(&corpora[i], &s_ops[j], min_time)!=0 )
+      {
+        ret = 1;
+      }
+    }
+  }
+  return ret;
+}
+
+/* ----------------------------------------------------------------------------
+ * End of File.
+ * ------------------------------------------------------------------------- */
@@ -11,28 +11,105 @@
 #include "unijp.h"
 
 #include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
-#define UJCONV_VERSION "0.01"
+#define UJCONV_VERSION "0.02"
 
+/* stdin is read in chunks of this size. */
+#define UJCONV_READ_SIZE (1024*1024)
+
+/* with output to stdout, workers may run this many files (per worker)
+ * ahead of the file being written. */
+#define UJCONV_WINDOW 4
+
+typedef struct ujconv_opts_s
+{
+  uj_charcode_t icode;
+  uj_charcode_t ocode;
+  int           jobs;
+  int           in_place;
+  const char*   suffix;   /* write to file+suffix (NULL: in place/stdout). */
+} ujconv_opts_t;
+
+typedef struct ujconv_file_s
+{
+  const char* name;
+  uj_uint8*   out;        /* converted text (stdout mode). */
+  uj_size_t   out_len;
+  int         done;
+  int         failed;
+} ujconv_file_t;
+
+typedef struct ujconv_pool_s
+{
+  pthread_mutex_t      lock;
+  pthread_cond_t       cond;
+  const ujconv_opts_t* opts;
+  ujconv_file_t*       files;
+  size_t               nr_files;
+  size_t               next;     /* next file to be taken by a worker. */
+  size_t               written;  /* files written to stdout so far. */
+  int                  to_stdout;
+} ujconv_pool_t;
+
+static int  parse_args(int argc, const char* argv[], ujconv_opts_t* opts, const char*** p_files, size_t* p_nr_files);
+static int  add_file(const char*** p_files, size_t* p_nr_files, size_t* p_size, const char* name);
+static int  add_files_from(const char*** p_files, size_t* p_nr_files, size_t* p_size, const char* list);
+static int  run_pool(const ujconv_opts_t* opts, const char** names, size_t nr_files);
+static void* worker_main(void* arg);
+static int  convert_file(const ujconv_opts_t* opts, ujconv_file_t* file, int to_stdout);
+static uj_uint8* read_stdin(uj_size_t* p_len);
+static uj_uint8* convert_buf(const ujconv_opts_t* opts, const char* name, const uj_uint8* buf, uj_size_t len, uj_size_t* p_len);
+static int  write_atomic(const char* name, const char* suffix, mode_t mode, const uj_uint8* buf, uj_size_t len);
+static int  write_all(int fd, const uj_uint8* buf, uj_size_t len);
 static void print_encodings(void);
 static void print_usage(void);
 static void print_version(void);
 
 int main(int argc, const char* argv[])
 {
-  uj_charcode_t icode;
-  uj_charcode_t ocode;
-  const char* files[10];
+  ujconv_opts_t opts;
+  const char** files;
+  size_t nr_files;
+  int ret;
+
+  ret = parse_args(argc, argv, &opts, &files, &nr_files);
+  if( ret>=0 )
+  {
+    return ret;
+  }
+  ret = run_pool(&opts, files, nr_files);
+  free(files);
+  return ret;
+}
+
+/* ----------------------------------------------------------------------------
+ * parse_args(argc, argv, &opts, &files, &nr_files).
+ *   returns -1 to go on, or the exit status.
+ * ------------------------------------------------------------------------- */
+static int parse_args(int argc, const char* argv[], ujconv_opts_t* opts, const char*** p_files, size_t* p_nr_files)
+{
+  const char** files;
+  size_t nr_files;
+  size_t files_size;
   int end_of_opts;
-  int nr_files;
   int i;
 
-  icode = ujc_auto;
-  ocode = ujc_auto;
-  nr_files = 0;
+  opts->icode    = ujc_auto;
+  opts->ocode    = ujc_auto;
+  opts->jobs     = 0;
+  opts->in_place = 0;
+  opts->suffix   = NULL;
+  files      = NULL;
+  nr_files   = 0;
+  files_size = 0;
   end_of_opts = 0;
   for( i=1; i<argc; ++i )
   {
@@ -46,8 +123,8 @@ int main(int argc, const char* argv[])
           fprintf(stderr, "no argument for %s\n", argv[i-1]);
           return 1;
         }
-        icode = uj_charcode_parse(argv[i]);
-        if( icode==ujc_undefined )
+        opts->icode = uj_charcode_parse(argv[i]);
+        if( opts->icode==ujc_undefined )
         {
           fprintf(stderr, "unknown encoding: %s\n", argv[i]);
           return 1;
@@ -60,12 +137,50 @@ int main(int argc, const char* argv[])
           fprintf(stderr, "no argument for %s\n", argv[i-1]);
           return 1;
         }
-        ocode = uj_charcode_parse(argv[i]);
-        if( ocode==ujc_undefined )
+        opts->ocode = uj_charcode_parse(argv[i]);
+        if( opts->ocode==ujc_undefined )
         {
           fprintf(stderr, "unknown encoding: %s\n", argv[i]);
           return 1;
         }
+      }else if( strcmp(argv[i], "-j")==0 || strcmp(argv[i], "--jobs")==0 )
+      {
+        ++i;
+        if( i==argc )
+        {
+          fprintf(stderr, "no argument for %s\n", argv[i-1]);
+          return 1;
+        }
+        opts->jobs = atoi(argv[i]);
+        if( opts->jobs<=0 )
+        {
+          fprintf(stderr, "invalid number of jobs: %s\n", argv[i]);
+          return 1;
+        }
+      }else if( strcmp(argv[i], "-i")==0 || strcmp(argv[i], "--in-place")==0 )
+      {
+        opts->in_place = 1;
+      }else if( strcmp(argv[i], "-s")==0 || strcmp(argv[i], "--suffix")==0 )
+      {
+        ++i;
+        if( i==argc )
+        {
+          fprintf(stderr, "no argument for %s\n", argv[i-1]);
+          return 1;
+        }
+        opts->suffix = argv[i];
+      }else if( strcmp(argv[i], "-F")==0 || strcmp(argv[i], "--files-from")==0 )
+      {
+        ++i;
+        if( i==argc )
+        {
+          fprintf(stderr, "no argument for %s\n", argv[i-1]);
+          return 1;
+        }
+        if( add_files_from(&files, &nr_files, &files_size, argv[i])!=0 )
+        {
+          return 1;
+        }
       }else if( strcmp(argv[i], "-l")==0 || strcmp(argv[i], "--list")==0 )
       {
         print_encodings();
@@ -88,93 +203,455 @@ int main(int argc, const char* argv[])
       }
     }else
     {
-      if( nr_files==10 )
+      if( add_file(&files, &nr_files, &files_size, argv[i])!=0 )
       {
-        fprintf(stderr, "too many files\n");
         return 1;
       }
-      files[nr_files++] = argv[i];
     }
   }
-  if( nr_files==0 )
+  if( nr_files==0 && add_file(&files, &nr_files, &files_size, "-")!=0 )
   {
-    files[nr_files++] = "-";
+    return 1;
   }
 
-  if( ocode==ujc_auto )
+  if( opts->ocode==ujc_auto )
   {
-    ocode = ujc_utf8;
+    opts->ocode = ujc_utf8;
   }
+  if( opts->in_place && opts->suffix!=NULL )
+  {
+    fprintf(stderr, "--in-place and --suffix are exclusive\n");
+    return 1;
+  }
+  if( opts->in_place || opts->suffix!=NULL )
+  {
+    size_t n;
+    for( n=0; n<nr_files; ++n )
+    {
+      if( strcmp(files[n], "-")==0 )
+      {
+        fprintf(stderr, "stdin can not be written back\n");
+        return 1;
+      }
+    }
+  }
+  if( opts->jobs==0 )
+  {
+    long nr_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    opts->jobs = nr_cpus>0 ? (int)nr_cpus : 1;
+  }
+  if( (size_t)opts->jobs>nr_files )
+  {
+    opts->jobs = (int)nr_files;
+  }
+
+  *p_files    = files;
+  *p_nr_files = nr_files;
+  return -1;
+}
+
+static int add_file(const char*** p_files, size_t* p_nr_files, size_t* p_size, const char* name)
+{
+  if( *p_nr_files==*p_size )
+  {
+    size_t new_size = *p_size ? *p_size*2 : 64;
+    const char** files = realloc(*p_files, new_size*sizeof(*files));
+    if( files==NULL )
+    {
+      fprintf(stderr, "realloc: %s\n", strerror(errno));
+      return -1;
+    }
+    *p_files = files;
+    *p_size  = new_size;
+  }
+  (*p_files)[(*p_nr_files)++] = name;
+  return 0;
+}
+
+/* reads file names, one per line, from list ("-" for stdin).
+ * the names are kept until exit. */
+static int add_files_from(const char*** p_files, size_t* p_nr_files, size_t* p_size, const char* list)
+{
+  FILE* fp;
+  char* line;
+  size_t line_size;
+  ssize_t len;
+
+  fp = strcmp(list, "-")==0 ? stdin : fopen(list, "r");
+  if( fp==NULL )
+  {
+    fprintf(stderr, "fopen: %s: %s\n", list, strerror(errno));
+    return -1;
+  }
+  line = NULL;
+  line_size = 0;
+  while( (len = getline(&line, &line_size, fp))>0 )
+  {
+    char* name;
+    if( line[len-1]=='\n' )
+    {
+      line[--len] = '\0';
+    }
+    if( len==0 )
+    {
+      continue;
+    }
+    name = strdup(line);
+    if( name==NULL || add_file(p_files, p_nr_files, p_size, name)!=0 )
+    {
+      fprintf(stderr, "%s: %s\n", list, strerror(errno));
+      free(line);
+      return -1;
+    }
+  }
+  free(line);
+  if( ferror(fp) )
+  {
+    fprintf(stderr, "getline: %s: %s\n", list, strerror(errno));
+    return -1;
+  }
+  if( fp!=stdin )
+  {
+    fclose(fp);
+  }
+  return 0;
+}
 
+/* ----------------------------------------------------------------------------
+ * run_pool(opts, names, nr_files).
+ *   converts the files on opts->jobs workers.  with output to stdout, the
+ *   main thread writes the results in the order of the arguments.
+ *   returns the exit status.
+ * ------------------------------------------------------------------------- */
+static int run_pool(const ujconv_opts_t* opts, const char** names, size_t nr_files)
+{
+  ujconv_pool_t pool;
+  pthread_t* threads;
+  int nr_threads;
+  int failed;
+  size_t n;
 
+  pool.opts      = opts;
+  pool.nr_files  = nr_files;
+  pool.next      = 0;
+  pool.written   = 0;
+  pool.to_stdout = !opts->in_place && opts->suffix==NULL;
+  pool.files     = calloc(nr_files, sizeof(*pool.files));
+  threads        = calloc(opts->jobs, sizeof(*threads));
+  if( pool.files==NULL || threads==NULL )
+  {
+    fprintf(stderr, "calloc: %s\n", strerror(errno));
+    return 1;
+  }
+  for( n=0; n<nr_files; ++n )
   {
-    char* buf;
-    int buf_size;
-    int buf_len;
+    pool.files[n].name = names[n];
+  }
+  pthread_mutex_init(&pool.lock, NULL);
+  pthread_cond_init(&pool.cond, NULL);
 
-    buf_len = 0;
-    buf_size = 1024;
-    buf = malloc(buf_size);
-    if( buf==NULL )
+  for( nr_threads=0; nr_threads<opts->jobs; ++nr_threads )
+  {
+    int err = pthread_create(&threads[nr_threads], NULL, worker_main, &pool);
+    if( err!=0 )
     {
-      fprintf(stderr, "malloc: %s\n", strerror(errno));
-      return 1;
+      fprintf(stderr, "pthread_create: %s\n", strerror(err));
+      break;
     }
+  }
+  if( nr_threads==0 )
+  {
+    return 1;
+  }
 
-    for( i=0; i<nr_files; ++i )
+  failed = 0;
+  if( pool.to_stdout )
+  {
+    pthread_mutex_lock(&pool.lock);
+    for( ; pool.written<nr_files; ++pool.written )
     {
-      FILE* fp;
-      int use_stdin = strcmp(files[i], "-")==0;
-      if( use_stdin )
+      ujconv_file_t* file = &pool.files[pool.written];
+      while( !file->done )
       {
-        fp = stdin;
-      }else
+        pthread_cond_wait(&pool.cond, &pool.lock);
+      }
+      pthread_mutex_unlock(&pool.lock);
+      if( !file->failed && write_all(STDOUT_FILENO, file->out, file->out_len)!=0 )
       {
-        fp = fopen(files[i], "r");
-        if( fp==NULL )
-        {
-          fprintf(stderr, "fopen: %s: %s\n", files[i], strerror(errno));
-          return 1;
-        }
+        fprintf(stderr, "write: %s: %s\n", file->name, strerror(errno));
+        file->failed = 1;
       }
-      while( fgets(buf, 1023, fp)!=NULL )
+      free(file->out);
+      file->out = NULL;
+      pthread_mutex_lock(&pool.lock);
+      pthread_cond_broadcast(&pool.cond);
+    }
+    pthread_mutex_unlock(&pool.lock);
+  }
+
+  for( n=0; n<(size_t)nr_threads; ++n )
+  {
+    pthread_join(threads[n], NULL);
+  }
+  for( n=0; n<nr_files; ++n )
+  {
+    failed |= pool.files[n].failed;
+  }
+  pthread_cond_destroy(&pool.cond);
+  pthread_mutex_destroy(&pool.lock);
+  free(threads);
+  free(pool.files);
+  return failed ? 1 : 0;
+}
+
+static void* worker_main(void* arg)
+{
+  ujconv_pool_t* pool = arg;
+  const size_t window = (size_t)pool->opts->jobs * UJCONV_WINDOW;
+
+  pthread_mutex_lock(&pool->lock);
+  while( pool->next<pool->nr_files )
+  {
+    ujconv_file_t* file;
+    if( pool->to_stdout && pool->next>=pool->written+window )
+    { /* let the writer catch up. */
+      pthread_cond_wait(&pool->cond, &pool->lock);
+      continue;
+    }
+    file = &pool->files[pool->next++];
+    pthread_mutex_unlock(&pool->lock);
+
+    file->failed = convert_file(pool->opts, file, pool->to_stdout)!=0;
+
+    pthread_mutex_lock(&pool->lock);
+    file->done = 1;
+    pthread_cond_broadcast(&pool->cond);
+  }
+  pthread_mutex_unlock(&pool->lock);
+  return NULL;
+}
+
+/* ----------------------------------------------------------------------------
+ * convert_file(opts, file, to_stdout).
+ *   maps the file (stdin is read), converts the whole text at once and
+ *   keeps the result in file->out or writes it back next to the input.
+ * ------------------------------------------------------------------------- */
+static int convert_file(const ujconv_opts_t* opts, ujconv_file_t* file, int to_stdout)
+{
+  const uj_uint8* buf;
+  uj_size_t len;
+  uj_uint8* out;
+  uj_size_t out_len;
+  void* map;
+  struct stat st;
+  int ret;
+
+  map = NULL;
+  st.st_mode = 0644;
+  if( strcmp(file->name, "-")==0 )
+  {
+    uj_uint8* in = read_stdin(&len);
+    if( in==NULL )
+    {
+      fprintf(stderr, "read: -: %s\n", strerror(errno));
+      return -1;
+    }
+    out = convert_buf(opts, file->name, in, len, &out_len);
+    free(in);
+  }else
+  {
+    int fd = open(file->name, O_RDONLY);
+    if( fd<0 )
+    {
+      fprintf(stderr, "open: %s: %s\n", file->name, strerror(errno));
+      return -1;
+    }
+    if( fstat(fd, &st)!=0 )
+    {
+      fprintf(stderr, "fstat: %s: %s\n", file->name, strerror(errno));
+      close(fd);
+      return -1;
+    }
+    len = st.st_size;
+    buf = (const uj_uint8*)"";
+    if( len!=0 )
+    {
+      map = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, 0);
+      if( map==MAP_FAILED )
       {
-        size_t rlen;
-        size_t wlen;
-        unijp_t* uj;
-        uj_uint8* obuf;
-        uj_size_t obuf_len;
+        fprintf(stderr, "mmap: %s: %s\n", file->name, strerror(errno));
+        close(fd);
+        return -1;
+      }
+      madvise(map, len, MADV_SEQUENTIAL);
+      buf = map;
+    }
+    close(fd);
+    out = convert_buf(opts, file->name, buf, len, &out_len);
+    if( map!=NULL )
+    {
+      munmap(map, len);
+    }
+  }
+  if( out==NULL )
+  {
+    return -1;
+  }
 
-        rlen = strlen(buf);
-        uj = uj_new((uj_uint8*)buf, rlen, icode);
-        if( uj==NULL )
-        {
-          fprintf(stderr, "uj_new: %s: %s\n", files[i], strerror(errno));
-          return 1;
-        }
-        obuf = uj_conv(uj, ocode, &obuf_len);
-        if( obuf==NULL )
-        {
-          fprintf(stderr, "uj_conv: %s: %s\n", files[i], strerror(errno));
-          return 1;
-        }
-        wlen = fwrite(obuf, 1, obuf_len,  stdout);
-        if( wlen!=obuf_len )
-        {
-          fprintf(stderr, "fwrite: %s: %s\n", files[i], strerror(errno));
-          return 1;
-        }
-        free(obuf);
-        uj_delete(uj);
+  if( to_stdout )
+  {
+    file->out     = out;
+    file->out_len = out_len;
+    return 0;
+  }
+  ret = write_atomic(file->name, opts->suffix, st.st_mode & 07777, out, out_len);
+  free(out);
+  return ret;
+}
+
+static uj_uint8* read_stdin(uj_size_t* p_len)
+{
+  uj_uint8* buf;
+  uj_size_t len;
+  uj_size_t size;
+
+  len  = 0;
+  size = UJCONV_READ_SIZE;
+  buf  = malloc(size);
+  while( buf!=NULL )
+  {
+    ssize_t rlen;
+    if( len==size )
+    {
+      uj_uint8* new_buf = realloc(buf, size*2);
+      if( new_buf==NULL )
+      {
+        break;
       }
-      if( ferror(fp) )
+      buf   = new_buf;
+      size *= 2;
+    }
+    rlen = read(STDIN_FILENO, buf+len, size-len);
+    if( rlen<0 && errno==EINTR )
+    {
+      continue;
+    }
+    if( rlen<0 )
+    {
+      break;
+    }
+    if( rlen==0 )
+    {
+      *p_len = len;
+      return buf;
+    }
+    len += rlen;
+  }
+  free(buf);
+  return NULL;
+}
+
+static uj_uint8* convert_buf(const ujconv_opts_t* opts, const char* name, const uj_uint8* buf, uj_size_t len, uj_size_t* p_len)
+{
+  unijp_t* uj;
+  uj_uint8* out;
+
+  uj = uj_new(buf, len, opts->icode);
+  if( uj==NULL )
+  {
+    fprintf(stderr, "uj_new: %s: %s\n", name, strerror(errno));
+    return NULL;
+  }
+  /* the utf8 text is not needed after, so sjis/eucjp reuse its buffer. */
+  out = uj_conv_inplace(uj, opts->ocode, p_len);
+  if( out==NULL )
+  {
+    fprintf(stderr, "uj_conv_inplace: %s: %s\n", name, strerror(errno));
+  }
+  uj_delete(uj);
+  return out;
+}
+
+/* ----------------------------------------------------------------------------
+ * write_atomic(name, suffix, mode, buf, len).
+ *   writes to a temporary file in the same directory, fsync()s it and
+ *   renames it to name+suffix (or name), so readers see either the old
+ *   or the new text.
+ * ------------------------------------------------------------------------- */
+static int write_atomic(const char* name, const char* suffix, mode_t mode, const uj_uint8* buf, uj_size_t len)
+{
+  static const char tmpl[] = ".ujconv.XXXXXX";
+  const size_t name_len   = strlen(name);
+  const size_t suffix_len = suffix!=NULL ? strlen(suffix) : 0;
+  char* target;
+  char* tmp;
+  int fd;
+
+  target = malloc(name_len+suffix_len+1);
+  tmp    = malloc(name_len+suffix_len+sizeof(tmpl));
+  if( target==NULL || tmp==NULL )
+  {
+    fprintf(stderr, "malloc: %s: %s\n", name, strerror(errno));
+    free(target);
+    free(tmp);
+    return -1;
+  }
+  memcpy(target, name, name_len);
+  if( suffix_len>0 )
+  {
+    memcpy(target+name_len, suffix, suffix_len);
+  }
+  target[name_len+suffix_len] = '\0';
+  memcpy(tmp, target, name_len+suffix_len);
+  memcpy(tmp+name_len+suffix_len, tmpl, sizeof(tmpl));
+
+  fd = mkstemp(tmp);
+  if( fd<0 )
+  {
+    fprintf(stderr, "mkstemp: %s: %s\n", tmp, strerror(errno));
+    free(target);
+    free(tmp);
+    return -1;
+  }
+  /* flush the data before rename(2) publishes it, or a crash can
+   * leave an empty file in place of the old one. */
+  if( write_all(fd, buf, len)!=0 || fchmod(fd, mode)!=0 || fsync(fd)!=0 )
+  {
+    fprintf(stderr, "write: %s: %s\n", tmp, strerror(errno));
+    close(fd);
+    unlink(tmp);
+    free(target);
+    free(tmp);
+    return -1;
+  }
+  if( close(fd)!=0 || rename(tmp, target)!=0 )
+  {
+    fprintf(stderr, "rename: %s: %s\n", target, strerror(errno));
+    unlink(tmp);
+    free(target);
+    free(tmp);
+    return -1;
+  }
+  free(target);
+  free(tmp);
+  return 0;
+}
+
+static int write_all(int fd, const uj_uint8* buf, uj_size_t len)
+{
+  while( len>0 )
+  {
+    ssize_t wlen = write(fd, buf, len);
+    if( wlen<0 )
+    {
+      if( errno==EINTR )
       {
-        fprintf(stderr, "fread: %s: %s\n", files[i], strerror(errno));
-        return 1;
+        continue;
       }
-      fclose(fp);
+      return -1;
     }
-    free(buf);
+    buf += wlen;
+    len -= wlen;
   }
   return 0;
 }
@@ -195,6 +672,11 @@ static void print_usage(void)
   printf("options:\n");
   printf("-f, --from     icode\n");
   printf("-t, --to       ocode\n");
+  printf("-j, --jobs     number of files converted at once (default: cpus)\n");
+  printf("-i, --in-place replace each file with the converted text\n");
+  printf("-s, --suffix   write each file to file+suffix\n");
+  printf("-F, --files-from list\n");
+  printf("               read file names from list, one per line (- for stdin)\n");
   printf("-l, --list     list available encodings\n");
   printf("-h, --help     show this usage\n");
   printf("-V, --version  show version information\n");
@@ -10,44 +10,139 @@
 
 #include "unijp.h"
 
+#include <dirent.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
-#define UJGUESS_VERSION "0.01"
+#define UJGUESS_VERSION "0.02"
+
+/* stdin is read in chunks of this size. */
+#define UJGUESS_READ_SIZE (1024*1024)
+
+/* file names queued between the walker and the workers. */
+#define UJGUESS_QUEUE 4096
+
+/* histogram slots: every uj_charcode_t, and one for unreadable files.
+ * without --mail the body is always counted as ujc_auto. */
+#define UJGUESS_ERROR    (ujc_undefined+1)
+#define UJGUESS_NR_CODES (ujc_undefined+2)
+
+typedef struct ujguess_opts_s
+{
+  int         jobs;
+  int         recursive;
+  int         mail;          /* guess the header and the body separately. */
+  int         histogram;     /* print the histogram instead of each file. */
+  int         show_filename;
+  const char* report_path;   /* tab separated per-file report (NULL: none). */
+} ujguess_opts_t;
+
+typedef unsigned long ujguess_hist_t[UJGUESS_NR_CODES][UJGUESS_NR_CODES];
+
+typedef struct ujguess_pool_s
+{
+  pthread_mutex_t       lock;
+  pthread_cond_t        not_empty;
+  pthread_cond_t        not_full;
+  char*                 queue[UJGUESS_QUEUE];
+  size_t                head;
+  size_t                count;
+  int                   closed;
+  const ujguess_opts_t* opts;
+  FILE*                 report;
+  ujguess_hist_t        hist;
+  int                   failed;
+} ujguess_pool_t;
+
+typedef struct ujguess_row_s
+{
+  unsigned long count;
+  int           header;
+  int           body;
+} ujguess_row_t;
+
+static void  pool_push(ujguess_pool_t* pool, char* name);
+static char* pool_pop(ujguess_pool_t* pool);
+static int   walk(ujguess_pool_t* pool, const char* path);
+static void* worker_main(void* arg);
+static void  guess_file(ujguess_pool_t* pool, const char* name, ujguess_hist_t hist);
+static uj_uint8* read_stdin(uj_size_t* p_len);
+static uj_size_t header_length(const uj_uint8* buf, uj_size_t len, uj_size_t* p_body);
+static const char* code_str(int code);
+static void  print_histogram(const ujguess_opts_t* opts, ujguess_hist_t hist);
+static int   cmp_row(const void* a, const void* b);
+static void  print_usage(void);
 
 int main(int argc, const char* argv[])
 {
-  const char* files[10];
+  ujguess_opts_t opts;
+  ujguess_pool_t* pool;
+  pthread_t* threads;
   int end_of_opts;
   int nr_files;
   int no_filename;
-  int show_filename;
+  int nr_threads;
+  int failed;
   int i;
 
+  memset(&opts, 0, sizeof(opts));
   nr_files      = 0;
   end_of_opts   = 0;
   no_filename   = 0;
-  show_filename = 0;
   for( i=1; i<argc; ++i )
   {
     if( argv[i][0]=='-' && argv[i][1]!='\0' && !end_of_opts )
     {
       if( strcmp(argv[i], "--no-filename")==0 )
       {
-        no_filename   = 1;
-        show_filename = 0;
+        no_filename        = 1;
+        opts.show_filename = 0;
       }else if( strcmp(argv[i], "--show-filename")==0 )
       {
-        no_filename   = 0;
-        show_filename = 1;
+        no_filename        = 0;
+        opts.show_filename = 1;
+      }else if( strcmp(argv[i], "-r")==0 || strcmp(argv[i], "--recursive")==0 )
+      {
+        opts.recursive = 1;
+      }else if( strcmp(argv[i], "-m")==0 || strcmp(argv[i], "--mail")==0 )
+      {
+        opts.mail = 1;
+      }else if( strcmp(argv[i], "-H")==0 || strcmp(argv[i], "--histogram")==0 )
+      {
+        opts.histogram = 1;
+      }else if( strcmp(argv[i], "-j")==0 || strcmp(argv[i], "--jobs")==0 )
+      {
+        ++i;
+        if( i==argc )
+        {
+          fprintf(stderr, "no argument for %s\n", argv[i-1]);
+          return 1;
+        }
+        opts.jobs = atoi(argv[i]);
+        if( opts.jobs<=0 )
+        {
+          fprintf(stderr, "invalid number of jobs: %s\n", argv[i]);
+          return 1;
+        }
+      }else if( strcmp(argv[i], "-R")==0 || strcmp(argv[i], "--report")==0 )
+      {
+        ++i;
+        if( i==argc )
+        {
+          fprintf(stderr, "no argument for %s\n", argv[i-1]);
+          return 1;
+        }
+        opts.report_path = argv[i];
       }else if( strcmp(argv[i], "-h")==0 || strcmp(argv[i], "--help")==0 )
       {
-        printf("usage: ujguess [options..] [files..]\n");
-        printf("options:\n");
-        printf("-h, --help     show this usage\n");
-        printf("-V, --version  show version information\n");
+        print_usage();
         return 0;
       }else if( strcmp(argv[i], "-V")==0 || strcmp(argv[i], "--version")==0 )
       {
@@ -64,95 +159,524 @@ int main(int argc, const char* argv[])
       }
     }else
     {
-      if( nr_files==10 )
-      {
-        fprintf(stderr, "too many files\n");
-        return 1;
-      }
-      files[nr_files++] = argv[i];
+      ++nr_files;
     }
   }
-  if( !no_filename && !show_filename )
+  if( !no_filename && !opts.show_filename )
+  {
+    opts.show_filename = nr_files>=2 || opts.recursive;
+  }
+  if( opts.jobs==0 )
+  {
+    long nr_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    opts.jobs = nr_cpus>0 ? (int)nr_cpus : 1;
+  }
+
+  pool    = calloc(1, sizeof(*pool));
+  threads = calloc(opts.jobs, sizeof(*threads));
+  if( pool==NULL || threads==NULL )
+  {
+    fprintf(stderr, "calloc: %s\n", strerror(errno));
+    return 1;
+  }
+  pool->opts = &opts;
+  if( opts.report_path!=NULL )
   {
-    if( nr_files >= 2 )
+    pool->report = strcmp(opts.report_path, "-")==0 ? stdout : fopen(opts.report_path, "w");
+    if( pool->report==NULL )
     {
-      show_filename = 1;
-    }else
+      fprintf(stderr, "fopen: %s: %s\n", opts.report_path, strerror(errno));
+      return 1;
+    }
+  }
+  pthread_mutex_init(&pool->lock, NULL);
+  pthread_cond_init(&pool->not_empty, NULL);
+  pthread_cond_init(&pool->not_full, NULL);
+
+  for( nr_threads=0; nr_threads<opts.jobs; ++nr_threads )
+  {
+    int err = pthread_create(&threads[nr_threads], NULL, worker_main, pool);
+    if( err!=0 )
     {
-      no_filename   = 1;
+      fprintf(stderr, "pthread_create: %s\n", strerror(err));
+      break;
+    }
+  }
+  if( nr_threads==0 )
+  {
+    return 1;
+  }
+
+  /* the main thread feeds the workers. */
+  failed = 0;
+  end_of_opts = 0;
+  for( i=1; i<argc; ++i )
+  {
+    if( argv[i][0]=='-' && argv[i][1]!='\0' && !end_of_opts )
+    {
+      if( strcmp(argv[i], "--")==0 )
+      {
+        end_of_opts = 1;
+      }else if( strcmp(argv[i], "-j")==0 || strcmp(argv[i], "--jobs")==0
+             || strcmp(argv[i], "-R")==0 || strcmp(argv[i], "--report")==0 )
+      {
+        ++i;
+      }
+      continue;
     }
+    failed |= walk(pool, argv[i]);
   }
   if( nr_files==0 )
   {
-    files[nr_files++] = "-";
+    pool_push(pool, strdup("-"));
   }
 
+  pthread_mutex_lock(&pool->lock);
+  pool->closed = 1;
+  pthread_cond_broadcast(&pool->not_empty);
+  pthread_mutex_unlock(&pool->lock);
+  for( i=0; i<nr_threads; ++i )
+  {
+    pthread_join(threads[i], NULL);
+  }
+  failed |= pool->failed;
+
+  if( opts.histogram )
+  {
+    print_histogram(&opts, pool->hist);
+  }
+  if( pool->report!=NULL && pool->report!=stdout && fclose(pool->report)!=0 )
+  {
+    fprintf(stderr, "fclose: %s: %s\n", opts.report_path, strerror(errno));
+    failed = 1;
+  }
+  pthread_cond_destroy(&pool->not_full);
+  pthread_cond_destroy(&pool->not_empty);
+  pthread_mutex_destroy(&pool->lock);
+  free(threads);
+  free(pool);
+  return failed ? 1 : 0;
+}
 
+/* ----------------------------------------------------------------------------
+ * queue of file names, from the walker to the workers.
+ * ------------------------------------------------------------------------- */
+static void pool_push(ujguess_pool_t* pool, char* name)
+{
+  if( name==NULL )
   {
-    char* buf;
-    size_t buf_size;
-    size_t buf_len;
+    fprintf(stderr, "strdup: %s\n", strerror(errno));
+    pthread_mutex_lock(&pool->lock);
+    pool->failed = 1;
+    pthread_mutex_unlock(&pool->lock);
+    return;
+  }
+  pthread_mutex_lock(&pool->lock);
+  while( pool->count==UJGUESS_QUEUE )
+  {
+    pthread_cond_wait(&pool->not_full, &pool->lock);
+  }
+  pool->queue[(pool->head+pool->count)%UJGUESS_QUEUE] = name;
+  ++pool->count;
+  pthread_cond_signal(&pool->not_empty);
+  pthread_mutex_unlock(&pool->lock);
+}
+
+/* returns NULL when the queue is closed and empty. */
+static char* pool_pop(ujguess_pool_t* pool)
+{
+  char* name;
+  pthread_mutex_lock(&pool->lock);
+  while( pool->count==0 && !pool->closed )
+  {
+    pthread_cond_wait(&pool->not_empty, &pool->lock);
+  }
+  name = NULL;
+  if( pool->count!=0 )
+  {
+    name = pool->queue[pool->head];
+    pool->head = (pool->head+1)%UJGUESS_QUEUE;
+    --pool->count;
+    pthread_cond_signal(&pool->not_full);
+  }
+  pthread_mutex_unlock(&pool->lock);
+  return name;
+}
+
+/* ----------------------------------------------------------------------------
+ * walk(pool, path).
+ *   queues path, or with --recursive the files under it.  symbolic links
+ *   to directories are not followed.
+ * ------------------------------------------------------------------------- */
+static int walk(ujguess_pool_t* pool, const char* path)
+{
+  DIR* dir;
+  struct dirent* ent;
+  struct stat st;
+  size_t path_len;
+  int failed;
+
+  if( !pool->opts->recursive || strcmp(path, "-")==0
+      || stat(path, &st)!=0 || !S_ISDIR(st.st_mode) )
+  { /* errors are reported by the worker. */
+    pool_push(pool, strdup(path));
+    return 0;
+  }
 
-    buf_len = 0;
-    buf_size = 1024;
-    buf = malloc(buf_size);
-    if( buf==NULL )
+  dir = opendir(path);
+  if( dir==NULL )
+  {
+    fprintf(stderr, "opendir: %s: %s\n", path, strerror(errno));
+    return 1;
+  }
+  path_len = strlen(path);
+  while( path_len>1 && path[path_len-1]=='/' )
+  {
+    --path_len;
+  }
+  failed = 0;
+  while( (ent = readdir(dir))!=NULL )
+  {
+    size_t name_len = strlen(ent->d_name);
+    char* child;
+    int is_dir;
+    if( strcmp(ent->d_name, ".")==0 || strcmp(ent->d_name, "..")==0 )
+    {
+      continue;
+    }
+    child = malloc(path_len+1+name_len+1);
+    if( child==NULL )
     {
       fprintf(stderr, "malloc: %s\n", strerror(errno));
-      return 1;
+      failed = 1;
+      break;
     }
+    memcpy(child, path, path_len);
+    child[path_len] = '/';
+    memcpy(child+path_len+1, ent->d_name, name_len+1);
 
-    for( i=0; i<nr_files; ++i )
+#ifdef _DIRENT_HAVE_D_TYPE
+    if( ent->d_type!=DT_UNKNOWN )
     {
-      FILE* fp;
-      uj_charcode_t code;
-      int use_stdin = strcmp(files[i], "-")==0;
-      if( use_stdin )
-      {
-        fp = stdin;
-      }else
-      {
-        fp = fopen(files[i], "r");
-        if( fp==NULL )
-        {
-          fprintf(stderr, "fopen: %s: %s\n", files[i], strerror(errno));
-          return 1;
-        }
-      }
+      is_dir = ent->d_type==DT_DIR;
+    }else
+#endif
+    {
+      is_dir = lstat(child, &st)==0 && S_ISDIR(st.st_mode);
+    }
+    if( is_dir )
+    {
+      failed |= walk(pool, child);
+      free(child);
+    }else
+    {
+      pool_push(pool, child);
+    }
+  }
+  closedir(dir);
+  return failed;
+}
+
+static void* worker_main(void* arg)
+{
+  ujguess_pool_t* pool = arg;
+  ujguess_hist_t* hist;
+  char* name;
+  int i, j;
 
-      buf_len = 0;
-      while( fgets(buf+buf_len, 1023, fp)!=NULL )
+  hist = calloc(1, sizeof(*hist));
+  if( hist==NULL )
+  {
+    fprintf(stderr, "calloc: %s\n", strerror(errno));
+    pthread_mutex_lock(&pool->lock);
+    pool->failed = 1;
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+  }
+  while( (name = pool_pop(pool))!=NULL )
+  {
+    guess_file(pool, name, *hist);
+    free(name);
+  }
+
+  pthread_mutex_lock(&pool->lock);
+  for( i=0; i<UJGUESS_NR_CODES; ++i )
+  {
+    for( j=0; j<UJGUESS_NR_CODES; ++j )
+    {
+      pool->hist[i][j] += (*hist)[i][j];
+    }
+  }
+  if( (*hist)[UJGUESS_ERROR][ujc_auto]!=0 )
+  {
+    pool->failed = 1;
+  }
+  pthread_mutex_unlock(&pool->lock);
+  free(hist);
+  return NULL;
+}
+
+/* ----------------------------------------------------------------------------
+ * guess_file(pool, name, hist).
+ *   maps the file (stdin is read), guesses it and counts it in hist.
+ * ------------------------------------------------------------------------- */
+static void guess_file(ujguess_pool_t* pool, const char* name, ujguess_hist_t hist)
+{
+  const ujguess_opts_t* opts = pool->opts;
+  const uj_uint8* buf;
+  uj_uint8* in;
+  uj_size_t len;
+  void* map;
+  int header;
+  int body;
+
+  in  = NULL;
+  map = NULL;
+  buf = (const uj_uint8*)"";
+  len = 0;
+  if( strcmp(name, "-")==0 )
+  {
+    in = read_stdin(&len);
+    if( in==NULL )
+    {
+      fprintf(stderr, "read: -: %s\n", strerror(errno));
+      goto error;
+    }
+    buf = in;
+  }else
+  {
+    struct stat st;
+    int fd = open(name, O_RDONLY);
+    if( fd<0 )
+    {
+      fprintf(stderr, "open: %s: %s\n", name, strerror(errno));
+      goto error;
+    }
+    if( fstat(fd, &st)!=0 )
+    {
+      fprintf(stderr, "fstat: %s: %s\n", name, strerror(errno));
+      close(fd);
+      goto error;
+    }
+    if( S_ISDIR(st.st_mode) )
+    {
+      fprintf(stderr, "%s: %s\n", name, strerror(EISDIR));
+      close(fd);
+      goto error;
+    }
+    len = st.st_size;
+    if( len!=0 )
+    {
+      map = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, 0);
+      if( map==MAP_FAILED )
       {
-        char* new_buf;
-        size_t rlen;
-        rlen = strlen(buf+buf_len);
-        buf_len += rlen;
-        buf_size += 1024;
-        new_buf = realloc(buf, buf_size);
-        if( new_buf==0 )
-        {
-          fprintf(stderr, "realloc: %s: %s\n", files[i], strerror(errno));
-          return 1;
-        }
-        buf = new_buf;
+        fprintf(stderr, "mmap: %s: %s\n", name, strerror(errno));
+        close(fd);
+        goto error;
       }
-      if( ferror(fp) )
+      buf = map;
+    }
+    close(fd);
+  }
+
+  if( opts->mail )
+  {
+    uj_size_t body_pos;
+    uj_size_t header_len = header_length(buf, len, &body_pos);
+    header = uj_getcode(buf, header_len);
+    body   = uj_getcode(buf+body_pos, len-body_pos);
+  }else
+  {
+    header = uj_getcode(buf, len);
+    body   = ujc_auto;
+  }
+  if( map!=NULL )
+  {
+    munmap(map, len);
+  }
+  free(in);
+
+  ++hist[header][body];
+  if( !opts->histogram )
+  {
+    if( opts->mail )
+    {
+      printf("%s%s%s,%s\n", opts->show_filename ? name : "", opts->show_filename ? ":" : "", code_str(header), code_str(body));
+    }else
+    {
+      printf("%s%s%s\n", opts->show_filename ? name : "", opts->show_filename ? ":" : "", code_str(header));
+    }
+  }
+  if( pool->report!=NULL )
+  {
+    if( opts->mail )
+    {
+      fprintf(pool->report, "%s\t%lu\t%s\t%s\n", name, (unsigned long)len, code_str(header), code_str(body));
+    }else
+    {
+      fprintf(pool->report, "%s\t%lu\t%s\n", name, (unsigned long)len, code_str(header));
+    }
+  }
+  return;
+
+error:
+  ++hist[UJGUESS_ERROR][ujc_auto];
+  if( pool->report!=NULL )
+  {
+    fprintf(pool->report, opts->mail ? "%s\t-\terror\terror\n" : "%s\t-\terror\n", name);
+  }
+  return;
+}
+
+static uj_uint8* read_stdin(uj_size_t* p_len)
+{
+  uj_uint8* buf;
+  uj_size_t len;
+  uj_size_t size;
+
+  len  = 0;
+  size = UJGUESS_READ_SIZE;
+  buf  = malloc(size);
+  while( buf!=NULL )
+  {
+    ssize_t rlen;
+    if( len==size )
+    {
+      uj_uint8* new_buf = realloc(buf, size*2);
+      if( new_buf==NULL )
       {
-        fprintf(stderr, "fread: %s: %s\n", files[i], strerror(errno));
-        return 1;
+        break;
       }
-      fclose(fp);
+      buf   = new_buf;
+      size *= 2;
+    }
+    rlen = read(STDIN_FILENO, buf+len, size-len);
+    if( rlen<0 && errno==EINTR )
+    {
+      continue;
+    }
+    if( rlen<0 )
+    {
+      break;
+    }
+    if( rlen==0 )
+    {
+      *p_len = len;
+      return buf;
+    }
+    len += rlen;
+  }
+  free(buf);
+  return NULL;
+}
 
-      code = uj_getcode((uj_uint8*)buf, buf_len);
-      if( !no_filename )
+/* returns the length of the header (up to the blank line), and the
+ * offset of the body in *p_body.  without a blank line it is all header. */
+static uj_size_t header_length(const uj_uint8* buf, uj_size_t len, uj_size_t* p_body)
+{
+  const uj_uint8* p   = buf;
+  const uj_uint8* end = buf + len;
+  while( (p = memchr(p, '\n', end-p))!=NULL )
+  {
+    ++p;
+    if( p<end && *p=='\n' )
+    {
+      *p_body = p+1-buf;
+      return p-buf;
+    }
+    if( p+1<end && p[0]=='\r' && p[1]=='\n' )
+    {
+      *p_body = p+2-buf;
+      return p-buf;
+    }
+  }
+  *p_body = len;
+  return len;
+}
+
+static const char* code_str(int code)
+{
+  if( code==UJGUESS_ERROR )
+  {
+    return "error";
+  }
+  return uj_charcode_str((uj_charcode_t)code);
+}
+
+/* ----------------------------------------------------------------------------
+ * print_histogram(opts, hist).
+ *   one line per code (per pair of header and body codes with --mail):
+ *   count, percentage and the codes, tab separated, most common first.
+ * ------------------------------------------------------------------------- */
+static void print_histogram(const ujguess_opts_t* opts, ujguess_hist_t hist)
+{
+  ujguess_row_t rows[UJGUESS_NR_CODES*UJGUESS_NR_CODES];
+  unsigned long total;
+  int nr_rows;
+  int i, j;
+
+  total   = 0;
+  nr_rows = 0;
+  for( i=0; i<UJGUESS_NR_CODES; ++i )
+  {
+    for( j=0; j<UJGUESS_NR_CODES; ++j )
+    {
+      if( hist[i][j]!=0 )
       {
-        printf("%s:", files[i]);
+        rows[nr_rows].count  = hist[i][j];
+        rows[nr_rows].header = i;
+        rows[nr_rows].body   = j;
+        ++nr_rows;
+        total += hist[i][j];
       }
-      printf("%s\n", uj_charcode_str(code));
     }
-    free(buf);
   }
-  return 0;
+  qsort(rows, nr_rows, sizeof(rows[0]), cmp_row);
+  for( i=0; i<nr_rows; ++i )
+  {
+    const double pct = 100.0*rows[i].count/total;
+    if( opts->mail && rows[i].header!=UJGUESS_ERROR )
+    {
+      printf("%lu\t%.2f\t%s\t%s\n", rows[i].count, pct, code_str(rows[i].header), code_str(rows[i].body));
+    }else
+    {
+      printf("%lu\t%.2f\t%s\n", rows[i].count, pct, code_str(rows[i].header));
+    }
+  }
+  printf("%lu\t100.00\ttotal\n", total);
+}
+
+static int cmp_row(const void* a, const void* b)
+{
+  const ujguess_row_t* ra = a;
+  const ujguess_row_t* rb = b;
+  if( ra->count!=rb->count )
+  {
+    return ra->count>rb->count ? -1 : 1;
+  }
+  if( ra->header!=rb->header )
+  {
+    return ra->header - rb->header;
+  }
+  return ra->body - rb->body;
+}
+
+static void print_usage(void)
+{
+  printf("usage: ujguess [options..] [files..]\n");
+  printf("options:\n");
+  printf("-r, --recursive   guess the files under the directories\n");
+  printf("-m, --mail        guess the header and the body separately\n");
+  printf("                  (prints header,body)\n");
+  printf("-H, --histogram   print the count of each code instead of each file\n");
+  printf("-R, --report file write a tab separated line per file to file\n");
+  printf("                  (name, bytes and codes; - for stdout)\n");
+  printf("-j, --jobs        number of files guessed at once (default: cpus)\n");
+  printf("--show-filename   prefix each line with the file name\n");
+  printf("--no-filename     do not prefix each line with the file name\n");
+  printf("-h, --help        show this usage\n");
+  printf("-V, --version     show version information\n");
+  return;
 }
 
 /* ----------------------------------------------------------------------------
@@ -18,6 +18,15 @@ extern "C"
 #include "unijp_types.h"
 #include "unijp_version.h"
 
+/* ----------------------------------------------------------------------------
+: thread safety.
+:   the conversion tables are constant data built into the library, so
+:   there is nothing to initialize and every uj_* function may run on any
+:   number of threads at once.  a unijp_t is never modified after uj_new,
+:   so threads may share one for output; only uj_delete and
+:   uj_conv_inplace must not race with other calls on the same object.
++--------------------------------------------------------------------------- */
+
 struct unijp_s
 {
   const uj_alloc_t* alloc;
@@ -29,24 +38,37 @@ typedef struct unijp_s unijp_t;
 
 /* ----------------------------------------------------------------------------
 : uj_new(str, bytes_len, icode).
+:   thread safe.
 +--------------------------------------------------------------------------- */
 extern unijp_t* uj_new(const uj_uint8* str, uj_size_t bytes, uj_charcode_t icode);
 
 /* ----------------------------------------------------------------------------
 : uj_delete(uj).
+:   thread safe for distinct objects.
 +--------------------------------------------------------------------------- */
 extern void uj_delete(unijp_t* uj);
 
 /* ----------------------------------------------------------------------------
 : uj_conv(uj, ocode, &len).
+:   thread safe, also on a shared uj.
 +--------------------------------------------------------------------------- */
 extern uj_uint8* uj_conv(unijp_t* uj, uj_charcode_t ocode, uj_size_t* p_len);
 
+/* ----------------------------------------------------------------------------
+: uj_conv_inplace(uj, ocode, &len).
+:   same as uj_conv, but hands over the text of uj: sjis and eucjp are
+:   converted in its own buffer, so a large text is not held twice.
+:   uj is left empty, and still has to be uj_delete'd.
+:   thread safe for distinct objects.
++--------------------------------------------------------------------------- */
+extern uj_uint8* uj_conv_inplace(unijp_t* uj, uj_charcode_t ocode, uj_size_t* p_len);
+
 /* ----------------------------------------------------------------------------
 : str = uj_to_utf8(uj, &len).
 : str = uj_to_sjis(uj, &len).
 : str = uj_to_eucjp(uj, &len).
 : str = uj_to_jis(uj, &len).
+:   thread safe, also on a shared uj.
 +--------------------------------------------------------------------------- */
 extern uj_uint8* uj_to_utf8(const unijp_t* uj, uj_size_t* p_len);
 extern uj_uint8* uj_to_sjis(const unijp_t* uj, uj_size_t* p_len);
@@ -58,12 +80,14 @@ extern uj_uint8* uj_to_utf16(const unijp_t* uj, uj_size_t* p_len);
 
 /* ----------------------------------------------------------------------------
 : uj_getcode(str, len).
+:   thread safe.
 +--------------------------------------------------------------------------- */
 extern uj_charcode_t uj_getcode(const uj_uint8* str, uj_size_t len);
 
 /* ----------------------------------------------------------------------------
 : uj_charcode_parse(str).
 : uj_charcode_str(code).
+:   thread safe.
 +--------------------------------------------------------------------------- */
 extern uj_charcode_t uj_charcode_parse(const char* name);
 extern uj_charcode_t uj_charcode_parse_n(const char* name, int str_len);
@@ -36,6 +36,7 @@ extern void _uj_conv_move_owner(uj_conv_t* dst, uj_conv_t* src);
 extern void _uj_conv_free_buffer(uj_conv_t* conv);
 
 extern uj_conv_t* _uj_any_to_utf8(const uj_conv_t* in, uj_conv_t* out, uj_charcode_t icode);
+extern uj_conv_t* _uj_auto_to_utf8(const uj_conv_t* in, uj_conv_t* out);
 extern uj_conv_t* _uj_validate_utf8(const uj_conv_t* in, uj_conv_t* out);
 
 extern uj_conv_t* _uj_sjis_to_utf8(const uj_conv_t* in, uj_conv_t* out);
@@ -52,9 +53,13 @@ extern uj_conv_t* _uj_ucs2_to_utf8(const uj_conv_t* in, uj_conv_t* out);
 
 extern uj_conv_t* _uj_utf8_to_ucs4(const uj_conv_t* in, uj_conv_t* out);
 extern uj_conv_t* _uj_ucs4_to_utf8(const uj_conv_t* in, uj_conv_t* out);
+extern uj_conv_t* _uj_utf8_to_ucs4le(const uj_conv_t* in, uj_conv_t* out);
+extern uj_conv_t* _uj_ucs4le_to_utf8(const uj_conv_t* in, uj_conv_t* out);
 
 extern uj_conv_t* _uj_utf8_to_utf16(const uj_conv_t* in, uj_conv_t* out);
 extern uj_conv_t* _uj_utf16_to_utf8(const uj_conv_t* in, uj_conv_t* out);
+extern uj_conv_t* _uj_utf8_to_utf16le(const uj_conv_t* in, uj_conv_t* out);
+extern uj_conv_t* _uj_utf16le_to_utf8(const uj_conv_t* in, uj_conv_t* out);
 
 #ifdef __cplusplus
 }
@@ -19,6 +19,8 @@
 
 #define xs_utf16_utf8(decl) _uj_xs_utf16_utf8(const uj_conv_t* sv_str, uj_conv_t* __out)
 #define xs_utf8_utf16(decl) _uj_xs_utf8_utf16(const uj_conv_t* sv_str, uj_conv_t* __out)
+#define xs_utf16le_utf8(decl) _uj_xs_utf16le_utf8(const uj_conv_t* sv_str, uj_conv_t* __out)
+#define xs_utf8_utf16le(decl) _uj_xs_utf8_utf16le(const uj_conv_t* sv_str, uj_conv_t* __out)
 
 #include <stdlib.h>
 #include <netinet/in.h>
@@ -27,8 +29,12 @@
 
 #undef xs_utf16_utf8
 #undef xs_utf8_utf16
+#undef xs_utf16le_utf8
+#undef xs_utf8_utf16le
 #define xs_utf16_utf8(in,out) _uj_xs_utf16_utf8(in,out)
 #define xs_utf8_utf16(in,out) _uj_xs_utf8_utf16(in,out)
+#define xs_utf16le_utf8(in,out) _uj_xs_utf16le_utf8(in,out)
+#define xs_utf8_utf16le(in,out) _uj_xs_utf8_utf16le(in,out)
 
 uj_conv_t* _uj_utf16_to_utf8(const uj_conv_t* in, uj_conv_t* out)
 {
@@ -46,6 +52,22 @@ uj_conv_t* _uj_utf8_to_utf16(const uj_conv_t* in, uj_conv_t* out)
   return ret;
 }
 
+uj_conv_t* _uj_utf16le_to_utf8(const uj_conv_t* in, uj_conv_t* out)
+{
+  uj_conv_t* ret;
+  ret = xs_utf16le_utf8(in, out);
+  /* ret == out|NULL */
+  return ret;
+}
+
+uj_conv_t* _uj_utf8_to_utf16le(const uj_conv_t* in, uj_conv_t* out)
+{
+  uj_conv_t* ret;
+  ret = xs_utf8_utf16le(in, out);
+  /* ret == out|NULL */
+  return ret;
+}
+
 /* ----------------------------------------------------------------------------
 : uj_to_utf16(uj, &len).
 +--------------------------------------------------------------------------- */
@@ -14,7 +14,16 @@ extern uj_conv_t* _uj_conv_new_strn(const uj_alloc_t* alloc, const char* str, uj
 extern uj_conv_t* _uj_conv_clone(const uj_conv_t* conv);
 
 extern const uj_conv_t _uj_xs_conv_undef;
-extern uj_size_t _uj_xs_PL_na;
+/* perl keeps PL_na in each interpreter; here each thread has its own,
+ * as the converters may run on any number of threads at once. */
+#if defined(_MSC_VER)
+#define UJ_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#define UJ_THREAD_LOCAL __thread
+#else
+#define UJ_THREAD_LOCAL
+#endif
+extern UJ_THREAD_LOCAL uj_size_t _uj_xs_PL_na;
 extern void _uj_xs_SV_Buf_append_ch(uj_conv_t* conv, int ch);
 extern void _uj_xs_SV_Buf_append_ch2(uj_conv_t* conv, int ch);
 extern void _uj_xs_SV_Buf_append_ch3(uj_conv_t* conv, int ch);
@@ -52,6 +61,8 @@ extern uj_conv_t* _uj_xs_SV_Buf_getSv(const uj_conv_t* conv);
 #define PL_sv_undef        (_uj_xs_conv_undef)
 #define newSVpvn(str, len) _uj_conv_new_strn(_uj_default_alloc,str,len)
 #define newSVsv(p_var)     _uj_conv_clone(p_var)
+#define SvREFCNT_inc(p_var) \
+  (_uj_conv_set_const(__out,(p_var)->alloc,(p_var)->buf,(p_var)->buf_len),__out)
 
 #define SvPV(var,len) ((len)=(var)->buf_len,(var)->buf)
 #define sv_len(var)   ((var)->buf_len)
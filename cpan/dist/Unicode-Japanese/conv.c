@@ -17,6 +17,7 @@
 #endif
 
 #include "Japanese.h"
+#include "simd.h"
 #include <stdio.h>
 
 #define DISP_S2U 0
@@ -58,7 +59,11 @@ xs_sjis_utf8(SV* sv_str)
   }
   
   src = (UJ_UINT8*)SvPV(sv_str,src_len);
-  len = sv_len(sv_str);
+  len = src_len;
+  if( uj_is_plain_ascii(src, len) )
+  { /* ascii reads the same in every code. */
+    return SvREFCNT_inc(sv_str);
+  }
 #if DISP_S2U
   fprintf(stderr,"Unicode::Japanese::(xs)sjis_utf8\n",len);
   bin_dump("in ",src,len);
@@ -148,6 +153,10 @@ xs_utf8_sjis(SV* sv_str)
   }
   src = (UJ_UINT8*)SvPV(sv_str,PL_na);
   len = sv_len(sv_str);
+  if( uj_is_plain_ascii(src, len) )
+  { /* ascii reads the same in every code. */
+    return SvREFCNT_inc(sv_str);
+  }
 
   ECHO_U2S((stderr,"Unicode::Japanese::(xs)utf8_sjis\n"));
   ON_U2S( bin_dump("in ",src,len) );
@@ -0,0 +1,1708 @@
+/* This file was auto-generated by gen_emoji_rev.pl */
+/* $Id$ */
+
+#include "emoji_rev.h"
+
+/* ----------------------------------------------------------------------------
+ * eu2i1 (jcode/emoji2/eu2i.dat): 1005 chars in 238 runs.
+ * ------------------------------------------------------------------------- */
+static const unsigned char eu2i1_values[][2] =
+{
+  {0xf9,0xa7}, {0xf9,0xa7}, {0x81,0x48}, {0xf9,0x86}, {0x81,0xa9},
+  {0x81,0xa8}, {0x81,0xe1}, {0x81,0xe2}, {0x81,0x90}, {0xf8,0xa3},
+  {0x81,0x7b}, {0x81,0x7c}, {0xf9,0x9f}, {0x81,0xaa}, {0x81,0xab},
+  {0x81,0xa5}, {0x81,0xa3}, {0xf8,0xf8}, {0xf8,0xf7}, {0xf8,0x9f},
+  {0xf8,0xb4}, {0xf9,0x5e}, {0xf9,0x91}, {0xf8,0xd2}, {0x81,0x7e},
+  {0x81,0x7e}, {0x81,0xa8}, {0x81,0xa9}, {0xf8,0xd3}, {0x81,0x80},
+  {0xf9,0x95}, {0x81,0x99}, {0xf8,0xd9}, {0xf9,0x49}, {0xf9,0x45},
+  {0xf9,0xa0}, {0xf8,0xe3}, {0xf8,0xe8}, {0x81,0xa3}, {0x81,0xa5},
+  {0xf8,0xea}, {0xf8,0xea}, {0xf8,0xd1}, {0xf8,0xe2}, {0xf8,0xa1},
+  {0xf8,0xe4}, {0xf8,0xce}, {0xf8,0xe4}, {0xf8,0xe4}, {0xf8,0xe4},
+  {0xf8,0xd6}, {0xf8,0xdf}, {0xf8,0xa0}, {0xf9,0x77}, {0xf9,0x7a},
+  {0xf8,0xd8}, {0xf8,0xc4}, {0xf8,0xfb}, {0xf9,0x81}, {0xf9,0x7d},
+  {0xf8,0xea}, {0xf8,0xea}, {0xf8,0xbf}, {0xf9,0x45}, {0xf8,0xea},
+  {0xf8,0xe6}, {0xf8,0xd0}, {0xf8,0xe4}, {0xf9,0x52}, {0xf9,0x73},
+  {0xf8,0xe8}, {0xf8,0xe9}, {0xf9,0x74}, {0xf8,0xc3}, {0xf9,0x47},
+  {0xf8,0xbc}, {0x81,0x40}, {0x20,0x00}, {0xf8,0xe0}, {0xf8,0xe1},
+  {0xf8,0xfc}, {0xf9,0x87}, {0xf9,0x88}, {0xf9,0x89}, {0xf9,0x8a},
+  {0xf9,0x8b}, {0xf9,0x8c}, {0xf9,0x8d}, {0xf9,0x8e}, {0xf9,0x8f},
+  {0x31,0x30}, {0xf8,0xa4}, {0xf8,0xa2}, {0xf8,0xc9}, {0xf8,0xcf},
+  {0xf8,0xcd}, {0xf8,0xc8}, {0xf8,0xcc}, {0xf8,0xc1}, {0xf8,0xbe},
+  {0xf8,0xb7}, {0xf8,0xb6}, {0xf8,0xba}, {0xf9,0x50}, {0xf8,0xec},
+  {0xf9,0x48}, {0xf8,0xd4}, {0xf9,0x46}, {0xf9,0x95}, {0xf9,0x96},
+  {0xf9,0x97}, {0xf9,0xa6}, {0xf9,0xa1}, {0xf9,0xac}, {0xf9,0x93},
+  {0xf9,0x94}, {0xf9,0x9f}, {0xf9,0xa3}, {0xf9,0x91}, {0xf9,0x9e},
+  {0xf8,0xf9}, {0x94,0xe9}, {0xf9,0xa2}, {0xf9,0xad}, {0x93,0xbe},
+  {0xf8,0xeb}, {0xf8,0xd7}, {0xf9,0x9b}, {0xf8,0xdb}, {0x45,0x7a},
+  {0xf9,0x7b}, {0xf8,0xed}, {0x55,0x50}, {0xf8,0xa5}, {0xf8,0xb5},
+  {0xf8,0xb9}, {0xf8,0xe5}, {0xf8,0xef}, {0xf8,0xf0}, {0xf8,0xf1},
+  {0xf8,0xf2}, {0xf8,0xf3}, {0xf8,0xf5}, {0xf8,0xf6}, {0xf9,0x40},
+  {0xf9,0x80}, {0xf9,0x90}, {0xf9,0xb0}, {0xf9,0x99}, {0xf9,0x92},
+  {0xf9,0xab}, {0xf9,0x82}, {0xf9,0x9b}, {0xf9,0x94}, {0xf9,0xac},
+  {0xf8,0xe3}, {0x56,0x53}, {0xf8,0xc6}, {0xf8,0xc7}, {0xf8,0xca},
+  {0xf8,0xc2}, {0x8a,0x84}, {0x83,0x54}, {0xf9,0x7c}, {0x96,0x9e},
+  {0x8b,0xf3}, {0x8e,0x77}, {0x89,0x63}, {0x8f,0x6a}, {0xf8,0xee},
+  {0xf9,0x91}, {0xf9,0x91}, {0xf9,0x91}, {0xf9,0x91}, {0xf9,0x91},
+  {0xf8,0xb8}, {0xf9,0x98}, {0xf9,0x9b}, {0xf9,0x95}, {0xf8,0xa6},
+  {0xf8,0xca}, {0x89,0xc2}, {0x82,0x60}, {0x82,0x61}, {0x82,0x6e},
+  {0x41,0x42}, {0xf8,0xf9}, {0xf8,0xfa}, {0xf9,0x9a}, {0xf9,0xa5},
+  {0xf9,0xa8}, {0xf9,0xa9}, {0xf9,0xaf}, {0xf9,0x9d}, {0xf9,0x96},
+  {0xf9,0x77}, {0xf9,0x77}, {0xf9,0x91}, {0x81,0xcc}, {0xf9,0x77},
+  {0xf8,0xf4}, {0xf9,0x85}, {0xf9,0x90}, {0xf9,0x87}, {0xf9,0x88},
+  {0xf9,0x89}, {0xf9,0x8a}, {0xf9,0x8b}, {0xf9,0x8c}, {0xf9,0x8d},
+  {0xf9,0x8e}, {0xf9,0x8f}, {0x31,0x30}, {0x31,0x31}, {0x31,0x32},
+  {0xf9,0x87}, {0xf9,0x88}, {0xf9,0x89}, {0xf9,0x8a}, {0xf9,0x8b},
+  {0xf9,0x8c}, {0xf9,0x8d}, {0xf9,0x8e}, {0xf9,0x8f}, {0x31,0x30},
+  {0x89,0x63}, {0x8f,0x5a}, {0x8c,0xf0}, {0x8b,0x78}, {0x94,0x4e},
+  {0x90,0x45}, {0x90,0xc8}, {0x8e,0x77}, {0xf9,0x86}, {0x82,0x60},
+  {0x93,0xc1}, {0x94,0xe9}, {0x92,0xb4}, {0x8b,0x7d}, {0x94,0x83},
+  {0x94,0x84}, {0x90,0xc5}, {0x91,0x53}, {0x8c,0x6e}, {0x91,0xb0},
+  {0xf9,0x45}, {0xf9,0x46}, {0xf9,0x48}, {0xf9,0x9d}, {0xf8,0xc0},
+  {0xf8,0xc1}, {0xf8,0xbc}, {0xf8,0xbe}, {0xf8,0xc3}, {0xf8,0xc2},
+  {0xf8,0xd0}, {0xf8,0xcb}, {0xf8,0xd4}, {0xf8,0xd3}, {0xf8,0xd2},
+  {0xf8,0xd1}, {0xf8,0xd0}, {0xf8,0xd7}, {0xf8,0xca}, {0xf8,0xca},
+  {0xf8,0xd8}, {0xf8,0xdd}, {0xf8,0xb4}, {0xf8,0xb7}, {0xf8,0xb9},
+  {0xf8,0xb6}, {0xf8,0xb5}, {0xf8,0xb8}, {0xf8,0xcd}, {0xf8,0xcc},
+  {0xf8,0xd0}, {0xf8,0xc7}, {0xf9,0x9c}, {0xf8,0xc8}, {0xf8,0xe1},
+  {0xf8,0xe0}, {0xf8,0x9f}, {0xf8,0xa0}, {0xf8,0xa1}, {0xf8,0xa2},
+  {0xf8,0xa3}, {0x81,0xa9}, {0x81,0xa8}, {0xf9,0x7e}, {0xf8,0xf4},
+  {0xf8,0xf5}, {0xf8,0xf6}, {0xf9,0x9e}, {0xf9,0x91}, {0xf9,0x94},
+  {0xf8,0xee}, {0xf8,0xf0}, {0xf8,0xf1}, {0xf8,0xef}, {0xf9,0xa9},
+  {0xf9,0xa8}, {0xf9,0x9b}, {0xf8,0xfa}, {0xf8,0xd5}, {0xf8,0xe3},
+  {0xf8,0xfb}, {0xf8,0xe9}, {0xf8,0xe9}, {0xf8,0xe8}, {0xf8,0xe8},
+  {0xf8,0xbb}, {0xf9,0x74}, {0xf9,0x5e}, {0xf8,0xe2}, {0xf9,0xa0},
+  {0xf8,0xec}, {0xf8,0xeb}, {0xf8,0xdb}, {0xf8,0xed}, {0xf9,0x52},
+  {0xf8,0xea}, {0xf8,0xe4}, {0xf8,0xd6}, {0xf8,0xc6}, {0xf9,0x77},
+  {0xf9,0x81}, {0xf8,0xc4}, {0xf8,0xc5}, {0xf9,0xa3}, {0xf9,0x51},
+  {0xf9,0x7d}, {0xf8,0xdf}, {0xf8,0xe6}, {0xf8,0xa1}, {0xf9,0x56},
+  {0x8f,0x74}, {0x89,0xc4}, {0x8f,0x48}, {0x93,0x7e}, {0xf9,0x95},
+  {0xf9,0x97}, {0xf9,0x96}, {0xf9,0xa0}, {0xf9,0xa0}, {0xf9,0xa0},
+  {0xf9,0xa0}, {0xf8,0x9f}, {0xf8,0x9f}, {0xf8,0x9f}, {0xf8,0x9f},
+  {0xf9,0x93}, {0xf9,0x93}, {0xf9,0x93}, {0xf9,0x93}, {0xf9,0x95},
+  {0xf9,0x95}, {0xf9,0x95}, {0xf9,0x85}, {0xf9,0x90}, {0xf9,0x90},
+  {0xf9,0x87}, {0xf9,0x88}, {0xf9,0x89}, {0xf9,0x8a}, {0xf9,0x8b},
+  {0xf9,0x8c}, {0xf9,0x8d}, {0xf9,0x8e}, {0xf9,0x8f}, {0x31,0x30},
+  {0x2d,0x00}, {0x21,0x00}, {0x81,0x90}, {0x25,0x00}, {0x2e,0x00},
+  {0x2f,0x00}, {0x3a,0x00}, {0x3b,0x00}, {0x40,0x00}, {0x5e,0x00},
+  {0x5f,0x00}, {0x27,0x00}, {0x22,0x00}, {0x81,0x7b}, {0x3d,0x00},
+  {0x81,0x7e}, {0x81,0x80}, {0x81,0x9b}, {0xf9,0x7a}, {0xf9,0xb0},
+  {0x4e,0x47}, {0x93,0xbe}, {0x8a,0x84}, {0x82,0x81}, {0x82,0x82},
+  {0x82,0x83}, {0x82,0x84}, {0x82,0x85}, {0x82,0x86}, {0x82,0x87},
+  {0x82,0x88}, {0x82,0x89}, {0x82,0x8a}, {0x82,0x8b}, {0x82,0x8c},
+  {0x82,0x8d}, {0x82,0x8e}, {0x82,0x8f}, {0x82,0x90}, {0x82,0x91},
+  {0x82,0x92}, {0x82,0x93}, {0x82,0x94}, {0x82,0x95}, {0x82,0x96},
+  {0x82,0x97}, {0x82,0x98}, {0x82,0x99}, {0x82,0x9a}, {0x82,0x60},
+  {0x82,0x61}, {0x82,0x62}, {0x82,0x63}, {0x82,0x64}, {0x82,0x65},
+  {0x82,0x66}, {0x82,0x67}, {0x82,0x68}, {0x82,0x69}, {0x82,0x6a},
+  {0x82,0x6b}, {0x82,0x6c}, {0x82,0x6d}, {0x82,0x6e}, {0x82,0x6f},
+  {0x82,0x70}, {0x82,0x71}, {0x82,0x72}, {0x82,0x73}, {0x82,0x74},
+  {0x82,0x75}, {0x82,0x76}, {0x82,0x77}, {0x82,0x78}, {0x82,0x79},
+  {0x82,0x9f}, {0x82,0xa0}, {0x82,0xa1}, {0x82,0xa2}, {0x82,0xa3},
+  {0x82,0xa4}, {0x82,0xa5}, {0x82,0xa6}, {0x82,0xa7}, {0x82,0xa8},
+  {0x82,0xa9}, {0x82,0xaa}, {0x82,0xab}, {0x82,0xac}, {0x82,0xad},
+  {0x82,0xae}, {0x82,0xaf}, {0x82,0xb0}, {0x82,0xb1}, {0x82,0xb2},
+  {0x82,0xb3}, {0x82,0xb4}, {0x82,0xb5}, {0x82,0xb6}, {0x82,0xb7},
+  {0x82,0xb8}, {0x82,0xb9}, {0x82,0xba}, {0x82,0xbb}, {0x82,0xbc},
+  {0x82,0xbd}, {0x82,0xbe}, {0x82,0xbf}, {0x82,0xc0}, {0x82,0xc1},
+  {0x82,0xc2}, {0x82,0xc3}, {0x82,0xc4}, {0x82,0xc5}, {0x82,0xc6},
+  {0x82,0xc7}, {0x82,0xc8}, {0x82,0xc9}, {0x82,0xca}, {0x82,0xcb},
+  {0x82,0xcc}, {0x82,0xcd}, {0x82,0xce}, {0x82,0xcf}, {0x82,0xd0},
+  {0x82,0xd1}, {0x82,0xd2}, {0x82,0xd3}, {0x82,0xd4}, {0x82,0xd5},
+  {0x82,0xd6}, {0x82,0xd7}, {0x82,0xd8}, {0x82,0xd9}, {0x82,0xda},
+  {0x82,0xdb}, {0x82,0xdc}, {0x82,0xdd}, {0x82,0xde}, {0x82,0xdf},
+  {0x82,0xe0}, {0x82,0xe1}, {0x82,0xe2}, {0x82,0xe3}, {0x82,0xe4},
+  {0x82,0xe5}, {0x82,0xe6}, {0x82,0xe7}, {0x82,0xe8}, {0x82,0xe9},
+  {0x82,0xea}, {0x82,0xeb}, {0x82,0xed}, {0x82,0xf0}, {0x82,0xf1},
+  {0x83,0x40}, {0x83,0x41}, {0x83,0x42}, {0x83,0x43}, {0x83,0x44},
+  {0x83,0x45}, {0x83,0x46}, {0x83,0x47}, {0x83,0x48}, {0x83,0x49},
+  {0x83,0x4a}, {0x83,0x4b}, {0x83,0x4c}, {0x83,0x4d}, {0x83,0x4e},
+  {0x83,0x4f}, {0x83,0x50}, {0x83,0x51}, {0x83,0x52}, {0x83,0x53},
+  {0x83,0x54}, {0x83,0x55}, {0x83,0x56}, {0x83,0x57}, {0x83,0x58},
+  {0x83,0x59}, {0x83,0x5a}, {0x83,0x5b}, {0x83,0x5c}, {0x83,0x5d},
+  {0x83,0x5e}, {0x83,0x5f}, {0x83,0x60}, {0x83,0x61}, {0x83,0x62},
+  {0x83,0x63}, {0x83,0x64}, {0x83,0x65}, {0x83,0x66}, {0x83,0x67},
+  {0x83,0x68}, {0x83,0x69}, {0x83,0x6a}, {0x83,0x6b}, {0x83,0x6c},
+  {0x83,0x6d}, {0x83,0x6e}, {0x83,0x6f}, {0x83,0x70}, {0x83,0x71},
+  {0x83,0x72}, {0x83,0x73}, {0x83,0x74}, {0x83,0x75}, {0x83,0x76},
+  {0x83,0x77}, {0x83,0x78}, {0x83,0x79}, {0x83,0x7a}, {0x83,0x7b},
+  {0x83,0x7c}, {0x83,0x7d}, {0x83,0x7e}, {0x83,0x80}, {0x83,0x81},
+  {0x83,0x82}, {0x83,0x83}, {0x83,0x84}, {0x83,0x85}, {0x83,0x86},
+  {0x83,0x87}, {0x83,0x88}, {0x83,0x89}, {0x83,0x8a}, {0x83,0x8b},
+  {0x83,0x8c}, {0x83,0x8d}, {0x83,0x8f}, {0x83,0x92}, {0x83,0x93},
+  {0xf8,0xf9}, {0xf8,0xf9}, {0xf8,0xbf}, {0xf8,0xbf}, {0xf9,0x47},
+  {0xf8,0xba}, {0xf8,0xce}, {0xf8,0xc9}, {0xf8,0xcf}, {0xf8,0xfc},
+  {0xf8,0xa4}, {0xf8,0xa6}, {0xf9,0x43}, {0xf9,0x44}, {0xf8,0xd9},
+  {0xf8,0xf7}, {0xf8,0xf8}, {0xf9,0x49}, {0x81,0xcc}, {0xf9,0x82},
+  {0xf9,0xa7}, {0xf9,0x92}, {0xf9,0x84}, {0xf9,0x77}, {0xf8,0xf3},
+  {0xf8,0x9f}, {0xf8,0xa0}, {0xf8,0xa1}, {0xf8,0xa2}, {0xf8,0xa3},
+  {0xf8,0xa4}, {0xf8,0xa5}, {0xf8,0xa6}, {0xf8,0xa7}, {0xf8,0xa8},
+  {0xf8,0xa9}, {0xf8,0xaa}, {0xf8,0xab}, {0xf8,0xac}, {0xf8,0xad},
+  {0xf8,0xae}, {0xf8,0xaf}, {0xf8,0xb0}, {0xf8,0xb1}, {0xf8,0xb2},
+  {0xf8,0xb3}, {0xf8,0xb4}, {0xf8,0xb5}, {0xf8,0xb6}, {0xf8,0xb7},
+  {0xf8,0xb8}, {0xf8,0xb9}, {0xf8,0xba}, {0xf8,0xbb}, {0xf8,0xbc},
+  {0xf8,0xbd}, {0xf8,0xbe}, {0xf8,0xbf}, {0xf8,0xc0}, {0xf8,0xc1},
+  {0xf8,0xc2}, {0xf8,0xc3}, {0xf8,0xc4}, {0xf8,0xc5}, {0xf8,0xc6},
+  {0xf8,0xc7}, {0xf8,0xc8}, {0xf8,0xc9}, {0xf8,0xca}, {0xf8,0xcb},
+  {0xf8,0xcc}, {0xf8,0xcd}, {0xf8,0xce}, {0xf8,0xcf}, {0xf8,0xd0},
+  {0xf8,0xd1}, {0xf8,0xd2}, {0xf8,0xd3}, {0xf8,0xd4}, {0xf8,0xd5},
+  {0xf8,0xd6}, {0xf8,0xd7}, {0xf8,0xd8}, {0xf8,0xd9}, {0xf8,0xda},
+  {0xf8,0xdb}, {0xf8,0xdc}, {0xf8,0xdd}, {0xf8,0xde}, {0xf8,0xdf},
+  {0xf8,0xe0}, {0xf8,0xe1}, {0xf8,0xe2}, {0xf8,0xe3}, {0xf8,0xe4},
+  {0xf8,0xe5}, {0xf8,0xe6}, {0xf8,0xe7}, {0xf8,0xe8}, {0xf8,0xe9},
+  {0xf8,0xea}, {0xf8,0xeb}, {0xf8,0xec}, {0xf8,0xed}, {0xf8,0xee},
+  {0xf8,0xef}, {0xf8,0xf0}, {0xf8,0xf1}, {0xf8,0xf2}, {0xf8,0xf3},
+  {0xf8,0xf4}, {0xf8,0xf5}, {0xf8,0xf6}, {0xf8,0xf7}, {0xf8,0xf8},
+  {0xf8,0xf9}, {0xf8,0xfa}, {0xf8,0xfb}, {0xf8,0xfc}, {0xf9,0x40},
+  {0xf9,0x41}, {0xf9,0x42}, {0xf9,0x43}, {0xf9,0x44}, {0xf9,0x45},
+  {0xf9,0x46}, {0xf9,0x47}, {0xf9,0x48}, {0xf9,0x49}, {0xf9,0x50},
+  {0xf9,0x51}, {0xf9,0x52}, {0xf9,0x55}, {0xf9,0x56}, {0xf9,0x57},
+  {0xf9,0x5b}, {0xf9,0x5c}, {0xf9,0x5d}, {0xf9,0x5e}, {0xf9,0x72},
+  {0xf9,0x73}, {0xf9,0x74}, {0xf9,0x75}, {0xf9,0x76}, {0xf9,0x77},
+  {0xf9,0x78}, {0xf9,0x79}, {0xf9,0x7a}, {0xf9,0x7b}, {0xf9,0x7c},
+  {0xf9,0x7d}, {0xf9,0x7e}, {0xf9,0x80}, {0xf9,0x81}, {0xf9,0x82},
+  {0xf9,0x83}, {0xf9,0x84}, {0xf9,0x85}, {0xf9,0x86}, {0xf9,0x87},
+  {0xf9,0x88}, {0xf9,0x89}, {0xf9,0x8a}, {0xf9,0x8b}, {0xf9,0x8c},
+  {0xf9,0x8d}, {0xf9,0x8e}, {0xf9,0x8f}, {0xf9,0x90}, {0xf9,0x91},
+  {0xf9,0x92}, {0xf9,0x93}, {0xf9,0x94}, {0xf9,0x95}, {0xf9,0x96},
+  {0xf9,0x97}, {0xf9,0x98}, {0xf9,0x99}, {0xf9,0x9a}, {0xf9,0x9b},
+  {0xf9,0x9c}, {0xf9,0x9d}, {0xf9,0x9e}, {0xf9,0x9f}, {0xf9,0xa0},
+  {0xf9,0xa1}, {0xf9,0xa2}, {0xf9,0xa3}, {0xf9,0xa4}, {0xf9,0xa5},
+  {0xf9,0xa6}, {0xf9,0xa7}, {0xf9,0xa8}, {0xf9,0xa9}, {0xf9,0xaa},
+  {0xf9,0xab}, {0xf9,0xac}, {0xf9,0xad}, {0xf9,0xae}, {0xf9,0xaf},
+  {0xf9,0xb0}, {0xf9,0x51}, {0xf9,0x52}, {0xf9,0xac}, {0xf9,0xac},
+  {0xf9,0x96}, {0xf9,0x94}, {0xf9,0x95}, {0xf9,0x97}, {0x4e,0x47},
+  {0x94,0xe9}, {0xf9,0xa7}, {0x8b,0xd6}, {0x8b,0xf3}, {0x8d,0x87},
+  {0x96,0x9e}, {0x81,0xcc}, {0xf9,0x73}, {0xf9,0x72}, {0xf9,0x94},
+  {0xf9,0xac}, {0xf9,0xa0}, {0xf8,0xe6}, {0xf9,0x81}, {0xf8,0xd4},
+  {0xf9,0x9c}, {0xf8,0xdf}, {0xf8,0xed}, {0xf8,0xed}, {0xf8,0xeb},
+  {0x56,0x53}, {0xf9,0x51}, {0xf8,0xba}, {0xf9,0xa6}, {0xf8,0xa3},
+  {0xf8,0xd5}, {0xf8,0xcf}, {0xf8,0xe4}, {0xf8,0xc8}, {0xf8,0xce},
+  {0xf8,0xcd}, {0xf8,0xcf}, {0xf8,0xc6}, {0xf8,0xc9}, {0xf8,0xc7},
+  {0xf8,0xcb}, {0xf8,0xca}, {0xf8,0xc1}, {0xf8,0xbf}, {0xf8,0xcf},
+  {0xf8,0xdb}, {0x8f,0x6a}, {0xf8,0xe0}, {0xf9,0xa3}, {0xf8,0xd6},
+  {0xf8,0xe5}, {0x94,0xe9}, {0xf8,0xe3}, {0xf9,0x50}, {0xf9,0x9b},
+  {0xf9,0x91}, {0xf9,0x91}, {0xf9,0x91}, {0xf9,0x91}, {0xf9,0x91},
+  {0xf9,0x91}, {0xf9,0x91}, {0xf9,0x9f}, {0x81,0x99}, {0xf9,0xad},
+  {0xf9,0xab}, {0x81,0x9b}, {0x81,0x7e}, {0xf9,0xa1}, {0x81,0x99},
+  {0x81,0x48}, {0xf9,0xa7}, {0xf8,0xc2}, {0xf8,0xe1}, {0xf8,0xfc},
+  {0xf8,0xee}, {0xf8,0xf0}, {0xf8,0xef}, {0xf8,0xf1}, {0xf9,0x85},
+  {0xf9,0x84}, {0xf9,0x82}, {0x55,0x50}, {0x97,0x4c}, {0x96,0xb3},
+  {0x8c,0x8e}, {0x90,0x5c}, {0xf9,0x87}, {0xf9,0x88}, {0xf9,0x89},
+  {0xf9,0x8a}, {0xf9,0x8b}, {0xf9,0x8c}, {0xf9,0x8d}, {0xf9,0x8e},
+  {0xf9,0x8f}, {0xf9,0x90}, {0x93,0xbe}, {0x8a,0x84}, {0x83,0x54},
+  {0xf9,0x7c}, {0x96,0x9e}, {0x8b,0xf3}, {0x8e,0x77}, {0x89,0x63},
+  {0x81,0xaa}, {0x81,0xab}, {0x81,0xa8}, {0x81,0xa9}, {0xf8,0xd9},
+  {0xf8,0xf8}, {0xf8,0xf7}, {0xf9,0x49}, {0x81,0xa8}, {0x81,0xa9},
+  {0x81,0xe2}, {0x81,0xe1}, {0xf8,0xa7}, {0xf8,0xa8}, {0xf8,0xa9},
+  {0xf8,0xaa}, {0xf8,0xab}, {0xf8,0xac}, {0xf8,0xad}, {0xf8,0xae},
+  {0xf8,0xaf}, {0xf8,0xb0}, {0xf8,0xb1}, {0xf8,0xb2}, {0xf9,0xb0},
+  {0xf9,0xa7}, {0x82,0x69}, {0xf9,0xac}, {0xf9,0x98}, {0xf9,0x95},
+  {0xf9,0x95}, {0xf9,0x96}, {0xf8,0xf2}, {0xf8,0xf3}, {0xf8,0xb9},
+  {0xf8,0xc0}, {0xf8,0xbe}, {0xf8,0xa6}, {0xf8,0xa4}, {0xf9,0x9e},
+  {0xf8,0xe2}, {0xf8,0xe8}, {0xf8,0xe9}, {0xf9,0x74}, {0xf9,0xa2},
+  {0xf8,0xf4}, {0xf8,0xf5}, {0xf8,0xf6}, {0xf8,0xb8}, {0xf8,0xb5},
+  {0xf8,0xb6}, {0xf8,0xb4}, {0xf8,0xb7}, {0xf8,0xbf}, {0xf9,0x47},
+  {0xf8,0xc3}, {0xf8,0xbc}, {0xf8,0xbe}, {0x81,0x48}, {0xf9,0xa7},
+  {0xf9,0x91}, {0xf9,0x93}, {0xf9,0x48}, {0xf8,0xc4}, {0xf8,0xc5},
+  {0xf8,0xcc}, {0xf8,0xd7}, {0xf8,0xd8}, {0xf9,0x9b}, {0xf9,0x7d},
+  {0xf8,0xd0}, {0xf8,0xd1}, {0xf8,0xd3}, {0xf8,0xa2}, {0xf8,0xa0},
+  {0xf8,0x9f}, {0xf8,0xa1}, {0xf9,0x46}, {0xf9,0x45}, {0xf9,0x95},
+  {0xf9,0x95}, {0xf9,0x97}, {0xf9,0x96}, {0xf8,0xd8}, {0xf9,0x45},
+  {0x82,0x60}, {0x82,0x61}, {0x41,0x42}, {0x82,0x6e}, {0xf8,0xf9},
+};
+static const uj_emoji_run_t eu2i1_runs[] =
+{
+  {0x0001,8,0}, {0x000e,1,8}, {0x0010,1,9}, {0x001a,5,10}, {0x0020,2,15},
+  {0x002a,5,17}, {0x0033,2,22}, {0x0037,1,24}, {0x003d,1,25}, {0x003f,4,26},
+  {0x0044,4,30}, {0x004a,1,34}, {0x004d,1,35}, {0x0053,1,36}, {0x0055,1,37},
+  {0x0058,2,38}, {0x005b,5,40}, {0x0061,1,45}, {0x0063,4,46}, {0x0068,1,50},
+  {0x006a,5,51}, {0x0070,1,56}, {0x0074,1,57}, {0x0077,4,58}, {0x007d,1,62},
+  {0x0086,1,63}, {0x008e,1,64}, {0x0090,1,65}, {0x0092,2,66}, {0x0095,1,68},
+  {0x0097,1,69}, {0x009b,1,70}, {0x00a1,1,71}, {0x00a6,1,72}, {0x00a8,2,73},
+  {0x00ac,3,75}, {0x00b0,3,78}, {0x00b4,12,81}, {0x00cd,1,93}, {0x00cf,2,94},
+  {0x00d4,2,96}, {0x00d8,2,98}, {0x00db,2,100}, {0x00de,1,102},
+  {0x00e2,1,103}, {0x00e8,1,104}, {0x00ea,1,105}, {0x00f5,1,106},
+  {0x00fb,1,107}, {0x0101,3,108}, {0x0105,3,111}, {0x0109,4,114},
+  {0x0110,2,118}, {0x0114,1,120}, {0x0117,1,121}, {0x0119,2,122},
+  {0x011d,1,124}, {0x0120,2,125}, {0x0123,1,127}, {0x0126,1,128},
+  {0x012a,3,129}, {0x012f,1,132}, {0x0131,3,133}, {0x0138,1,136},
+  {0x013a,8,137}, {0x0144,5,145}, {0x014a,1,150}, {0x014e,1,151},
+  {0x0157,1,152}, {0x015d,1,153}, {0x015f,1,154}, {0x0167,1,155},
+  {0x016b,1,156}, {0x0177,2,157}, {0x017a,2,159}, {0x017f,7,161},
+  {0x0192,1,168}, {0x019e,6,169}, {0x01a5,1,175}, {0x01b9,1,176},
+  {0x01c5,2,177}, {0x01e1,1,179}, {0x01ec,1,180}, {0x01fa,1,181},
+  {0x02d4,6,182}, {0x02db,5,188}, {0x02f7,1,193}, {0x030b,1,194},
+  {0x0310,1,195}, {0x031f,1,196}, {0x0323,1,197}, {0x0328,1,198},
+  {0x032f,1,199}, {0x0331,2,200}, {0x1040,43,202}, {0x1073,1,245},
+  {0x1083,1,246}, {0x108b,2,247}, {0x10a4,3,249}, {0x10a8,3,252},
+  {0x10ad,3,255}, {0x10b2,4,258}, {0x10b9,3,262}, {0x10bf,2,265},
+  {0x10ce,6,267}, {0x10d6,2,273}, {0x10d9,1,275}, {0x10dc,1,276},
+  {0x10de,2,277}, {0x10e3,7,279}, {0x10eb,2,286}, {0x10ee,1,288},
+  {0x10f4,4,289}, {0x10f9,4,293}, {0x1140,4,297}, {0x1149,1,301},
+  {0x1156,2,302}, {0x115e,1,304}, {0x1160,1,305}, {0x1163,6,306},
+  {0x116d,5,312}, {0x1173,1,317}, {0x1175,1,318}, {0x1177,1,319},
+  {0x1179,2,320}, {0x117c,1,322}, {0x117e,1,323}, {0x1181,2,324},
+  {0x1185,2,326}, {0x119c,1,328}, {0x11a4,2,329}, {0x11b5,2,331},
+  {0x11ba,1,333}, {0x11c2,1,334}, {0x11ce,4,335}, {0x11d3,3,339},
+  {0x1268,12,342}, {0x1275,3,354}, {0x12b1,2,357}, {0x12b5,11,359},
+  {0x12c2,8,370}, {0x12cb,11,378}, {0x12df,30,389}, {0x1340,63,419},
+  {0x1380,123,482}, {0x1445,2,605}, {0x1489,2,607}, {0x148c,2,609},
+  {0x1490,1,611}, {0x1494,3,612}, {0x1498,4,615}, {0x14a0,5,619},
+  {0x14a8,2,624}, {0x14ae,2,626}, {0x14be,1,628}, {0x14cc,1,629},
+  {0x189f,94,630}, {0x1940,10,724}, {0x1950,3,734}, {0x1955,3,737},
+  {0x195b,4,740}, {0x1972,13,744}, {0x1980,49,757}, {0x19ba,1,806},
+  {0x19be,1,807}, {0x19c7,3,808}, {0x19cb,1,811}, {0x19cf,1,812},
+  {0x19d2,1,813}, {0x19d4,1,814}, {0x19d9,1,815}, {0x19dc,6,816},
+  {0x1b23,2,822}, {0x1b26,1,824}, {0x1b28,1,825}, {0x1b2f,1,826},
+  {0x1b32,1,827}, {0x1b34,1,828}, {0x1b40,1,829}, {0x1b43,1,830},
+  {0x1b45,3,831}, {0x1b4a,1,834}, {0x1b4e,2,835}, {0x1b52,1,837},
+  {0x1b5c,3,838}, {0x1b60,1,841}, {0x1b68,1,842}, {0x1b6d,3,843},
+  {0x1b71,1,846}, {0x1b73,4,847}, {0x1b78,3,851}, {0x1ba9,2,854},
+  {0x1bad,2,856}, {0x1bb1,1,858}, {0x1bb3,3,859}, {0x1bc3,2,862},
+  {0x1bc6,18,864}, {0x1c22,1,882}, {0x1c28,1,883}, {0x1c2a,1,884},
+  {0x1c2c,8,885}, {0x1c35,4,893}, {0x1c3c,18,897}, {0x1c52,12,915},
+  {0x1c5f,12,927}, {0x1c6d,1,939}, {0x1c72,1,940}, {0x1c74,1,941},
+  {0x1ca1,1,942}, {0x1ca7,1,943}, {0x1cb4,3,944}, {0x1cb9,1,947},
+  {0x1cbb,1,948}, {0x1cca,1,949}, {0x1cce,1,950}, {0x1cd5,1,951},
+  {0x1cdc,1,952}, {0x1ce3,1,953}, {0x1d23,1,954}, {0x1d28,4,955},
+  {0x1d2d,1,959}, {0x1d30,7,960}, {0x1d38,1,967}, {0x1d3b,9,968},
+  {0x1d53,1,977}, {0x1d56,1,978}, {0x1d58,1,979}, {0x1d5a,1,980},
+  {0x1d5c,4,981}, {0x1d63,1,985}, {0x1d65,1,986}, {0x1d67,5,987},
+  {0x1d6f,1,992}, {0x1d72,1,993}, {0x1d76,4,994}, {0x1da7,1,998},
+  {0x1dca,1,999}, {0x1dd2,5,1000}, {0xffff,0,0},
+};
+static const unsigned short eu2i1_bucket[UJ_EMOJI_REV_CHARS>>UJ_EMOJI_REV_SHIFT] =
+{
+  0, 9, 25, 38, 49, 64, 75, 80, 84, 84, 84, 84, 87, 94, 94, 94, 94, 94, 94,
+  94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94,
+  94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94,
+  94, 94, 94, 94, 94, 94, 94, 94, 94, 96, 103, 114, 114, 127, 133, 136, 136,
+  138, 140, 143, 143, 144, 144, 145, 145, 146, 155, 156, 156, 156, 156, 156,
+  156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 157, 157, 162, 165,
+  172, 172, 172, 172, 172, 178, 191, 195, 197, 202, 208, 213, 218, 223, 235,
+  236, 238, 238, 238, 238, 238, 238, 238, 238,
+};
+const uj_emoji_rev_t g_eu2i1_rev = { eu2i1_bucket, eu2i1_runs, eu2i1_values, };
+
+/* ----------------------------------------------------------------------------
+ * eu2i2 (jcode/emoji2/eu2i2.dat): 1191 chars in 246 runs.
+ * ------------------------------------------------------------------------- */
+static const unsigned char eu2i2_values[][2] =
+{
+  {0xf9,0xdc}, {0xf9,0xa7}, {0x81,0x48}, {0xf9,0x86}, {0x81,0xa9},
+  {0x81,0xa8}, {0x81,0xe1}, {0x81,0xe2}, {0xf9,0xfb}, {0x81,0x90},
+  {0xf8,0xa3}, {0xf9,0xc4}, {0x81,0x7b}, {0x81,0x7c}, {0xf9,0x9f},
+  {0x81,0xaa}, {0x81,0xab}, {0x81,0xa5}, {0x81,0xa3}, {0xf8,0xf8},
+  {0xf8,0xf7}, {0xf8,0x9f}, {0xf8,0xb4}, {0xf9,0x5e}, {0xf9,0xb8},
+  {0xf9,0x91}, {0xf8,0xd2}, {0xf9,0xe6}, {0xf9,0xd7}, {0x81,0x7e},
+  {0xf9,0xc1}, {0xf9,0xc1}, {0x81,0x7e}, {0x81,0xa8}, {0x81,0xa9},
+  {0xf8,0xd3}, {0x81,0x80}, {0xf9,0xcf}, {0x81,0x99}, {0xf8,0xd9},
+  {0xf9,0x49}, {0xf9,0xc0}, {0xf9,0x45}, {0xf9,0xa0}, {0xf9,0xf4},
+  {0xf9,0xd6}, {0xf9,0xdb}, {0xf8,0xe3}, {0xf8,0xe8}, {0x81,0xa3},
+  {0x81,0xa5}, {0xf8,0xea}, {0xf8,0xea}, {0xf8,0xd1}, {0xf8,0xe2},
+  {0xf8,0xa1}, {0xf8,0xe4}, {0xf8,0xce}, {0xf8,0xe4}, {0xf8,0xe4},
+  {0xf8,0xe4}, {0xf8,0xd6}, {0xf8,0xdf}, {0xf8,0xa0}, {0xf9,0x77},
+  {0xf9,0x7a}, {0xf8,0xd8}, {0xf8,0xc4}, {0xf9,0xe8}, {0xf8,0xfb},
+  {0xf9,0x81}, {0xf9,0x7d}, {0xf8,0xea}, {0xf8,0xea}, {0xf8,0xbf},
+  {0xf9,0xec}, {0xf9,0x45}, {0xf8,0xea}, {0xf9,0xd5}, {0xf8,0xe6},
+  {0xf8,0xd0}, {0xf8,0xe4}, {0xf9,0xbe}, {0xf9,0x73}, {0xf9,0xbd},
+  {0xf1,0x66}, {0xf8,0xe9}, {0xf9,0x74}, {0xf8,0xc3}, {0xf9,0x47},
+  {0xf8,0xbc}, {0x81,0x40}, {0x20,0x00}, {0xf8,0xe0}, {0xf8,0xe1},
+  {0xf8,0xfc}, {0xf9,0x87}, {0xf9,0x88}, {0xf9,0x89}, {0xf9,0x8a},
+  {0xf9,0x8b}, {0xf9,0x8c}, {0xf9,0x8d}, {0xf9,0x8e}, {0xf9,0x8f},
+  {0x31,0x30}, {0xf8,0xa4}, {0xf8,0xa2}, {0xf8,0xc9}, {0xf8,0xcf},
+  {0xf8,0xcd}, {0xf8,0xc8}, {0xf8,0xcc}, {0xf9,0xc2}, {0xf8,0xc1},
+  {0xf8,0xbe}, {0xf8,0xb7}, {0xf8,0xb6}, {0xf9,0xb7}, {0xf8,0xba},
+  {0xf9,0x50}, {0xf8,0xec}, {0xf9,0x48}, {0xf9,0xed}, {0xf9,0xef},
+  {0xf9,0xe7}, {0xf9,0xf6}, {0xf9,0xee}, {0xf8,0xd4}, {0xf9,0xf6},
+  {0xf9,0xf9}, {0xf9,0x46}, {0xf9,0xf5}, {0xf9,0xfa}, {0xf9,0xcf},
+  {0xf9,0x96}, {0xf9,0xd2}, {0xf9,0xa6}, {0xf9,0xa1}, {0xf9,0xac},
+  {0xf9,0xcd}, {0xf9,0x93}, {0xf9,0x94}, {0xf9,0x9f}, {0xf9,0xa3},
+  {0xf9,0x91}, {0xf9,0x9e}, {0xf8,0xf9}, {0xf9,0xd9}, {0xf9,0xa2},
+  {0xf9,0xad}, {0x93,0xbe}, {0xf9,0xcc}, {0xf8,0xeb}, {0xf8,0xd7},
+  {0xf9,0x9b}, {0xf8,0xdb}, {0xf9,0xb5}, {0x45,0x7a}, {0xf9,0x7b},
+  {0xf8,0xed}, {0x55,0x50}, {0xf8,0xa5}, {0xf8,0xb5}, {0xf8,0xb9},
+  {0xf8,0xe5}, {0xf8,0xef}, {0xf8,0xf0}, {0xf8,0xf1}, {0xf8,0xf2},
+  {0xf8,0xf3}, {0xf8,0xf5}, {0xf8,0xf6}, {0xf9,0x40}, {0xf9,0x80},
+  {0xf9,0x90}, {0xf9,0xb0}, {0xf9,0x99}, {0xf9,0x92}, {0xf9,0xab},
+  {0xf9,0xf1}, {0xf9,0x82}, {0xf9,0xbb}, {0xf9,0xe5}, {0xf9,0x9b},
+  {0xf9,0xcb}, {0xf9,0xfc}, {0xf9,0xc7}, {0xf9,0xbf}, {0xf8,0xe3},
+  {0x56,0x53}, {0xf8,0xc6}, {0xf8,0xc7}, {0xf9,0xe3}, {0xf8,0xca},
+  {0xf8,0xc2}, {0x8a,0x84}, {0x83,0x54}, {0xf9,0x7c}, {0xf9,0xe0},
+  {0xf9,0xde}, {0x8e,0x77}, {0x89,0x63}, {0xf9,0xf0}, {0x8f,0x6a},
+  {0xf8,0xee}, {0xf9,0x91}, {0xf9,0x91}, {0xf9,0x91}, {0xf9,0x91},
+  {0xf9,0x91}, {0xf8,0xb8}, {0xf9,0xc3}, {0xf9,0xf2}, {0xf9,0xea},
+  {0xf9,0x98}, {0xf9,0x9b}, {0xf9,0xcf}, {0xf8,0xa6}, {0xf8,0xca},
+  {0x89,0xc2}, {0xf9,0xf6}, {0xf9,0xf6}, {0x82,0x60}, {0x82,0x61},
+  {0x82,0x6e}, {0x41,0x42}, {0xf8,0xf9}, {0xf8,0xfa}, {0xf9,0x9a},
+  {0xf9,0xa5}, {0xf9,0xa8}, {0xf9,0xa9}, {0xf9,0xaf}, {0xf9,0xe9},
+  {0xf9,0x9d}, {0xf9,0xc9}, {0xf9,0x77}, {0xf9,0x77}, {0xf9,0x91},
+  {0xf9,0xf4}, {0xf9,0xb6}, {0xf9,0xbc}, {0xf9,0xda}, {0xf9,0xe1},
+  {0xf9,0xe2}, {0xf9,0xe4}, {0xf9,0xeb}, {0xf9,0xf8}, {0xf9,0x77},
+  {0xf8,0xf4}, {0xf9,0x85}, {0xf9,0x90}, {0xf9,0x87}, {0xf9,0x88},
+  {0xf9,0x89}, {0xf9,0x8a}, {0xf9,0x8b}, {0xf9,0x8c}, {0xf9,0x8d},
+  {0xf9,0x8e}, {0xf9,0x8f}, {0x31,0x30}, {0x31,0x31}, {0x31,0x32},
+  {0xf9,0x87}, {0xf9,0x88}, {0xf9,0x89}, {0xf9,0x8a}, {0xf9,0x8b},
+  {0xf9,0x8c}, {0xf9,0x8d}, {0xf9,0x8e}, {0xf9,0x8f}, {0x31,0x30},
+  {0x89,0x63}, {0x8f,0x5a}, {0x8c,0xf0}, {0x8b,0x78}, {0x94,0x4e},
+  {0x90,0x45}, {0x90,0xc8}, {0x8e,0x77}, {0xf9,0x86}, {0x82,0x60},
+  {0x93,0xc1}, {0xf9,0xd9}, {0x92,0xb4}, {0x8b,0x7d}, {0x94,0x83},
+  {0x94,0x84}, {0x90,0xc5}, {0x91,0x53}, {0x8c,0x6e}, {0x91,0xb0},
+  {0xf9,0xf9}, {0xf9,0x45}, {0xf9,0x46}, {0xf9,0xf6}, {0xf9,0xf6},
+  {0xf9,0x48}, {0xf9,0x9d}, {0xf9,0xe8}, {0xf9,0xed}, {0xf9,0xea},
+  {0xf9,0xe9}, {0xf8,0xc0}, {0xf8,0xc1}, {0xf8,0xbc}, {0xf8,0xbe},
+  {0xf8,0xc3}, {0xf8,0xc2}, {0xf9,0xc2}, {0xf8,0xd0}, {0xf8,0xcb},
+  {0xf8,0xd4}, {0xf9,0xf1}, {0xf9,0xf0}, {0xf8,0xd3}, {0xf8,0xd2},
+  {0xf8,0xd1}, {0xf8,0xd0}, {0xf8,0xd7}, {0xf8,0xca}, {0xf8,0xca},
+  {0xf8,0xd8}, {0xf8,0xdd}, {0xf9,0xe5}, {0xf8,0xb4}, {0xf8,0xb7},
+  {0xf8,0xb9}, {0xf8,0xb6}, {0xf8,0xb5}, {0xf8,0xb8}, {0xf9,0xb7},
+  {0xf8,0xcd}, {0xf8,0xcc}, {0xf8,0xd0}, {0xf8,0xc7}, {0xf9,0x9c},
+  {0xf8,0xc8}, {0xf9,0xe3}, {0xf8,0xe1}, {0xf8,0xe0}, {0xf8,0x9f},
+  {0xf8,0xa0}, {0xf8,0xa1}, {0xf8,0xa2}, {0xf8,0xa3}, {0x81,0xa9},
+  {0x81,0xa8}, {0xf9,0xe2}, {0xf9,0x7e}, {0xf9,0xda}, {0xf8,0xf4},
+  {0xf8,0xf5}, {0xf8,0xf6}, {0xf9,0x9e}, {0xf9,0x91}, {0xf9,0x94},
+  {0xf8,0xee}, {0xf8,0xf0}, {0xf8,0xf1}, {0xf8,0xef}, {0xf9,0xa9},
+  {0xf9,0xa8}, {0xf9,0x9b}, {0xf9,0xe6}, {0xf9,0xb3}, {0xf9,0xb6},
+  {0xf8,0xfa}, {0xf8,0xd5}, {0xf8,0xe3}, {0xf8,0xfb}, {0xf9,0xc0},
+  {0xf8,0xe9}, {0xf8,0xe9}, {0xf8,0xe8}, {0xf8,0xe8}, {0xf8,0xbb},
+  {0xf9,0x74}, {0xf9,0xbb}, {0xf9,0x5e}, {0xf8,0xe2}, {0xf9,0xa0},
+  {0xf8,0xec}, {0xf8,0xeb}, {0xf8,0xdb}, {0xf8,0xed}, {0xf9,0xbe},
+  {0xf8,0xea}, {0xf8,0xe4}, {0xf8,0xd6}, {0xf9,0xd5}, {0xf8,0xc6},
+  {0xf9,0xbc}, {0xf9,0x77}, {0xf9,0x81}, {0xf8,0xc4}, {0xf8,0xc5},
+  {0xf9,0xb9}, {0xf9,0xa3}, {0xf9,0xbf}, {0xf9,0xc0}, {0xf9,0xba},
+  {0xf9,0x7d}, {0xf8,0xdf}, {0xf8,0xe6}, {0xf9,0xb5}, {0xf8,0xa1},
+  {0xf9,0x56}, {0xf9,0xef}, {0x8f,0x74}, {0x89,0xc4}, {0x8f,0x48},
+  {0x93,0x7e}, {0xf9,0xd3}, {0xf9,0xcf}, {0xf9,0xd2}, {0xf9,0x96},
+  {0xf9,0xd8}, {0xf9,0xd8}, {0xf9,0xd8}, {0xf9,0xd8}, {0xf9,0xf9},
+  {0xf9,0xf9}, {0xf9,0xf9}, {0xf9,0xf9}, {0xf9,0xa0}, {0xf9,0xa0},
+  {0xf9,0xa0}, {0xf9,0xa0}, {0xf8,0x9f}, {0xf8,0x9f}, {0xf8,0x9f},
+  {0xf8,0x9f}, {0xf9,0x93}, {0xf9,0x93}, {0xf9,0x93}, {0xf9,0x93},
+  {0xf9,0x95}, {0xf9,0x95}, {0xf9,0x95}, {0xf9,0x85}, {0xf9,0x90},
+  {0xf9,0x90}, {0xf9,0x87}, {0xf9,0x88}, {0xf9,0x89}, {0xf9,0x8a},
+  {0xf9,0x8b}, {0xf9,0x8c}, {0xf9,0x8d}, {0xf9,0x8e}, {0xf9,0x8f},
+  {0x31,0x30}, {0x2d,0x00}, {0x21,0x00}, {0x81,0x90}, {0x25,0x00},
+  {0x2e,0x00}, {0x2f,0x00}, {0x3a,0x00}, {0x3b,0x00}, {0x40,0x00},
+  {0x5e,0x00}, {0x5f,0x00}, {0x27,0x00}, {0x22,0x00}, {0x81,0x7b},
+  {0x3d,0x00}, {0x81,0x7e}, {0x81,0x80}, {0x81,0x9b}, {0xf9,0x7a},
+  {0xf9,0xb0}, {0xf9,0xd4}, {0x93,0xbe}, {0x8a,0x84}, {0x82,0x81},
+  {0x82,0x82}, {0x82,0x83}, {0x82,0x84}, {0x82,0x85}, {0x82,0x86},
+  {0x82,0x87}, {0x82,0x88}, {0x82,0x89}, {0x82,0x8a}, {0x82,0x8b},
+  {0x82,0x8c}, {0x82,0x8d}, {0x82,0x8e}, {0x82,0x8f}, {0x82,0x90},
+  {0x82,0x91}, {0x82,0x92}, {0x82,0x93}, {0x82,0x94}, {0x82,0x95},
+  {0x82,0x96}, {0x82,0x97}, {0x82,0x98}, {0x82,0x99}, {0x82,0x9a},
+  {0x82,0x60}, {0x82,0x61}, {0x82,0x62}, {0x82,0x63}, {0x82,0x64},
+  {0x82,0x65}, {0x82,0x66}, {0x82,0x67}, {0x82,0x68}, {0x82,0x69},
+  {0x82,0x6a}, {0x82,0x6b}, {0x82,0x6c}, {0x82,0x6d}, {0x82,0x6e},
+  {0x82,0x6f}, {0x82,0x70}, {0x82,0x71}, {0x82,0x72}, {0x82,0x73},
+  {0x82,0x74}, {0x82,0x75}, {0x82,0x76}, {0x82,0x77}, {0x82,0x78},
+  {0x82,0x79}, {0x82,0x9f}, {0x82,0xa0}, {0x82,0xa1}, {0x82,0xa2},
+  {0x82,0xa3}, {0x82,0xa4}, {0x82,0xa5}, {0x82,0xa6}, {0x82,0xa7},
+  {0x82,0xa8}, {0x82,0xa9}, {0x82,0xaa}, {0x82,0xab}, {0x82,0xac},
+  {0x82,0xad}, {0x82,0xae}, {0x82,0xaf}, {0x82,0xb0}, {0x82,0xb1},
+  {0x82,0xb2}, {0x82,0xb3}, {0x82,0xb4}, {0x82,0xb5}, {0x82,0xb6},
+  {0x82,0xb7}, {0x82,0xb8}, {0x82,0xb9}, {0x82,0xba}, {0x82,0xbb},
+  {0x82,0xbc}, {0x82,0xbd}, {0x82,0xbe}, {0x82,0xbf}, {0x82,0xc0},
+  {0x82,0xc1}, {0x82,0xc2}, {0x82,0xc3}, {0x82,0xc4}, {0x82,0xc5},
+  {0x82,0xc6}, {0x82,0xc7}, {0x82,0xc8}, {0x82,0xc9}, {0x82,0xca},
+  {0x82,0xcb}, {0x82,0xcc}, {0x82,0xcd}, {0x82,0xce}, {0x82,0xcf},
+  {0x82,0xd0}, {0x82,0xd1}, {0x82,0xd2}, {0x82,0xd3}, {0x82,0xd4},
+  {0x82,0xd5}, {0x82,0xd6}, {0x82,0xd7}, {0x82,0xd8}, {0x82,0xd9},
+  {0x82,0xda}, {0x82,0xdb}, {0x82,0xdc}, {0x82,0xdd}, {0x82,0xde},
+  {0x82,0xdf}, {0x82,0xe0}, {0x82,0xe1}, {0x82,0xe2}, {0x82,0xe3},
+  {0x82,0xe4}, {0x82,0xe5}, {0x82,0xe6}, {0x82,0xe7}, {0x82,0xe8},
+  {0x82,0xe9}, {0x82,0xea}, {0x82,0xeb}, {0x82,0xed}, {0x82,0xf0},
+  {0x82,0xf1}, {0x83,0x40}, {0x83,0x41}, {0x83,0x42}, {0x83,0x43},
+  {0x83,0x44}, {0x83,0x45}, {0x83,0x46}, {0x83,0x47}, {0x83,0x48},
+  {0x83,0x49}, {0x83,0x4a}, {0x83,0x4b}, {0x83,0x4c}, {0x83,0x4d},
+  {0x83,0x4e}, {0x83,0x4f}, {0x83,0x50}, {0x83,0x51}, {0x83,0x52},
+  {0x83,0x53}, {0x83,0x54}, {0x83,0x55}, {0x83,0x56}, {0x83,0x57},
+  {0x83,0x58}, {0x83,0x59}, {0x83,0x5a}, {0x83,0x5b}, {0x83,0x5c},
+  {0x83,0x5d}, {0x83,0x5e}, {0x83,0x5f}, {0x83,0x60}, {0x83,0x61},
+  {0x83,0x62}, {0x83,0x63}, {0x83,0x64}, {0x83,0x65}, {0x83,0x66},
+  {0x83,0x67}, {0x83,0x68}, {0x83,0x69}, {0x83,0x6a}, {0x83,0x6b},
+  {0x83,0x6c}, {0x83,0x6d}, {0x83,0x6e}, {0x83,0x6f}, {0x83,0x70},
+  {0x83,0x71}, {0x83,0x72}, {0x83,0x73}, {0x83,0x74}, {0x83,0x75},
+  {0x83,0x76}, {0x83,0x77}, {0x83,0x78}, {0x83,0x79}, {0x83,0x7a},
+  {0x83,0x7b}, {0x83,0x7c}, {0x83,0x7d}, {0x83,0x7e}, {0x83,0x80},
+  {0x83,0x81}, {0x83,0x82}, {0x83,0x83}, {0x83,0x84}, {0x83,0x85},
+  {0x83,0x86}, {0x83,0x87}, {0x83,0x88}, {0x83,0x89}, {0x83,0x8a},
+  {0x83,0x8b}, {0x83,0x8c}, {0x83,0x8d}, {0x83,0x8f}, {0x83,0x92},
+  {0x83,0x93}, {0xf8,0xf9}, {0xf8,0xf9}, {0xf8,0xbf}, {0xf8,0xbf},
+  {0xf9,0x47}, {0xf8,0xba}, {0xf9,0xee}, {0xf8,0xce}, {0xf8,0xc9},
+  {0xf8,0xcf}, {0xf8,0xfc}, {0xf8,0xa4}, {0xf8,0xa6}, {0xf9,0x43},
+  {0xf9,0x44}, {0xf8,0xd9}, {0xf8,0xf7}, {0xf8,0xf8}, {0xf9,0x49},
+  {0xf9,0xe1}, {0xf9,0x82}, {0xf9,0xa7}, {0xf9,0x92}, {0xf9,0x84},
+  {0xf9,0x77}, {0xf8,0xf3}, {0xf8,0x9f}, {0xf8,0xa0}, {0xf8,0xa1},
+  {0xf8,0xa2}, {0xf8,0xa3}, {0xf8,0xa4}, {0xf8,0xa5}, {0xf8,0xa6},
+  {0xf8,0xa7}, {0xf8,0xa8}, {0xf8,0xa9}, {0xf8,0xaa}, {0xf8,0xab},
+  {0xf8,0xac}, {0xf8,0xad}, {0xf8,0xae}, {0xf8,0xaf}, {0xf8,0xb0},
+  {0xf8,0xb1}, {0xf8,0xb2}, {0xf8,0xb3}, {0xf8,0xb4}, {0xf8,0xb5},
+  {0xf8,0xb6}, {0xf8,0xb7}, {0xf8,0xb8}, {0xf8,0xb9}, {0xf8,0xba},
+  {0xf8,0xbb}, {0xf8,0xbc}, {0xf8,0xbd}, {0xf8,0xbe}, {0xf8,0xbf},
+  {0xf8,0xc0}, {0xf8,0xc1}, {0xf8,0xc2}, {0xf8,0xc3}, {0xf8,0xc4},
+  {0xf8,0xc5}, {0xf8,0xc6}, {0xf8,0xc7}, {0xf8,0xc8}, {0xf8,0xc9},
+  {0xf8,0xca}, {0xf8,0xcb}, {0xf8,0xcc}, {0xf8,0xcd}, {0xf8,0xce},
+  {0xf8,0xcf}, {0xf8,0xd0}, {0xf8,0xd1}, {0xf8,0xd2}, {0xf8,0xd3},
+  {0xf8,0xd4}, {0xf8,0xd5}, {0xf8,0xd6}, {0xf8,0xd7}, {0xf8,0xd8},
+  {0xf8,0xd9}, {0xf8,0xda}, {0xf8,0xdb}, {0xf8,0xdc}, {0xf8,0xdd},
+  {0xf8,0xde}, {0xf8,0xdf}, {0xf8,0xe0}, {0xf8,0xe1}, {0xf8,0xe2},
+  {0xf8,0xe3}, {0xf8,0xe4}, {0xf8,0xe5}, {0xf8,0xe6}, {0xf8,0xe7},
+  {0xf8,0xe8}, {0xf8,0xe9}, {0xf8,0xea}, {0xf8,0xeb}, {0xf8,0xec},
+  {0xf8,0xed}, {0xf8,0xee}, {0xf8,0xef}, {0xf8,0xf0}, {0xf8,0xf1},
+  {0xf8,0xf2}, {0xf8,0xf3}, {0xf8,0xf4}, {0xf8,0xf5}, {0xf8,0xf6},
+  {0xf8,0xf7}, {0xf8,0xf8}, {0xf8,0xf9}, {0xf8,0xfa}, {0xf8,0xfb},
+  {0xf8,0xfc}, {0xf9,0x40}, {0xf9,0x41}, {0xf9,0x42}, {0xf9,0x43},
+  {0xf9,0x44}, {0xf9,0x45}, {0xf9,0x46}, {0xf9,0x47}, {0xf9,0x48},
+  {0xf9,0x49}, {0xf9,0x50}, {0xf9,0x51}, {0xf9,0x52}, {0xf9,0x55},
+  {0xf9,0x56}, {0xf9,0x57}, {0xf9,0x5b}, {0xf9,0x5c}, {0xf9,0x5d},
+  {0xf9,0x5e}, {0xf9,0x72}, {0xf9,0x73}, {0xf9,0x74}, {0xf9,0x75},
+  {0xf9,0x76}, {0xf9,0x77}, {0xf9,0x78}, {0xf9,0x79}, {0xf9,0x7a},
+  {0xf9,0x7b}, {0xf9,0x7c}, {0xf9,0x7d}, {0xf9,0x7e}, {0xf9,0x80},
+  {0xf9,0x81}, {0xf9,0x82}, {0xf9,0x83}, {0xf9,0x84}, {0xf9,0x85},
+  {0xf9,0x86}, {0xf9,0x87}, {0xf9,0x88}, {0xf9,0x89}, {0xf9,0x8a},
+  {0xf9,0x8b}, {0xf9,0x8c}, {0xf9,0x8d}, {0xf9,0x8e}, {0xf9,0x8f},
+  {0xf9,0x90}, {0xf9,0x91}, {0xf9,0x92}, {0xf9,0x93}, {0xf9,0x94},
+  {0xf9,0x95}, {0xf9,0x96}, {0xf9,0x97}, {0xf9,0x98}, {0xf9,0x99},
+  {0xf9,0x9a}, {0xf9,0x9b}, {0xf9,0x9c}, {0xf9,0x9d}, {0xf9,0x9e},
+  {0xf9,0x9f}, {0xf9,0xa0}, {0xf9,0xa1}, {0xf9,0xa2}, {0xf9,0xa3},
+  {0xf9,0xa4}, {0xf9,0xa5}, {0xf9,0xa6}, {0xf9,0xa7}, {0xf9,0xa8},
+  {0xf9,0xa9}, {0xf9,0xaa}, {0xf9,0xab}, {0xf9,0xac}, {0xf9,0xad},
+  {0xf9,0xae}, {0xf9,0xaf}, {0xf9,0xb0}, {0xf9,0xb1}, {0xf9,0xb2},
+  {0xf9,0xb3}, {0xf9,0xb4}, {0xf9,0xb5}, {0xf9,0xb6}, {0xf9,0xb7},
+  {0xf9,0xb8}, {0xf9,0xb9}, {0xf9,0xba}, {0xf9,0xbb}, {0xf9,0xbc},
+  {0xf9,0xbd}, {0xf9,0xbe}, {0xf9,0xbf}, {0xf9,0xc0}, {0xf9,0xc1},
+  {0xf9,0xc2}, {0xf9,0xc3}, {0xf9,0xc4}, {0xf9,0xc5}, {0xf9,0xc6},
+  {0xf9,0xc7}, {0xf9,0xc8}, {0xf9,0xc9}, {0xf9,0xca}, {0xf9,0xcb},
+  {0xf9,0xcc}, {0xf9,0xcd}, {0xf9,0xce}, {0xf9,0xcf}, {0xf9,0xd0},
+  {0xf9,0xd1}, {0xf9,0xd2}, {0xf9,0xd3}, {0xf9,0xd4}, {0xf9,0xd5},
+  {0xf9,0xd6}, {0xf9,0xd7}, {0xf9,0xd8}, {0xf9,0xd9}, {0xf9,0xda},
+  {0xf9,0xdb}, {0xf9,0xdc}, {0xf9,0xdd}, {0xf9,0xde}, {0xf9,0xdf},
+  {0xf9,0xe0}, {0xf9,0xe1}, {0xf9,0xe2}, {0xf9,0xe3}, {0xf9,0xe4},
+  {0xf9,0xe5}, {0xf9,0xe6}, {0xf9,0xe7}, {0xf9,0xe8}, {0xf9,0xe9},
+  {0xf9,0xea}, {0xf9,0xeb}, {0xf9,0xec}, {0xf9,0xed}, {0xf9,0xee},
+  {0xf9,0xef}, {0xf9,0xf0}, {0xf9,0xf1}, {0xf9,0xf2}, {0xf9,0xf3},
+  {0xf9,0xf4}, {0xf9,0xf5}, {0xf9,0xf6}, {0xf9,0xf7}, {0xf9,0xf8},
+  {0xf9,0xf9}, {0xf9,0xfa}, {0xf9,0xfb}, {0xf9,0xfc}, {0xf9,0x73},
+  {0xf9,0x72}, {0xf9,0xcd}, {0xf9,0xcb}, {0xf9,0xfc}, {0xf9,0xc7},
+  {0xf9,0xfa}, {0xf9,0xbf}, {0xf9,0xa0}, {0xf9,0xe6}, {0xf8,0xe6},
+  {0xf9,0x81}, {0xf9,0xd8}, {0xf9,0xec}, {0xf8,0xd4}, {0xf9,0x9c},
+  {0xf8,0xdf}, {0xf8,0xed}, {0xf8,0xed}, {0xf8,0xeb}, {0x56,0x53},
+  {0xf9,0xba}, {0xf8,0xba}, {0xf9,0xa6}, {0xf8,0xa3}, {0xf8,0xd5},
+  {0xf8,0xcf}, {0xf8,0xe4}, {0xf8,0xc8}, {0xf8,0xce}, {0xf8,0xcd},
+  {0xf8,0xcf}, {0xf8,0xc6}, {0xf8,0xc9}, {0xf8,0xc7}, {0xf8,0xcb},
+  {0xf9,0xe3}, {0xf8,0xca}, {0xf8,0xc1}, {0xf8,0xbf}, {0xf9,0xe8},
+  {0xf8,0xcf}, {0xf8,0xdb}, {0xf9,0xf0}, {0x8f,0x6a}, {0xf8,0xe0},
+  {0xf9,0xa3}, {0xf8,0xd6}, {0xf8,0xe5}, {0xf9,0xd9}, {0xf9,0xb5},
+  {0xf8,0xe3}, {0xf9,0x50}, {0xf9,0xb8}, {0xf9,0x9b}, {0xf9,0x91},
+  {0xf9,0x91}, {0xf9,0x91}, {0xf9,0x91}, {0xf9,0x91}, {0xf9,0x91},
+  {0xf9,0x91}, {0xf9,0x9f}, {0x81,0x99}, {0xf9,0xad}, {0xf9,0xab},
+  {0x81,0x9b}, {0x81,0x7e}, {0xf9,0xa1}, {0x81,0x99}, {0x81,0x48},
+  {0xf9,0xa7}, {0xf9,0xc3}, {0xf9,0xf2}, {0xf9,0xf1}, {0xf9,0xee},
+  {0xf9,0xea}, {0xf8,0xc2}, {0xf8,0xe1}, {0xf8,0xfc}, {0xf8,0xee},
+  {0xf8,0xf0}, {0xf8,0xef}, {0xf8,0xf1}, {0xf9,0x85}, {0xf9,0x84},
+  {0xf9,0x82}, {0x55,0x50}, {0x97,0x4c}, {0x96,0xb3}, {0x8c,0x8e},
+  {0x90,0x5c}, {0xf9,0x87}, {0xf9,0x88}, {0xf9,0x89}, {0xf9,0x8a},
+  {0xf9,0x8b}, {0xf9,0x8c}, {0xf9,0x8d}, {0xf9,0x8e}, {0xf9,0x8f},
+  {0xf9,0x90}, {0x93,0xbe}, {0x8a,0x84}, {0x83,0x54}, {0xf9,0x7c},
+  {0xf9,0xe0}, {0xf9,0xde}, {0x8e,0x77}, {0x89,0x63}, {0x81,0xaa},
+  {0x81,0xab}, {0x81,0xa8}, {0x81,0xa9}, {0xf8,0xd9}, {0xf8,0xf8},
+  {0xf8,0xf7}, {0xf9,0x49}, {0x81,0xa8}, {0x81,0xa9}, {0x81,0xe2},
+  {0x81,0xe1}, {0xf8,0xa7}, {0xf8,0xa8}, {0xf8,0xa9}, {0xf8,0xaa},
+  {0xf8,0xab}, {0xf8,0xac}, {0xf8,0xad}, {0xf8,0xae}, {0xf8,0xaf},
+  {0xf8,0xb0}, {0xf8,0xb1}, {0xf8,0xb2}, {0xf9,0xb0}, {0xf9,0xd6},
+  {0xf9,0xdb}, {0xf9,0xdc}, {0x82,0x69}, {0xf9,0xc8}, {0xf9,0xce},
+  {0xf9,0xd0}, {0xf9,0x98}, {0xf9,0xd3}, {0xf9,0xcf}, {0xf9,0xcf},
+  {0xf9,0x96}, {0xf8,0xf2}, {0xf8,0xf3}, {0xf8,0xb9}, {0xf8,0xc0},
+  {0xf8,0xbe}, {0xf8,0xa6}, {0xf9,0xe4}, {0xf8,0xa4}, {0xf9,0x9e},
+  {0xf9,0xb3}, {0xf8,0xe2}, {0xf8,0xe8}, {0xf8,0xe9}, {0xf9,0x74},
+  {0xf9,0xbb}, {0xf9,0xa2}, {0xf9,0xcc}, {0xf8,0xf4}, {0xf8,0xf5},
+  {0xf8,0xf6}, {0xf8,0xb8}, {0xf8,0xb5}, {0xf8,0xb6}, {0xf8,0xb4},
+  {0xf8,0xb7}, {0xf9,0xf6}, {0xf9,0xf9}, {0xf8,0xbf}, {0xf9,0x47},
+  {0xf8,0xc3}, {0xf8,0xbc}, {0xf8,0xbe}, {0x81,0x48}, {0xf9,0xa7},
+  {0xf9,0x91}, {0xf9,0x93}, {0xf9,0xed}, {0xf9,0x48}, {0xf9,0xc0},
+  {0xf9,0xc0}, {0xf8,0xc4}, {0xf8,0xc5}, {0xf8,0xcc}, {0xf9,0xe5},
+  {0xf8,0xd7}, {0xf8,0xd8}, {0xf9,0x9b}, {0xf9,0x7d}, {0xf8,0xd0},
+  {0xf8,0xd1}, {0xf9,0xef}, {0xf8,0xd3}, {0xf8,0xa2}, {0xf8,0xa0},
+  {0xf8,0x9f}, {0xf8,0xa1}, {0xf9,0x46}, {0xf9,0x45}, {0xf9,0xf6},
+  {0xf9,0xf5}, {0xf9,0xcf}, {0xf9,0x95}, {0xf9,0xd2}, {0xf9,0x96},
+  {0xf8,0xd8}, {0xf9,0xf6}, {0xf9,0xf6}, {0xf9,0xf4}, {0xf9,0x45},
+  {0x82,0x60}, {0x82,0x61}, {0x41,0x42}, {0x82,0x6e}, {0xf8,0xf9},
+  {0xf9,0xd7},
+};
+static const uj_emoji_run_t eu2i2_runs[] =
+{
+  {0x0001,8,0}, {0x000c,1,8}, {0x000e,1,9}, {0x0010,1,10}, {0x0019,6,11},
+  {0x0020,2,17}, {0x002a,5,19}, {0x0030,1,24}, {0x0033,5,25}, {0x0039,2,30},
+  {0x003d,1,32}, {0x003f,4,33}, {0x0044,5,37}, {0x004a,1,42}, {0x004d,2,43},
+  {0x0051,3,45}, {0x0055,1,48}, {0x0058,2,49}, {0x005b,5,51}, {0x0061,1,56},
+  {0x0063,4,57}, {0x0068,1,61}, {0x006a,5,62}, {0x0070,2,67}, {0x0074,1,69},
+  {0x0077,4,70}, {0x007d,1,74}, {0x0085,2,75}, {0x008e,3,77}, {0x0092,2,80},
+  {0x0095,1,82}, {0x0097,2,83}, {0x009b,1,85}, {0x00a1,1,86}, {0x00a6,1,87},
+  {0x00a8,2,88}, {0x00ac,3,90}, {0x00b0,3,93}, {0x00b4,12,96}, {0x00cd,1,108},
+  {0x00cf,2,109}, {0x00d4,2,111}, {0x00d7,3,113}, {0x00db,4,116},
+  {0x00e2,1,120}, {0x00e8,1,121}, {0x00ea,2,122}, {0x00ef,1,124},
+  {0x00f1,2,125}, {0x00f4,3,127}, {0x00f8,1,130}, {0x00fb,2,131},
+  {0x00fe,1,133}, {0x0101,3,134}, {0x0105,8,137}, {0x0110,2,145},
+  {0x0114,1,147}, {0x0117,1,148}, {0x0119,2,149}, {0x011d,1,151},
+  {0x011f,3,152}, {0x0123,1,155}, {0x0126,2,156}, {0x012a,3,158},
+  {0x012f,1,161}, {0x0131,3,162}, {0x0138,1,165}, {0x013a,8,166},
+  {0x0144,5,174}, {0x014a,1,179}, {0x014d,2,180}, {0x0151,1,182},
+  {0x0156,2,183}, {0x015d,3,185}, {0x0162,1,188}, {0x0167,1,189},
+  {0x016b,1,190}, {0x0177,5,191}, {0x017f,7,196}, {0x0190,1,203},
+  {0x0192,1,204}, {0x019e,6,205}, {0x01a5,1,211}, {0x01a7,2,212},
+  {0x01b2,1,214}, {0x01b9,1,215}, {0x01c5,2,216}, {0x01e1,1,218},
+  {0x01ec,1,219}, {0x01fa,1,220}, {0x02c9,1,221}, {0x02cb,1,222},
+  {0x02d4,6,223}, {0x02db,5,229}, {0x02e3,1,234}, {0x02f7,1,235},
+  {0x030b,1,236}, {0x0310,1,237}, {0x031f,1,238}, {0x0323,9,239},
+  {0x032e,2,248}, {0x0331,2,250}, {0x1040,43,252}, {0x1070,1,295},
+  {0x1073,1,296}, {0x1083,1,297}, {0x1085,2,298}, {0x108b,3,300},
+  {0x108f,1,303}, {0x1092,2,304}, {0x10a4,3,306}, {0x10a8,4,309},
+  {0x10ad,9,313}, {0x10b9,3,322}, {0x10bf,2,325}, {0x10c3,1,327},
+  {0x10ce,7,328}, {0x10d6,2,335}, {0x10d9,1,337}, {0x10dc,1,338},
+  {0x10de,2,339}, {0x10e2,8,341}, {0x10eb,5,349}, {0x10f4,4,354},
+  {0x10f9,4,358}, {0x1140,4,362}, {0x1149,2,366}, {0x1151,1,368},
+  {0x1153,1,369}, {0x1156,2,370}, {0x115e,1,372}, {0x1160,1,373},
+  {0x1162,8,374}, {0x116d,5,382}, {0x1173,1,387}, {0x1175,1,388},
+  {0x1177,1,389}, {0x1179,2,390}, {0x117c,3,392}, {0x1180,3,395},
+  {0x1185,2,398}, {0x118b,1,400}, {0x119c,1,401}, {0x11a2,4,402},
+  {0x11b5,3,406}, {0x11ba,1,409}, {0x11c2,1,410}, {0x11c6,1,411},
+  {0x11ce,8,412}, {0x124c,4,420}, {0x1264,16,424}, {0x1275,3,440},
+  {0x12b1,2,443}, {0x12b5,11,445}, {0x12c2,8,456}, {0x12cb,11,464},
+  {0x12df,30,475}, {0x1340,63,505}, {0x1380,123,568}, {0x1445,2,691},
+  {0x1489,2,693}, {0x148c,3,695}, {0x1490,1,698}, {0x1494,3,699},
+  {0x1498,4,702}, {0x14a0,5,706}, {0x14a8,2,711}, {0x14ae,2,713},
+  {0x14be,1,715}, {0x14cc,1,716}, {0x189f,94,717}, {0x1940,10,811},
+  {0x1950,3,821}, {0x1955,3,824}, {0x195b,4,827}, {0x1972,13,831},
+  {0x1980,125,844}, {0x1b23,6,969}, {0x1b2b,1,975}, {0x1b2e,3,976},
+  {0x1b32,1,979}, {0x1b34,2,980}, {0x1b38,1,982}, {0x1b40,1,983},
+  {0x1b43,1,984}, {0x1b45,3,985}, {0x1b4a,1,988}, {0x1b4e,2,989},
+  {0x1b52,1,991}, {0x1b5c,3,992}, {0x1b60,1,995}, {0x1b68,1,996},
+  {0x1b6d,3,997}, {0x1b71,1,1000}, {0x1b73,8,1001}, {0x1ba4,1,1009},
+  {0x1ba9,3,1010}, {0x1bad,2,1013}, {0x1bb1,1,1015}, {0x1bb3,3,1016},
+  {0x1bbc,1,1019}, {0x1bc3,23,1020}, {0x1be0,1,1043}, {0x1be2,1,1044},
+  {0x1be5,1,1045}, {0x1c22,1,1046}, {0x1c28,1,1047}, {0x1c2a,1,1048},
+  {0x1c2c,8,1049}, {0x1c35,4,1057}, {0x1c3c,18,1061}, {0x1c52,12,1079},
+  {0x1c5f,12,1091}, {0x1c6d,3,1103}, {0x1c72,1,1106}, {0x1c74,1,1107},
+  {0x1ca1,1,1108}, {0x1ca5,4,1109}, {0x1cb4,3,1113}, {0x1cb9,1,1116},
+  {0x1cbb,1,1117}, {0x1cca,1,1118}, {0x1cce,1,1119}, {0x1cd5,1,1120},
+  {0x1cdc,1,1121}, {0x1cde,1,1122}, {0x1ce3,1,1123}, {0x1d23,1,1124},
+  {0x1d26,1,1125}, {0x1d28,7,1126}, {0x1d30,7,1133}, {0x1d38,12,1140},
+  {0x1d50,1,1152}, {0x1d53,4,1153}, {0x1d58,1,1157}, {0x1d5a,6,1158},
+  {0x1d63,1,1164}, {0x1d65,7,1165}, {0x1d6f,1,1172}, {0x1d72,1,1173},
+  {0x1d74,6,1174}, {0x1da7,1,1180}, {0x1dc0,1,1181}, {0x1dc2,2,1182},
+  {0x1dca,1,1184}, {0x1dd2,6,1185}, {0xffff,0,0},
+};
+static const unsigned short eu2i2_bucket[UJ_EMOJI_REV_CHARS>>UJ_EMOJI_REV_SHIFT] =
+{
+  0, 11, 27, 39, 53, 67, 78, 86, 90, 90, 90, 90, 96, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 105, 114, 125, 125, 139, 146, 149, 149, 152, 154, 157, 157,
+  158, 158, 159, 159, 160, 169, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 171, 171, 176, 176, 177, 177, 177, 177,
+  177, 183, 195, 201, 205, 210, 216, 221, 227, 231, 241, 242, 246, 246, 246,
+  246, 246, 246, 246, 246,
+};
+const uj_emoji_rev_t g_eu2i2_rev = { eu2i2_bucket, eu2i2_runs, eu2i2_values, };
+
+/* ----------------------------------------------------------------------------
+ * eu2j1 (jcode/emoji2/eu2j.dat): 1189 chars in 251 runs.
+ * ------------------------------------------------------------------------- */
+static const unsigned char eu2j1_values[][2] =
+{
+  {0x02,0x72}, {0x03,0x41}, {0x03,0x40}, {0x82,0x70}, {0x02,0x5b},
+  {0x02,0x5a}, {0x02,0x5d}, {0x02,0x5c}, {0x82,0x89}, {0x01,0x62},
+  {0x81,0x90}, {0x01,0x5d}, {0x81,0x7b}, {0x81,0x7c}, {0x81,0x99},
+  {0x02,0x52}, {0x02,0x53}, {0x81,0xa5}, {0x81,0xa3}, {0x02,0x57},
+  {0x02,0x58}, {0x03,0x6a}, {0x03,0x6c}, {0x03,0x22}, {0x03,0x42},
+  {0x01,0x30}, {0x81,0x7e}, {0x81,0x7e}, {0x02,0x54}, {0x02,0x55},
+  {0x03,0x67}, {0x81,0x80}, {0x03,0x76}, {0x81,0x99}, {0x02,0x56},
+  {0x02,0x59}, {0x03,0x55}, {0x03,0x72}, {0x01,0x2f}, {0x03,0x21},
+  {0x02,0x6e}, {0x02,0x6f}, {0x01,0x3e}, {0x03,0x29}, {0x81,0xa3},
+  {0x81,0xa5}, {0x01,0x68}, {0x03,0x65}, {0x03,0x28}, {0x03,0x6b},
+  {0x01,0x68}, {0x01,0x6e}, {0x01,0x68}, {0x01,0x68}, {0x01,0x68},
+  {0x01,0x45}, {0x03,0x69}, {0x01,0x23}, {0x81,0x8f}, {0x03,0x5d},
+  {0x03,0x56}, {0x01,0x49}, {0x01,0x34}, {0x03,0x5f}, {0x01,0x68},
+  {0x01,0x68}, {0x01,0x7a}, {0x01,0x21}, {0x01,0x38}, {0x03,0x72},
+  {0x02,0x50}, {0x02,0x51}, {0x01,0x68}, {0x01,0x32}, {0x03,0x63},
+  {0x01,0x68}, {0x01,0x23}, {0x03,0x29}, {0x03,0x2a}, {0x03,0x2b},
+  {0x03,0x3d}, {0x03,0x3c}, {0x03,0x3e}, {0x81,0x40}, {0x20,0x00},
+  {0x02,0x28}, {0x02,0x2a}, {0x02,0x29}, {0x02,0x3c}, {0x02,0x3d},
+  {0x02,0x3e}, {0x02,0x3f}, {0x02,0x40}, {0x02,0x41}, {0x02,0x42},
+  {0x02,0x43}, {0x02,0x44}, {0x31,0x30}, {0x03,0x68}, {0x01,0x74},
+  {0x01,0x71}, {0x01,0x6f}, {0x01,0x70}, {0x01,0x6b}, {0x01,0x6d},
+  {0x03,0x5a}, {0x01,0x79}, {0x03,0x3f}, {0x03,0x35}, {0x03,0x33},
+  {0x01,0x52}, {0x01,0x44}, {0x01,0x53}, {0x01,0x50}, {0x03,0x53},
+  {0x03,0x50}, {0x01,0x3b}, {0x03,0x66}, {0x03,0x39}, {0x01,0x40},
+  {0x03,0x74}, {0x03,0x3a}, {0x01,0x29}, {0x03,0x6f}, {0x03,0x75},
+  {0x01,0x2b}, {0x03,0x77}, {0x03,0x79}, {0x03,0x78}, {0x01,0x5c},
+  {0x03,0x79}, {0x01,0x28}, {0x01,0x25}, {0x03,0x43}, {0x03,0x42},
+  {0x81,0x99}, {0x01,0x3d}, {0x01,0x6c}, {0x03,0x42}, {0x03,0x23},
+  {0x01,0x2c}, {0x01,0x3a}, {0x94,0xe9}, {0x03,0x2d}, {0x02,0x46},
+  {0x01,0x3c}, {0x03,0x2e}, {0x01,0x4a}, {0x03,0x5c}, {0x03,0x5e},
+  {0x03,0x61}, {0x03,0x5e}, {0x01,0x33}, {0x45,0x7a}, {0x01,0x46},
+  {0x02,0x33}, {0x01,0x5b}, {0x03,0x34}, {0x02,0x2e}, {0x02,0x2d},
+  {0x02,0x2f}, {0x03,0x31}, {0x03,0x32}, {0x02,0x45}, {0x02,0x6d},
+  {0x03,0x42}, {0x01,0x28}, {0x02,0x32}, {0x03,0x2c}, {0x01,0x48},
+  {0x03,0x57}, {0x03,0x5b}, {0x03,0x5e}, {0x03,0x6e}, {0x03,0x70},
+  {0x03,0x71}, {0x03,0x73}, {0x01,0x26}, {0x01,0x27}, {0x01,0x28},
+  {0x01,0x2a}, {0x01,0x2d}, {0x01,0x2e}, {0x01,0x31}, {0x01,0x36},
+  {0x01,0x37}, {0x01,0x39}, {0x01,0x3e}, {0x01,0x41}, {0x01,0x42},
+  {0x01,0x4d}, {0x01,0x4e}, {0x01,0x51}, {0x01,0x57}, {0x01,0x5f},
+  {0x01,0x66}, {0x01,0x6a}, {0x01,0x73}, {0x01,0x75}, {0x01,0x77},
+  {0x01,0x78}, {0x02,0x22}, {0x02,0x27}, {0x02,0x2b}, {0x02,0x34},
+  {0x02,0x47}, {0x02,0x48}, {0x02,0x49}, {0x02,0x4a}, {0x02,0x4b},
+  {0x02,0x4c}, {0x02,0x4d}, {0x02,0x4e}, {0x02,0x4f}, {0x02,0x70},
+  {0x02,0x71}, {0x8f,0x6a}, {0x02,0x2c}, {0x03,0x42}, {0x03,0x42},
+  {0x03,0x42}, {0x03,0x42}, {0x03,0x42}, {0x03,0x33}, {0x03,0x78},
+  {0x03,0x5e}, {0x03,0x76}, {0x03,0x62}, {0x01,0x78}, {0x03,0x6d},
+  {0x89,0xc2}, {0x01,0x5a}, {0x03,0x39}, {0x03,0x39}, {0x82,0x60},
+  {0x82,0x61}, {0x82,0x6e}, {0x41,0x42}, {0x21,0x3f}, {0x21,0x21},
+  {0x81,0x60}, {0x03,0x37}, {0x03,0x79}, {0x01,0x23}, {0x01,0x23},
+  {0x02,0x21}, {0x03,0x42}, {0x81,0xcc}, {0x01,0x23}, {0x03,0x30},
+  {0x02,0x30}, {0x02,0x45}, {0x02,0x3c}, {0x02,0x3d}, {0x02,0x3e},
+  {0x02,0x3f}, {0x02,0x40}, {0x02,0x41}, {0x02,0x42}, {0x02,0x43},
+  {0x02,0x44}, {0x31,0x30}, {0x31,0x31}, {0x31,0x32}, {0x02,0x3c},
+  {0x02,0x3d}, {0x02,0x3e}, {0x02,0x3f}, {0x02,0x40}, {0x02,0x41},
+  {0x02,0x42}, {0x02,0x43}, {0x02,0x44}, {0x31,0x30}, {0x02,0x4d},
+  {0x8f,0x5a}, {0x8c,0xf0}, {0x8b,0x78}, {0x94,0x4e}, {0x90,0x45},
+  {0x90,0xc8}, {0x02,0x4c}, {0x82,0x70}, {0x82,0x60}, {0x93,0xc1},
+  {0x94,0xe9}, {0x92,0xb4}, {0x8b,0x7d}, {0x94,0x83}, {0x94,0x84},
+  {0x90,0xc5}, {0x91,0x53}, {0x8c,0x6e}, {0x91,0xb0}, {0x03,0x73},
+  {0x03,0x70}, {0x03,0x3a}, {0x01,0x29}, {0x03,0x72}, {0x03,0x6f},
+  {0x03,0x74}, {0x03,0x39}, {0x01,0x2a}, {0x03,0x53}, {0x03,0x50},
+  {0x01,0x39}, {0x03,0x24}, {0x03,0x25}, {0x03,0x21}, {0x03,0x22},
+  {0x01,0x5a}, {0x01,0x2c}, {0x03,0x6e}, {0x01,0x3a}, {0x01,0x7a},
+  {0x01,0x79}, {0x03,0x3e}, {0x02,0x21}, {0x03,0x3f}, {0x03,0x3d},
+  {0x02,0x22}, {0x03,0x63}, {0x01,0x76}, {0x01,0x40}, {0x03,0x67},
+  {0x03,0x65}, {0x03,0x63}, {0x03,0x5c}, {0x01,0x78}, {0x01,0x78},
+  {0x01,0x44}, {0x03,0x5d}, {0x03,0x5b}, {0x01,0x6c}, {0x01,0x53},
+  {0x01,0x4d}, {0x01,0x54}, {0x01,0x56}, {0x01,0x55}, {0x03,0x35},
+  {0x03,0x34}, {0x03,0x33}, {0x03,0x33}, {0x01,0x6f}, {0x03,0x5a},
+  {0x01,0x70}, {0x03,0x63}, {0x01,0x75}, {0x01,0x41}, {0x01,0x43},
+  {0x01,0x6d}, {0x01,0x77}, {0x02,0x28}, {0x03,0x6a}, {0x03,0x69},
+  {0x03,0x6b}, {0x03,0x68}, {0x01,0x5d}, {0x02,0x5b}, {0x02,0x5a},
+  {0x02,0x51}, {0x02,0x50}, {0x02,0x4f}, {0x02,0x4e}, {0x03,0x30},
+  {0x03,0x31}, {0x03,0x32}, {0x03,0x23}, {0x01,0x3c}, {0x03,0x42},
+  {0x03,0x42}, {0x02,0x2c}, {0x02,0x2d}, {0x02,0x2f}, {0x02,0x2e},
+  {0x21,0x21}, {0x21,0x3f}, {0x03,0x5e}, {0x01,0x30}, {0x03,0x26},
+  {0x03,0x26}, {0x01,0x5e}, {0x01,0x3e}, {0x03,0x54}, {0x03,0x2a},
+  {0x03,0x2a}, {0x03,0x29}, {0x03,0x29}, {0x03,0x2b}, {0x03,0x2c},
+  {0x03,0x28}, {0x01,0x2f}, {0x01,0x4a}, {0x01,0x48}, {0x03,0x5e},
+  {0x01,0x46}, {0x01,0x2d}, {0x01,0x68}, {0x01,0x68}, {0x01,0x73},
+  {0x01,0x23}, {0x01,0x34}, {0x03,0x56}, {0x03,0x58}, {0x03,0x57},
+  {0x01,0x33}, {0x01,0x2e}, {0x03,0x55}, {0x01,0x4f}, {0x03,0x5f},
+  {0x01,0x64}, {0x01,0x36}, {0x03,0x61}, {0x01,0x62}, {0x01,0x45},
+  {0x01,0x32}, {0x03,0x6b}, {0x03,0x7a}, {0x03,0x66}, {0x8f,0x74},
+  {0x89,0xc4}, {0x8f,0x48}, {0x93,0x7e}, {0x03,0x77}, {0x03,0x78},
+  {0x03,0x79}, {0x01,0x35}, {0x01,0x35}, {0x01,0x35}, {0x01,0x35},
+  {0x03,0x3a}, {0x03,0x3a}, {0x03,0x3a}, {0x03,0x3a}, {0x01,0x2f},
+  {0x01,0x2f}, {0x01,0x2f}, {0x01,0x2f}, {0x03,0x6a}, {0x03,0x6a},
+  {0x03,0x6a}, {0x03,0x6a}, {0x03,0x43}, {0x03,0x43}, {0x03,0x43},
+  {0x03,0x43}, {0x03,0x77}, {0x03,0x77}, {0x03,0x77}, {0x02,0x30},
+  {0x02,0x45}, {0x02,0x45}, {0x02,0x3c}, {0x02,0x3d}, {0x02,0x3e},
+  {0x02,0x3f}, {0x02,0x40}, {0x02,0x41}, {0x02,0x42}, {0x02,0x43},
+  {0x02,0x44}, {0x31,0x30}, {0x2d,0x00}, {0x21,0x00}, {0x81,0x90},
+  {0x25,0x00}, {0x2e,0x00}, {0x2f,0x00}, {0x3a,0x00}, {0x3b,0x00},
+  {0x40,0x00}, {0x5e,0x00}, {0x5f,0x00}, {0x27,0x00}, {0x22,0x00},
+  {0x81,0x7b}, {0x3d,0x00}, {0x81,0x7e}, {0x81,0x80}, {0x81,0x9b},
+  {0x81,0x8f}, {0x02,0x6d}, {0x4e,0x47}, {0x02,0x46}, {0x02,0x47},
+  {0x82,0x81}, {0x82,0x82}, {0x82,0x83}, {0x82,0x84}, {0x82,0x85},
+  {0x82,0x86}, {0x82,0x87}, {0x82,0x88}, {0x82,0x89}, {0x82,0x8a},
+  {0x82,0x8b}, {0x82,0x8c}, {0x82,0x8d}, {0x82,0x8e}, {0x82,0x8f},
+  {0x82,0x90}, {0x82,0x91}, {0x82,0x92}, {0x82,0x93}, {0x82,0x94},
+  {0x82,0x95}, {0x82,0x96}, {0x82,0x97}, {0x82,0x98}, {0x82,0x99},
+  {0x82,0x9a}, {0x82,0x60}, {0x82,0x61}, {0x82,0x62}, {0x82,0x63},
+  {0x82,0x64}, {0x82,0x65}, {0x82,0x66}, {0x82,0x67}, {0x82,0x68},
+  {0x82,0x69}, {0x82,0x6a}, {0x82,0x6b}, {0x82,0x6c}, {0x82,0x6d},
+  {0x82,0x6e}, {0x82,0x6f}, {0x82,0x70}, {0x82,0x71}, {0x82,0x72},
+  {0x82,0x73}, {0x82,0x74}, {0x82,0x75}, {0x82,0x76}, {0x82,0x77},
+  {0x82,0x78}, {0x82,0x79}, {0x82,0x9f}, {0x82,0xa0}, {0x82,0xa1},
+  {0x82,0xa2}, {0x82,0xa3}, {0x82,0xa4}, {0x82,0xa5}, {0x82,0xa6},
+  {0x82,0xa7}, {0x82,0xa8}, {0x82,0xa9}, {0x82,0xaa}, {0x82,0xab},
+  {0x82,0xac}, {0x82,0xad}, {0x82,0xae}, {0x82,0xaf}, {0x82,0xb0},
+  {0x82,0xb1}, {0x82,0xb2}, {0x82,0xb3}, {0x82,0xb4}, {0x82,0xb5},
+  {0x82,0xb6}, {0x82,0xb7}, {0x82,0xb8}, {0x82,0xb9}, {0x82,0xba},
+  {0x82,0xbb}, {0x82,0xbc}, {0x82,0xbd}, {0x82,0xbe}, {0x82,0xbf},
+  {0x82,0xc0}, {0x82,0xc1}, {0x82,0xc2}, {0x82,0xc3}, {0x82,0xc4},
+  {0x82,0xc5}, {0x82,0xc6}, {0x82,0xc7}, {0x82,0xc8}, {0x82,0xc9},
+  {0x82,0xca}, {0x82,0xcb}, {0x82,0xcc}, {0x82,0xcd}, {0x82,0xce},
+  {0x82,0xcf}, {0x82,0xd0}, {0x82,0xd1}, {0x82,0xd2}, {0x82,0xd3},
+  {0x82,0xd4}, {0x82,0xd5}, {0x82,0xd6}, {0x82,0xd7}, {0x82,0xd8},
+  {0x82,0xd9}, {0x82,0xda}, {0x82,0xdb}, {0x82,0xdc}, {0x82,0xdd},
+  {0x82,0xde}, {0x82,0xdf}, {0x82,0xe0}, {0x82,0xe1}, {0x82,0xe2},
+  {0x82,0xe3}, {0x82,0xe4}, {0x82,0xe5}, {0x82,0xe6}, {0x82,0xe7},
+  {0x82,0xe8}, {0x82,0xe9}, {0x82,0xea}, {0x82,0xeb}, {0x82,0xed},
+  {0x82,0xf0}, {0x82,0xf1}, {0x83,0x40}, {0x83,0x41}, {0x83,0x42},
+  {0x83,0x43}, {0x83,0x44}, {0x83,0x45}, {0x83,0x46}, {0x83,0x47},
+  {0x83,0x48}, {0x83,0x49}, {0x83,0x4a}, {0x83,0x4b}, {0x83,0x4c},
+  {0x83,0x4d}, {0x83,0x4e}, {0x83,0x4f}, {0x83,0x50}, {0x83,0x51},
+  {0x83,0x52}, {0x83,0x53}, {0x83,0x54}, {0x83,0x55}, {0x83,0x56},
+  {0x83,0x57}, {0x83,0x58}, {0x83,0x59}, {0x83,0x5a}, {0x83,0x5b},
+  {0x83,0x5c}, {0x83,0x5d}, {0x83,0x5e}, {0x83,0x5f}, {0x83,0x60},
+  {0x83,0x61}, {0x83,0x62}, {0x83,0x63}, {0x83,0x64}, {0x83,0x65},
+  {0x83,0x66}, {0x83,0x67}, {0x83,0x68}, {0x83,0x69}, {0x83,0x6a},
+  {0x83,0x6b}, {0x83,0x6c}, {0x83,0x6d}, {0x83,0x6e}, {0x83,0x6f},
+  {0x83,0x70}, {0x83,0x71}, {0x83,0x72}, {0x83,0x73}, {0x83,0x74},
+  {0x83,0x75}, {0x83,0x76}, {0x83,0x77}, {0x83,0x78}, {0x83,0x79},
+  {0x83,0x7a}, {0x83,0x7b}, {0x83,0x7c}, {0x83,0x7d}, {0x83,0x7e},
+  {0x83,0x80}, {0x83,0x81}, {0x83,0x82}, {0x83,0x83}, {0x83,0x84},
+  {0x83,0x85}, {0x83,0x86}, {0x83,0x87}, {0x83,0x88}, {0x83,0x89},
+  {0x83,0x8a}, {0x83,0x8b}, {0x83,0x8c}, {0x83,0x8d}, {0x83,0x8f},
+  {0x83,0x92}, {0x83,0x93}, {0x03,0x24}, {0x03,0x25}, {0x01,0x7a},
+  {0x01,0x7a}, {0x03,0x3c}, {0x01,0x52}, {0x01,0x6e}, {0x01,0x74},
+  {0x01,0x71}, {0x02,0x2a}, {0x02,0x56}, {0x02,0x58}, {0x02,0x57},
+  {0x02,0x59}, {0x81,0xcc}, {0x02,0x32}, {0x03,0x41}, {0x02,0x29},
+  {0x03,0x42}, {0x02,0x31}, {0x01,0x23}, {0x03,0x6a}, {0x03,0x69},
+  {0x03,0x6b}, {0x03,0x68}, {0x01,0x5d}, {0x02,0x5f}, {0x02,0x60},
+  {0x02,0x61}, {0x02,0x62}, {0x02,0x63}, {0x02,0x64}, {0x02,0x65},
+  {0x02,0x66}, {0x02,0x67}, {0x02,0x68}, {0x02,0x69}, {0x02,0x6a},
+  {0x03,0x34}, {0x03,0x35}, {0x03,0x33}, {0x01,0x52}, {0x03,0x3e},
+  {0x03,0x3f}, {0x01,0x7a}, {0x01,0x7a}, {0x01,0x79}, {0x02,0x22},
+  {0x03,0x3d}, {0x03,0x56}, {0x03,0x58}, {0x01,0x73}, {0x01,0x75},
+  {0x01,0x6d}, {0x01,0x74}, {0x01,0x78}, {0x01,0x76}, {0x03,0x5a},
+  {0x01,0x6f}, {0x01,0x6e}, {0x01,0x71}, {0x03,0x63}, {0x03,0x65},
+  {0x03,0x67}, {0x01,0x40}, {0x01,0x5e}, {0x03,0x5c}, {0x03,0x5d},
+  {0x02,0x56}, {0x03,0x5e}, {0x01,0x45}, {0x02,0x28}, {0x03,0x28},
+  {0x01,0x3e}, {0x01,0x68}, {0x01,0x32}, {0x03,0x29}, {0x03,0x2a},
+  {0x01,0x68}, {0x01,0x4a}, {0x01,0x46}, {0x02,0x2c}, {0x02,0x2e},
+  {0x02,0x2d}, {0x02,0x2f}, {0x03,0x30}, {0x03,0x31}, {0x03,0x32},
+  {0x02,0x58}, {0x02,0x57}, {0x02,0x2a}, {0x03,0x72}, {0x03,0x6f},
+  {0x03,0x3c}, {0x03,0x53}, {0x02,0x59}, {0x4f,0x4e}, {0x01,0x24},
+  {0x01,0x23}, {0x03,0x2b}, {0x82,0x89}, {0x82,0x89}, {0x01,0x23},
+  {0x81,0x8f}, {0x02,0x49}, {0x03,0x5f}, {0x01,0x34}, {0x02,0x32},
+  {0x02,0x31}, {0x02,0x30}, {0x82,0x70}, {0x02,0x3c}, {0x02,0x3d},
+  {0x02,0x3e}, {0x02,0x3f}, {0x02,0x40}, {0x02,0x41}, {0x02,0x42},
+  {0x02,0x43}, {0x02,0x44}, {0x02,0x45}, {0x03,0x42}, {0x03,0x42},
+  {0x03,0x43}, {0x03,0x42}, {0x03,0x77}, {0x03,0x79}, {0x03,0x78},
+  {0x03,0x78}, {0x03,0x5e}, {0x01,0x43}, {0x03,0x23}, {0x01,0x2f},
+  {0x03,0x79}, {0x03,0x2d}, {0x01,0x5c}, {0x03,0x41}, {0x21,0x3f},
+  {0x21,0x21}, {0x01,0x28}, {0x01,0x28}, {0x81,0x60}, {0x81,0x60},
+  {0x02,0x6d}, {0x03,0x26}, {0x03,0x33}, {0x01,0x4f}, {0x03,0x2c},
+  {0x01,0x2e}, {0x03,0x54}, {0x01,0x28}, {0x01,0x28}, {0x03,0x79},
+  {0x01,0x26}, {0x03,0x2e}, {0x01,0x25}, {0x03,0x77}, {0x03,0x78},
+  {0x4e,0x47}, {0x02,0x6e}, {0x01,0x35}, {0x94,0xe9}, {0x02,0x6f},
+  {0x02,0x72}, {0x8b,0xd6}, {0x02,0x4b}, {0x8d,0x87}, {0x02,0x4a},
+  {0x81,0xcc}, {0x01,0x77}, {0x03,0x5b}, {0x01,0x30}, {0x01,0x38},
+  {0x03,0x50}, {0x03,0x66}, {0x03,0x75}, {0x03,0x39}, {0x03,0x3a},
+  {0x01,0x2b}, {0x01,0x27}, {0x01,0x21}, {0x01,0x22}, {0x01,0x23},
+  {0x01,0x24}, {0x01,0x25}, {0x01,0x26}, {0x01,0x27}, {0x01,0x28},
+  {0x01,0x29}, {0x01,0x2a}, {0x01,0x2b}, {0x01,0x2c}, {0x01,0x2d},
+  {0x01,0x2e}, {0x01,0x2f}, {0x01,0x30}, {0x01,0x31}, {0x01,0x32},
+  {0x01,0x33}, {0x01,0x34}, {0x01,0x35}, {0x01,0x36}, {0x01,0x37},
+  {0x01,0x38}, {0x01,0x39}, {0x01,0x3a}, {0x01,0x3b}, {0x01,0x3c},
+  {0x01,0x3d}, {0x01,0x3e}, {0x01,0x3f}, {0x01,0x40}, {0x01,0x41},
+  {0x01,0x42}, {0x01,0x43}, {0x01,0x44}, {0x01,0x45}, {0x01,0x46},
+  {0x01,0x47}, {0x01,0x48}, {0x01,0x49}, {0x01,0x4a}, {0x01,0x4b},
+  {0x01,0x4c}, {0x01,0x4d}, {0x01,0x4e}, {0x01,0x4f}, {0x01,0x50},
+  {0x01,0x51}, {0x01,0x52}, {0x01,0x53}, {0x01,0x54}, {0x01,0x55},
+  {0x01,0x56}, {0x01,0x57}, {0x01,0x58}, {0x01,0x59}, {0x01,0x5a},
+  {0x01,0x5b}, {0x01,0x5c}, {0x01,0x5d}, {0x01,0x5e}, {0x01,0x5f},
+  {0x01,0x60}, {0x01,0x61}, {0x01,0x62}, {0x01,0x63}, {0x01,0x64},
+  {0x01,0x65}, {0x01,0x66}, {0x01,0x67}, {0x01,0x68}, {0x01,0x69},
+  {0x01,0x6a}, {0x01,0x6b}, {0x01,0x6c}, {0x01,0x6d}, {0x01,0x6e},
+  {0x01,0x6f}, {0x01,0x70}, {0x01,0x71}, {0x01,0x72}, {0x01,0x73},
+  {0x01,0x74}, {0x01,0x75}, {0x01,0x76}, {0x01,0x77}, {0x01,0x78},
+  {0x01,0x79}, {0x01,0x7a}, {0x01,0x60}, {0x03,0x5e}, {0x8f,0x6a},
+  {0x94,0xe9}, {0x01,0x62}, {0x01,0x3e}, {0x03,0x5e}, {0x03,0x42},
+  {0x03,0x42}, {0x03,0x42}, {0x03,0x42}, {0x03,0x42}, {0x03,0x42},
+  {0x03,0x42}, {0x81,0x99}, {0x01,0x28}, {0x81,0x9b}, {0x81,0x7e},
+  {0x03,0x79}, {0x81,0x99}, {0x03,0x40}, {0x03,0x41}, {0x02,0x21},
+  {0x02,0x22}, {0x02,0x23}, {0x02,0x24}, {0x02,0x25}, {0x02,0x26},
+  {0x02,0x27}, {0x02,0x28}, {0x02,0x29}, {0x02,0x2a}, {0x02,0x2b},
+  {0x02,0x2c}, {0x02,0x2d}, {0x02,0x2e}, {0x02,0x2f}, {0x02,0x30},
+  {0x02,0x31}, {0x02,0x32}, {0x02,0x33}, {0x02,0x34}, {0x02,0x35},
+  {0x02,0x36}, {0x02,0x37}, {0x02,0x38}, {0x02,0x39}, {0x02,0x3a},
+  {0x02,0x3b}, {0x02,0x3c}, {0x02,0x3d}, {0x02,0x3e}, {0x02,0x3f},
+  {0x02,0x40}, {0x02,0x41}, {0x02,0x42}, {0x02,0x43}, {0x02,0x44},
+  {0x02,0x45}, {0x02,0x46}, {0x02,0x47}, {0x02,0x48}, {0x02,0x49},
+  {0x02,0x4a}, {0x02,0x4b}, {0x02,0x4c}, {0x02,0x4d}, {0x02,0x4e},
+  {0x02,0x4f}, {0x02,0x50}, {0x02,0x51}, {0x02,0x52}, {0x02,0x53},
+  {0x02,0x54}, {0x02,0x55}, {0x02,0x56}, {0x02,0x57}, {0x02,0x58},
+  {0x02,0x59}, {0x02,0x5a}, {0x02,0x5b}, {0x02,0x5c}, {0x02,0x5d},
+  {0x02,0x5e}, {0x02,0x5f}, {0x02,0x60}, {0x02,0x61}, {0x02,0x62},
+  {0x02,0x63}, {0x02,0x64}, {0x02,0x65}, {0x02,0x66}, {0x02,0x67},
+  {0x02,0x68}, {0x02,0x69}, {0x02,0x6a}, {0x02,0x6b}, {0x02,0x6c},
+  {0x02,0x6d}, {0x02,0x6e}, {0x02,0x6f}, {0x02,0x70}, {0x02,0x71},
+  {0x02,0x72}, {0x02,0x73}, {0x02,0x74}, {0x02,0x75}, {0x02,0x76},
+  {0x02,0x77}, {0x02,0x78}, {0x02,0x79}, {0x02,0x7a}, {0x01,0x28},
+  {0x03,0x78}, {0x03,0x76}, {0x03,0x77}, {0x03,0x79}, {0x01,0x7a},
+  {0x03,0x3f}, {0x03,0x57}, {0x01,0x39}, {0x03,0x6d}, {0x03,0x21},
+  {0x03,0x22}, {0x03,0x23}, {0x03,0x24}, {0x03,0x25}, {0x03,0x26},
+  {0x03,0x27}, {0x03,0x28}, {0x03,0x29}, {0x03,0x2a}, {0x03,0x2b},
+  {0x03,0x2c}, {0x03,0x2d}, {0x03,0x2e}, {0x03,0x2f}, {0x03,0x30},
+  {0x03,0x31}, {0x03,0x32}, {0x03,0x33}, {0x03,0x34}, {0x03,0x35},
+  {0x03,0x36}, {0x03,0x37}, {0x03,0x38}, {0x03,0x39}, {0x03,0x3a},
+  {0x03,0x3b}, {0x03,0x3c}, {0x03,0x3d}, {0x03,0x3e}, {0x03,0x3f},
+  {0x03,0x40}, {0x03,0x41}, {0x03,0x42}, {0x03,0x43}, {0x03,0x44},
+  {0x03,0x45}, {0x03,0x46}, {0x03,0x47}, {0x03,0x48}, {0x03,0x49},
+  {0x03,0x4a}, {0x03,0x4b}, {0x03,0x4c}, {0x03,0x4d}, {0x03,0x4e},
+  {0x03,0x4f}, {0x03,0x50}, {0x03,0x51}, {0x03,0x52}, {0x03,0x53},
+  {0x03,0x54}, {0x03,0x55}, {0x03,0x56}, {0x03,0x57}, {0x03,0x58},
+  {0x03,0x59}, {0x03,0x5a}, {0x03,0x5b}, {0x03,0x5c}, {0x03,0x5d},
+  {0x03,0x5e}, {0x03,0x5f}, {0x03,0x60}, {0x03,0x61}, {0x03,0x62},
+  {0x03,0x63}, {0x03,0x64}, {0x03,0x65}, {0x03,0x66}, {0x03,0x67},
+  {0x03,0x68}, {0x03,0x69}, {0x03,0x6a}, {0x03,0x6b}, {0x03,0x6c},
+  {0x03,0x6d}, {0x03,0x6e}, {0x03,0x6f}, {0x03,0x70}, {0x03,0x71},
+  {0x03,0x72}, {0x03,0x73}, {0x03,0x74}, {0x03,0x75}, {0x03,0x76},
+  {0x03,0x77}, {0x03,0x78}, {0x03,0x79}, {0x03,0x7a}, {0x03,0x5d},
+  {0x01,0x5a}, {0x03,0x39}, {0x03,0x39}, {0x01,0x29}, {0x03,0x72},
+  {0x82,0x60}, {0x82,0x61}, {0x41,0x42}, {0x82,0x6e},
+};
+static const uj_emoji_run_t eu2j1_runs[] =
+{
+  {0x0001,8,0}, {0x000b,1,8}, {0x000d,2,9}, {0x0010,1,11}, {0x001a,5,12},
+  {0x0020,2,17}, {0x002a,3,19}, {0x002f,1,22}, {0x0032,2,23}, {0x0035,1,25},
+  {0x0037,1,26}, {0x003d,1,27}, {0x003f,4,28}, {0x0044,5,32}, {0x004a,1,37},
+  {0x004d,1,38}, {0x0050,4,39}, {0x0055,1,43}, {0x0058,2,44}, {0x005b,1,46},
+  {0x005d,3,47}, {0x0061,1,50}, {0x0063,4,51}, {0x006a,5,55}, {0x0070,1,60},
+  {0x0073,1,61}, {0x0077,4,62}, {0x007d,1,66}, {0x0081,1,67}, {0x0085,2,68},
+  {0x008c,3,70}, {0x0090,1,73}, {0x0092,2,74}, {0x0097,1,76}, {0x009b,1,77},
+  {0x00a1,1,78}, {0x00a6,1,79}, {0x00a8,2,80}, {0x00ac,3,82}, {0x00b1,13,85},
+  {0x00bf,1,98}, {0x00cd,1,99}, {0x00cf,4,100}, {0x00d4,2,104},
+  {0x00d8,2,106}, {0x00dc,4,108}, {0x00e5,1,112}, {0x00e7,1,113},
+  {0x00ea,3,114}, {0x00ef,1,117}, {0x00f2,1,118}, {0x00f5,2,119},
+  {0x00f8,2,121}, {0x00fb,2,123}, {0x00fe,1,125}, {0x0101,3,126},
+  {0x0105,7,129}, {0x010d,1,136}, {0x010f,4,137}, {0x0115,1,141},
+  {0x0117,1,142}, {0x0119,1,143}, {0x011d,5,144}, {0x0123,2,149},
+  {0x0126,1,151}, {0x0128,1,152}, {0x012a,1,153}, {0x012c,1,154},
+  {0x012f,2,155}, {0x0132,1,157}, {0x013a,3,158}, {0x013f,2,161},
+  {0x0145,2,163}, {0x0148,1,165}, {0x014a,1,166}, {0x014e,1,167},
+  {0x0151,2,168}, {0x0154,1,170}, {0x0156,6,171}, {0x015d,16,177},
+  {0x0170,2,193}, {0x0173,1,195}, {0x0175,1,196}, {0x0177,17,197},
+  {0x0189,2,214}, {0x0192,1,216}, {0x019e,6,217}, {0x01a5,1,223},
+  {0x01b9,1,224}, {0x01c5,2,225}, {0x01d5,1,227}, {0x01ec,2,228},
+  {0x01fa,1,230}, {0x02c6,1,231}, {0x02c9,1,232}, {0x02cb,1,233},
+  {0x02d4,4,234}, {0x02dd,3,238}, {0x02ef,1,241}, {0x030b,1,242},
+  {0x0310,1,243}, {0x031f,2,244}, {0x0323,1,246}, {0x0328,1,247},
+  {0x032f,1,248}, {0x0331,2,249}, {0x1040,45,251}, {0x1070,2,296},
+  {0x1073,1,298}, {0x1083,1,299}, {0x1085,3,300}, {0x108b,1,303},
+  {0x108f,2,304}, {0x1098,2,306}, {0x109c,3,308}, {0x10a1,10,311},
+  {0x10ad,3,321}, {0x10b2,1,324}, {0x10b4,2,325}, {0x10b9,3,327},
+  {0x10bd,1,330}, {0x10bf,1,331}, {0x10c3,1,332}, {0x10c7,6,333},
+  {0x10d1,4,339}, {0x10d6,4,343}, {0x10dc,4,347}, {0x10e2,2,351},
+  {0x10e5,5,353}, {0x10eb,2,358}, {0x10f0,13,360}, {0x1140,4,373},
+  {0x1149,2,377}, {0x114e,1,379}, {0x1151,1,380}, {0x1157,1,381},
+  {0x115e,1,382}, {0x1162,5,383}, {0x1168,2,388}, {0x116e,2,390},
+  {0x1171,3,392}, {0x1175,2,395}, {0x1179,2,397}, {0x117e,1,399},
+  {0x1181,2,400}, {0x1185,3,402}, {0x119b,1,405}, {0x11a2,5,406},
+  {0x11a8,1,411}, {0x11b2,1,412}, {0x11b4,3,413}, {0x11ba,1,416},
+  {0x11c3,1,417}, {0x11c6,1,418}, {0x11ce,4,419}, {0x11d3,3,423},
+  {0x124c,4,426}, {0x1264,16,430}, {0x1275,3,446}, {0x12b1,2,449},
+  {0x12b5,11,451}, {0x12c2,8,462}, {0x12cb,11,470}, {0x12df,30,481},
+  {0x1340,63,511}, {0x1380,123,574}, {0x1484,2,697}, {0x1489,2,699},
+  {0x148c,2,701}, {0x1490,1,703}, {0x1494,3,704}, {0x14a0,5,707},
+  {0x14a8,2,712}, {0x14ac,1,714}, {0x14ae,2,715}, {0x14be,1,717},
+  {0x189f,5,718}, {0x18a7,12,723}, {0x18b5,2,735}, {0x18b8,1,737},
+  {0x18ba,1,738}, {0x18bc,1,739}, {0x18be,20,740}, {0x18d3,3,760},
+  {0x18d7,3,763}, {0x18db,1,766}, {0x18df,1,767}, {0x18e1,4,768},
+  {0x18e6,1,772}, {0x18e8,4,773}, {0x18ed,5,777}, {0x18f4,5,782},
+  {0x18fc,1,787}, {0x1945,5,788}, {0x195c,1,793}, {0x1972,6,794},
+  {0x197a,1,800}, {0x197c,2,801}, {0x1981,2,803}, {0x1984,21,805},
+  {0x199b,2,826}, {0x199e,1,828}, {0x19a0,3,829}, {0x19a6,4,832},
+  {0x19ab,2,836}, {0x19ae,3,838}, {0x19b3,1,841}, {0x19b7,1,842},
+  {0x19ba,2,843}, {0x19bf,2,845}, {0x19c7,3,847}, {0x19cb,3,850},
+  {0x19cf,1,853}, {0x19d2,1,854}, {0x19d4,1,855}, {0x19d6,1,856},
+  {0x19d8,2,857}, {0x19db,7,859}, {0x19e3,1,866}, {0x19e5,2,867},
+  {0x19ec,2,869}, {0x19ef,1,871}, {0x19f5,2,872}, {0x19f9,2,874},
+  {0x19fc,1,876}, {0x1b21,90,877}, {0x1ba9,2,967}, {0x1bad,1,969},
+  {0x1bb5,1,970}, {0x1bb7,1,971}, {0x1bc3,1,972}, {0x1bc6,8,973},
+  {0x1bcf,1,981}, {0x1bd1,7,982}, {0x1c21,90,989}, {0x1ca1,1,1079},
+  {0x1ca7,1,1080}, {0x1cb4,3,1081}, {0x1cce,1,1084}, {0x1cd5,1,1085},
+  {0x1cdd,1,1086}, {0x1ce7,1,1087}, {0x1ce9,1,1088}, {0x1d21,90,1089},
+  {0x1da7,1,1179}, {0x1dba,1,1180}, {0x1dc0,1,1181}, {0x1dc2,1,1182},
+  {0x1dc8,1,1183}, {0x1dca,1,1184}, {0x1dd2,4,1185}, {0xffff,0,0},
+};
+static const unsigned short eu2j1_bucket[UJ_EMOJI_REV_CHARS>>UJ_EMOJI_REV_SHIFT] =
+{
+  0, 12, 28, 41, 55, 71, 83, 89, 93, 93, 93, 93, 99, 106, 106, 106, 106, 106,
+  106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+  106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+  106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+  106, 106, 106, 109, 122, 131, 131, 144, 152, 156, 156, 159, 161, 164, 164,
+  165, 165, 166, 166, 166, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 182, 193, 193, 198, 209, 225, 225, 225, 225,
+  225, 225, 226, 230, 234, 234, 235, 238, 243, 243, 244, 246, 251, 251, 251,
+  251, 251, 251, 251, 251,
+};
+const uj_emoji_rev_t g_eu2j1_rev = { eu2j1_bucket, eu2j1_runs, eu2j1_values, };
+
+/* ----------------------------------------------------------------------------
+ * eu2j2 (jcode/emoji2/eu2j2.dat): 1547 chars in 231 runs.
+ * ------------------------------------------------------------------------- */
+static const unsigned char eu2j2_values[][2] =
+{
+  {0x02,0x72}, {0x03,0x41}, {0x03,0x40}, {0x82,0x70}, {0x02,0x5b},
+  {0x02,0x5a}, {0x02,0x5d}, {0x02,0x5c}, {0x82,0x89}, {0x04,0x37},
+  {0x81,0x90}, {0x01,0x5d}, {0x81,0x7b}, {0x81,0x7c}, {0x04,0x4f},
+  {0x02,0x52}, {0x02,0x53}, {0x81,0xa5}, {0x81,0xa3}, {0x02,0x57},
+  {0x02,0x58}, {0x03,0x6a}, {0x03,0x6c}, {0x04,0x45}, {0x03,0x22},
+  {0x03,0x42}, {0x01,0x30}, {0x06,0x57}, {0x81,0x7e}, {0x04,0x53},
+  {0x02,0x54}, {0x02,0x55}, {0x03,0x67}, {0x81,0x80}, {0x05,0x34},
+  {0x04,0x4f}, {0x02,0x56}, {0x02,0x59}, {0x03,0x55}, {0x03,0x72},
+  {0x05,0x6b}, {0x01,0x2f}, {0x06,0x43}, {0x03,0x21}, {0x02,0x6e},
+  {0x02,0x6f}, {0x04,0x43}, {0x03,0x29}, {0x81,0xa3}, {0x81,0xa5},
+  {0x06,0x2c}, {0x01,0x68}, {0x04,0x21}, {0x03,0x65}, {0x03,0x28},
+  {0x03,0x6b}, {0x05,0x4b}, {0x01,0x68}, {0x01,0x6e}, {0x01,0x68},
+  {0x01,0x68}, {0x01,0x68}, {0x04,0x33}, {0x01,0x45}, {0x03,0x69},
+  {0x01,0x23}, {0x81,0x8f}, {0x03,0x5d}, {0x03,0x56}, {0x04,0x24},
+  {0x01,0x49}, {0x01,0x34}, {0x03,0x5f}, {0x01,0x68}, {0x01,0x68},
+  {0x04,0x3a}, {0x01,0x7a}, {0x01,0x21}, {0x01,0x38}, {0x06,0x4a},
+  {0x02,0x50}, {0x02,0x51}, {0x01,0x68}, {0x01,0x32}, {0x03,0x63},
+  {0x01,0x68}, {0x05,0x4f}, {0x01,0x23}, {0x03,0x29}, {0x03,0x2a},
+  {0x03,0x2b}, {0x03,0x3d}, {0x03,0x3c}, {0x03,0x3e}, {0x81,0x40},
+  {0x20,0x00}, {0x04,0x2e}, {0x02,0x28}, {0x02,0x2a}, {0x02,0x29},
+  {0x02,0x3c}, {0x02,0x3d}, {0x02,0x3e}, {0x02,0x3f}, {0x02,0x40},
+  {0x02,0x41}, {0x02,0x42}, {0x02,0x43}, {0x02,0x44}, {0x31,0x30},
+  {0x05,0x63}, {0x03,0x68}, {0x01,0x74}, {0x01,0x71}, {0x01,0x6f},
+  {0x01,0x70}, {0x01,0x6b}, {0x01,0x6d}, {0x03,0x5a}, {0x01,0x79},
+  {0x03,0x3f}, {0x03,0x35}, {0x03,0x33}, {0x01,0x52}, {0x01,0x44},
+  {0x04,0x44}, {0x06,0x29}, {0x01,0x53}, {0x01,0x50}, {0x03,0x53},
+  {0x03,0x50}, {0x01,0x3b}, {0x06,0x2b}, {0x04,0x68}, {0x03,0x66},
+  {0x03,0x39}, {0x04,0x67}, {0x04,0x62}, {0x01,0x40}, {0x03,0x74},
+  {0x06,0x4c}, {0x03,0x3a}, {0x01,0x29}, {0x06,0x51}, {0x03,0x6f},
+  {0x03,0x75}, {0x01,0x2b}, {0x04,0x27}, {0x04,0x25}, {0x05,0x35},
+  {0x05,0x36}, {0x03,0x78}, {0x01,0x5c}, {0x04,0x54}, {0x01,0x28},
+  {0x01,0x25}, {0x03,0x43}, {0x03,0x42}, {0x04,0x4f}, {0x04,0x31},
+  {0x01,0x3d}, {0x01,0x6c}, {0x04,0x49}, {0x03,0x23}, {0x01,0x2c},
+  {0x06,0x56}, {0x01,0x3a}, {0x04,0x35}, {0x03,0x2d}, {0x04,0x50},
+  {0x02,0x46}, {0x01,0x3c}, {0x03,0x2e}, {0x01,0x4a}, {0x03,0x5c},
+  {0x03,0x5e}, {0x03,0x61}, {0x04,0x2a}, {0x04,0x3c}, {0x01,0x33},
+  {0x04,0x3e}, {0x45,0x7a}, {0x01,0x46}, {0x04,0x39}, {0x02,0x33},
+  {0x01,0x5b}, {0x03,0x34}, {0x05,0x4a}, {0x04,0x34}, {0x04,0x6b},
+  {0x02,0x2e}, {0x02,0x2d}, {0x02,0x2f}, {0x05,0x39}, {0x05,0x3b},
+  {0x03,0x31}, {0x03,0x32}, {0x02,0x45}, {0x02,0x6d}, {0x03,0x42},
+  {0x04,0x51}, {0x04,0x60}, {0x02,0x32}, {0x03,0x2c}, {0x01,0x48},
+  {0x03,0x57}, {0x05,0x54}, {0x03,0x5b}, {0x03,0x5e}, {0x03,0x6e},
+  {0x03,0x70}, {0x03,0x71}, {0x03,0x73}, {0x01,0x26}, {0x01,0x27},
+  {0x01,0x28}, {0x01,0x2a}, {0x01,0x2d}, {0x01,0x2e}, {0x01,0x31},
+  {0x01,0x36}, {0x01,0x37}, {0x01,0x39}, {0x01,0x3e}, {0x01,0x41},
+  {0x01,0x42}, {0x01,0x4d}, {0x01,0x4e}, {0x01,0x51}, {0x06,0x31},
+  {0x06,0x32}, {0x01,0x57}, {0x01,0x5f}, {0x01,0x66}, {0x01,0x6a},
+  {0x01,0x73}, {0x01,0x75}, {0x01,0x77}, {0x01,0x78}, {0x02,0x22},
+  {0x02,0x27}, {0x02,0x2b}, {0x02,0x34}, {0x02,0x47}, {0x02,0x48},
+  {0x02,0x49}, {0x02,0x4a}, {0x02,0x4b}, {0x02,0x4c}, {0x02,0x4d},
+  {0x02,0x4e}, {0x02,0x4f}, {0x02,0x70}, {0x02,0x71}, {0x04,0x21},
+  {0x04,0x22}, {0x04,0x23}, {0x04,0x26}, {0x04,0x28}, {0x04,0x2b},
+  {0x04,0x2c}, {0x04,0x2d}, {0x04,0x30}, {0x04,0x32}, {0x04,0x38},
+  {0x04,0x3b}, {0x04,0x3d}, {0x04,0x3f}, {0x04,0x40}, {0x04,0x41},
+  {0x04,0x42}, {0x02,0x2c}, {0x04,0x47}, {0x04,0x4a}, {0x04,0x4b},
+  {0x04,0x4c}, {0x04,0x4d}, {0x03,0x33}, {0x04,0x58}, {0x04,0x59},
+  {0x04,0x5a}, {0x04,0x5b}, {0x04,0x5c}, {0x04,0x5d}, {0x04,0x5e},
+  {0x04,0x5f}, {0x04,0x61}, {0x04,0x63}, {0x04,0x64}, {0x04,0x65},
+  {0x04,0x66}, {0x04,0x69}, {0x04,0x6a}, {0x04,0x6c}, {0x05,0x22},
+  {0x05,0x27}, {0x05,0x2f}, {0x05,0x2e}, {0x04,0x46}, {0x03,0x76},
+  {0x05,0x38}, {0x05,0x3a}, {0x05,0x3c}, {0x05,0x3f}, {0x05,0x40},
+  {0x05,0x41}, {0x05,0x3e}, {0x05,0x45}, {0x05,0x49}, {0x03,0x62},
+  {0x05,0x4c}, {0x05,0x4d}, {0x05,0x50}, {0x05,0x51}, {0x05,0x52},
+  {0x05,0x53}, {0x05,0x56}, {0x05,0x58}, {0x05,0x5b}, {0x05,0x5c},
+  {0x05,0x5f}, {0x05,0x60}, {0x05,0x61}, {0x05,0x62}, {0x05,0x66},
+  {0x05,0x68}, {0x05,0x6b}, {0x05,0x6c}, {0x01,0x78}, {0x05,0x69},
+  {0x06,0x23}, {0x06,0x24}, {0x06,0x25}, {0x06,0x26}, {0x06,0x2d},
+  {0x89,0xc2}, {0x06,0x2e}, {0x06,0x2f}, {0x06,0x30}, {0x06,0x33},
+  {0x06,0x34}, {0x06,0x35}, {0x06,0x36}, {0x06,0x37}, {0x06,0x3a},
+  {0x06,0x3b}, {0x06,0x3c}, {0x06,0x40}, {0x06,0x42}, {0x06,0x45},
+  {0x06,0x46}, {0x06,0x47}, {0x06,0x4b}, {0x06,0x41}, {0x06,0x50},
+  {0x06,0x52}, {0x06,0x53}, {0x06,0x55}, {0x06,0x54}, {0x06,0x56},
+  {0x21,0x3f}, {0x21,0x21}, {0x81,0x60}, {0x03,0x37}, {0x04,0x5a},
+  {0x03,0x79}, {0x01,0x23}, {0x01,0x23}, {0x02,0x21}, {0x04,0x48},
+  {0x06,0x43}, {0x81,0xcc}, {0x05,0x5e}, {0x01,0x23}, {0x03,0x30},
+  {0x02,0x30}, {0x02,0x45}, {0x02,0x3c}, {0x02,0x3d}, {0x02,0x3e},
+  {0x02,0x3f}, {0x02,0x40}, {0x02,0x41}, {0x02,0x42}, {0x02,0x43},
+  {0x02,0x44}, {0x31,0x30}, {0x31,0x31}, {0x31,0x32}, {0x02,0x3c},
+  {0x02,0x3d}, {0x02,0x3e}, {0x02,0x3f}, {0x02,0x40}, {0x02,0x41},
+  {0x02,0x42}, {0x02,0x43}, {0x02,0x44}, {0x31,0x30}, {0x02,0x4d},
+  {0x8f,0x5a}, {0x8c,0xf0}, {0x8b,0x78}, {0x94,0x4e}, {0x90,0x45},
+  {0x90,0xc8}, {0x02,0x4c}, {0x82,0x70}, {0x82,0x60}, {0x93,0xc1},
+  {0x04,0x35}, {0x92,0xb4}, {0x8b,0x7d}, {0x94,0x83}, {0x94,0x84},
+  {0x90,0xc5}, {0x91,0x53}, {0x8c,0x6e}, {0x91,0xb0}, {0x03,0x73},
+  {0x03,0x70}, {0x06,0x4c}, {0x06,0x4d}, {0x03,0x3a}, {0x01,0x29},
+  {0x06,0x4e}, {0x03,0x72}, {0x06,0x4f}, {0x03,0x6f}, {0x06,0x46},
+  {0x03,0x74}, {0x06,0x40}, {0x01,0x2a}, {0x03,0x53}, {0x04,0x24},
+  {0x04,0x25}, {0x03,0x50}, {0x01,0x39}, {0x04,0x66}, {0x04,0x65},
+  {0x04,0x67}, {0x03,0x24}, {0x03,0x25}, {0x03,0x21}, {0x03,0x22},
+  {0x06,0x3a}, {0x05,0x68}, {0x01,0x2c}, {0x03,0x6e}, {0x01,0x3a},
+  {0x05,0x4e}, {0x01,0x79}, {0x03,0x3e}, {0x02,0x21}, {0x03,0x3f},
+  {0x03,0x3d}, {0x02,0x22}, {0x03,0x63}, {0x01,0x76}, {0x01,0x40},
+  {0x04,0x60}, {0x04,0x2b}, {0x03,0x67}, {0x03,0x65}, {0x03,0x63},
+  {0x04,0x64}, {0x03,0x5c}, {0x01,0x78}, {0x01,0x78}, {0x01,0x44},
+  {0x03,0x5d}, {0x03,0x5b}, {0x01,0x6c}, {0x01,0x53}, {0x01,0x4d},
+  {0x01,0x54}, {0x01,0x56}, {0x01,0x55}, {0x05,0x4a}, {0x03,0x35},
+  {0x03,0x34}, {0x03,0x33}, {0x03,0x33}, {0x01,0x6f}, {0x03,0x5a},
+  {0x01,0x70}, {0x03,0x63}, {0x01,0x75}, {0x01,0x41}, {0x01,0x43},
+  {0x01,0x6d}, {0x01,0x77}, {0x02,0x28}, {0x04,0x2e}, {0x03,0x6a},
+  {0x03,0x69}, {0x03,0x6b}, {0x03,0x68}, {0x01,0x5d}, {0x02,0x5b},
+  {0x02,0x5a}, {0x02,0x51}, {0x02,0x50}, {0x02,0x4f}, {0x02,0x4e},
+  {0x03,0x30}, {0x03,0x31}, {0x03,0x32}, {0x03,0x23}, {0x01,0x3c},
+  {0x03,0x42}, {0x03,0x42}, {0x02,0x2c}, {0x02,0x2d}, {0x02,0x2f},
+  {0x02,0x2e}, {0x21,0x21}, {0x21,0x3f}, {0x03,0x5e}, {0x01,0x30},
+  {0x06,0x45}, {0x05,0x59}, {0x03,0x26}, {0x03,0x26}, {0x01,0x5e},
+  {0x04,0x22}, {0x06,0x23}, {0x04,0x43}, {0x03,0x54}, {0x03,0x2a},
+  {0x03,0x2a}, {0x03,0x29}, {0x03,0x29}, {0x03,0x2b}, {0x03,0x2c},
+  {0x03,0x28}, {0x01,0x2f}, {0x01,0x4a}, {0x01,0x48}, {0x04,0x2a},
+  {0x01,0x46}, {0x01,0x2d}, {0x01,0x68}, {0x01,0x68}, {0x04,0x33},
+  {0x01,0x73}, {0x01,0x23}, {0x01,0x34}, {0x03,0x56}, {0x03,0x58},
+  {0x03,0x57}, {0x06,0x26}, {0x01,0x33}, {0x04,0x31}, {0x01,0x2e},
+  {0x03,0x55}, {0x01,0x4f}, {0x03,0x5f}, {0x01,0x64}, {0x01,0x36},
+  {0x04,0x5a}, {0x03,0x61}, {0x04,0x37}, {0x01,0x45}, {0x01,0x32},
+  {0x04,0x3c}, {0x03,0x6b}, {0x04,0x5d}, {0x03,0x7a}, {0x03,0x66},
+  {0x04,0x2c}, {0x04,0x32}, {0x8f,0x74}, {0x89,0xc4}, {0x8f,0x48},
+  {0x93,0x7e}, {0x05,0x28}, {0x05,0x35}, {0x03,0x78}, {0x05,0x36},
+  {0x01,0x35}, {0x01,0x35}, {0x01,0x35}, {0x01,0x35}, {0x03,0x3a},
+  {0x03,0x3a}, {0x03,0x3a}, {0x03,0x3a}, {0x01,0x2f}, {0x01,0x2f},
+  {0x01,0x2f}, {0x01,0x2f}, {0x03,0x6a}, {0x03,0x6a}, {0x03,0x6a},
+  {0x03,0x6a}, {0x03,0x43}, {0x03,0x43}, {0x03,0x43}, {0x03,0x43},
+  {0x03,0x77}, {0x03,0x77}, {0x03,0x77}, {0x02,0x30}, {0x02,0x45},
+  {0x02,0x45}, {0x02,0x3c}, {0x02,0x3d}, {0x02,0x3e}, {0x02,0x3f},
+  {0x02,0x40}, {0x02,0x41}, {0x02,0x42}, {0x02,0x43}, {0x02,0x44},
+  {0x31,0x30}, {0x2d,0x00}, {0x21,0x00}, {0x81,0x90}, {0x25,0x00},
+  {0x2e,0x00}, {0x2f,0x00}, {0x3a,0x00}, {0x3b,0x00}, {0x40,0x00},
+  {0x5e,0x00}, {0x5f,0x00}, {0x27,0x00}, {0x22,0x00}, {0x81,0x7b},
+  {0x3d,0x00}, {0x81,0x7e}, {0x81,0x80}, {0x04,0x52}, {0x81,0x8f},
+  {0x02,0x6d}, {0x4e,0x47}, {0x02,0x46}, {0x02,0x47}, {0x82,0x81},
+  {0x82,0x82}, {0x82,0x83}, {0x82,0x84}, {0x82,0x85}, {0x82,0x86},
+  {0x82,0x87}, {0x82,0x88}, {0x82,0x89}, {0x82,0x8a}, {0x82,0x8b},
+  {0x82,0x8c}, {0x82,0x8d}, {0x82,0x8e}, {0x82,0x8f}, {0x82,0x90},
+  {0x82,0x91}, {0x82,0x92}, {0x82,0x93}, {0x82,0x94}, {0x82,0x95},
+  {0x82,0x96}, {0x82,0x97}, {0x82,0x98}, {0x82,0x99}, {0x82,0x9a},
+  {0x82,0x60}, {0x82,0x61}, {0x82,0x62}, {0x82,0x63}, {0x82,0x64},
+  {0x82,0x65}, {0x82,0x66}, {0x82,0x67}, {0x82,0x68}, {0x82,0x69},
+  {0x82,0x6a}, {0x82,0x6b}, {0x82,0x6c}, {0x82,0x6d}, {0x82,0x6e},
+  {0x82,0x6f}, {0x82,0x70}, {0x82,0x71}, {0x82,0x72}, {0x82,0x73},
+  {0x82,0x74}, {0x82,0x75}, {0x82,0x76}, {0x82,0x77}, {0x82,0x78},
+  {0x82,0x79}, {0x82,0x9f}, {0x82,0xa0}, {0x82,0xa1}, {0x82,0xa2},
+  {0x82,0xa3}, {0x82,0xa4}, {0x82,0xa5}, {0x82,0xa6}, {0x82,0xa7},
+  {0x82,0xa8}, {0x82,0xa9}, {0x82,0xaa}, {0x82,0xab}, {0x82,0xac},
+  {0x82,0xad}, {0x82,0xae}, {0x82,0xaf}, {0x82,0xb0}, {0x82,0xb1},
+  {0x82,0xb2}, {0x82,0xb3}, {0x82,0xb4}, {0x82,0xb5}, {0x82,0xb6},
+  {0x82,0xb7}, {0x82,0xb8}, {0x82,0xb9}, {0x82,0xba}, {0x82,0xbb},
+  {0x82,0xbc}, {0x82,0xbd}, {0x82,0xbe}, {0x82,0xbf}, {0x82,0xc0},
+  {0x82,0xc1}, {0x82,0xc2}, {0x82,0xc3}, {0x82,0xc4}, {0x82,0xc5},
+  {0x82,0xc6}, {0x82,0xc7}, {0x82,0xc8}, {0x82,0xc9}, {0x82,0xca},
+  {0x82,0xcb}, {0x82,0xcc}, {0x82,0xcd}, {0x82,0xce}, {0x82,0xcf},
+  {0x82,0xd0}, {0x82,0xd1}, {0x82,0xd2}, {0x82,0xd3}, {0x82,0xd4},
+  {0x82,0xd5}, {0x82,0xd6}, {0x82,0xd7}, {0x82,0xd8}, {0x82,0xd9},
+  {0x82,0xda}, {0x82,0xdb}, {0x82,0xdc}, {0x82,0xdd}, {0x82,0xde},
+  {0x82,0xdf}, {0x82,0xe0}, {0x82,0xe1}, {0x82,0xe2}, {0x82,0xe3},
+  {0x82,0xe4}, {0x82,0xe5}, {0x82,0xe6}, {0x82,0xe7}, {0x82,0xe8},
+  {0x82,0xe9}, {0x82,0xea}, {0x82,0xeb}, {0x82,0xed}, {0x82,0xf0},
+  {0x82,0xf1}, {0x83,0x40}, {0x83,0x41}, {0x83,0x42}, {0x83,0x43},
+  {0x83,0x44}, {0x83,0x45}, {0x83,0x46}, {0x83,0x47}, {0x83,0x48},
+  {0x83,0x49}, {0x83,0x4a}, {0x83,0x4b}, {0x83,0x4c}, {0x83,0x4d},
+  {0x83,0x4e}, {0x83,0x4f}, {0x83,0x50}, {0x83,0x51}, {0x83,0x52},
+  {0x83,0x53}, {0x83,0x54}, {0x83,0x55}, {0x83,0x56}, {0x83,0x57},
+  {0x83,0x58}, {0x83,0x59}, {0x83,0x5a}, {0x83,0x5b}, {0x83,0x5c},
+  {0x83,0x5d}, {0x83,0x5e}, {0x83,0x5f}, {0x83,0x60}, {0x83,0x61},
+  {0x83,0x62}, {0x83,0x63}, {0x83,0x64}, {0x83,0x65}, {0x83,0x66},
+  {0x83,0x67}, {0x83,0x68}, {0x83,0x69}, {0x83,0x6a}, {0x83,0x6b},
+  {0x83,0x6c}, {0x83,0x6d}, {0x83,0x6e}, {0x83,0x6f}, {0x83,0x70},
+  {0x83,0x71}, {0x83,0x72}, {0x83,0x73}, {0x83,0x74}, {0x83,0x75},
+  {0x83,0x76}, {0x83,0x77}, {0x83,0x78}, {0x83,0x79}, {0x83,0x7a},
+  {0x83,0x7b}, {0x83,0x7c}, {0x83,0x7d}, {0x83,0x7e}, {0x83,0x80},
+  {0x83,0x81}, {0x83,0x82}, {0x83,0x83}, {0x83,0x84}, {0x83,0x85},
+  {0x83,0x86}, {0x83,0x87}, {0x83,0x88}, {0x83,0x89}, {0x83,0x8a},
+  {0x83,0x8b}, {0x83,0x8c}, {0x83,0x8d}, {0x83,0x8f}, {0x83,0x92},
+  {0x83,0x93}, {0x06,0x56}, {0x06,0x56}, {0x06,0x51}, {0x03,0x24},
+  {0x03,0x25}, {0x01,0x7a}, {0x01,0x7a}, {0x03,0x3c}, {0x01,0x52},
+  {0x04,0x62}, {0x01,0x6e}, {0x01,0x74}, {0x01,0x71}, {0x02,0x2a},
+  {0x05,0x63}, {0x05,0x5c}, {0x05,0x6b}, {0x02,0x56}, {0x02,0x58},
+  {0x02,0x57}, {0x02,0x59}, {0x81,0xcc}, {0x02,0x32}, {0x04,0x57},
+  {0x02,0x29}, {0x03,0x42}, {0x02,0x31}, {0x01,0x23}, {0x05,0x3b},
+  {0x03,0x6a}, {0x03,0x69}, {0x03,0x6b}, {0x03,0x68}, {0x01,0x5d},
+  {0x05,0x63}, {0x05,0x5c}, {0x02,0x5f}, {0x02,0x60}, {0x02,0x61},
+  {0x02,0x62}, {0x02,0x63}, {0x02,0x64}, {0x02,0x65}, {0x02,0x66},
+  {0x02,0x67}, {0x02,0x68}, {0x02,0x69}, {0x02,0x6a}, {0x03,0x34},
+  {0x03,0x35}, {0x03,0x33}, {0x05,0x4a}, {0x01,0x52}, {0x03,0x3e},
+  {0x03,0x3f}, {0x01,0x7a}, {0x05,0x4e}, {0x01,0x79}, {0x02,0x22},
+  {0x03,0x3d}, {0x03,0x56}, {0x03,0x58}, {0x01,0x73}, {0x01,0x75},
+  {0x01,0x6d}, {0x01,0x74}, {0x01,0x78}, {0x01,0x76}, {0x03,0x5a},
+  {0x01,0x6f}, {0x01,0x6e}, {0x01,0x71}, {0x03,0x63}, {0x03,0x65},
+  {0x03,0x67}, {0x01,0x40}, {0x01,0x5e}, {0x04,0x33}, {0x03,0x5c},
+  {0x03,0x5d}, {0x02,0x56}, {0x04,0x2a}, {0x01,0x45}, {0x04,0x2e},
+  {0x02,0x28}, {0x03,0x28}, {0x04,0x43}, {0x01,0x68}, {0x04,0x34},
+  {0x01,0x32}, {0x03,0x29}, {0x03,0x2a}, {0x01,0x68}, {0x01,0x4a},
+  {0x01,0x46}, {0x02,0x2c}, {0x02,0x2e}, {0x02,0x2d}, {0x02,0x2f},
+  {0x05,0x39}, {0x05,0x3b}, {0x03,0x30}, {0x03,0x31}, {0x03,0x32},
+  {0x02,0x58}, {0x02,0x57}, {0x06,0x56}, {0x02,0x2a}, {0x03,0x72},
+  {0x03,0x6f}, {0x03,0x3c}, {0x03,0x53}, {0x02,0x59}, {0x04,0x44},
+  {0x4f,0x4e}, {0x01,0x24}, {0x01,0x23}, {0x03,0x2b}, {0x82,0x89},
+  {0x82,0x89}, {0x01,0x23}, {0x81,0x8f}, {0x02,0x49}, {0x03,0x5f},
+  {0x01,0x34}, {0x02,0x32}, {0x02,0x31}, {0x02,0x30}, {0x82,0x70},
+  {0x02,0x3c}, {0x02,0x3d}, {0x02,0x3e}, {0x02,0x3f}, {0x02,0x40},
+  {0x02,0x41}, {0x02,0x42}, {0x02,0x43}, {0x02,0x44}, {0x02,0x45},
+  {0x03,0x42}, {0x03,0x42}, {0x03,0x43}, {0x03,0x42}, {0x03,0x77},
+  {0x05,0x36}, {0x03,0x78}, {0x05,0x27}, {0x03,0x5e}, {0x01,0x43},
+  {0x03,0x23}, {0x04,0x4e}, {0x01,0x2f}, {0x04,0x54}, {0x03,0x2d},
+  {0x04,0x31}, {0x01,0x5c}, {0x04,0x57}, {0x21,0x3f}, {0x21,0x21},
+  {0x04,0x51}, {0x01,0x28}, {0x04,0x50}, {0x81,0x60}, {0x81,0x60},
+  {0x02,0x6d}, {0x03,0x26}, {0x04,0x3c}, {0x03,0x33}, {0x04,0x45},
+  {0x01,0x4f}, {0x03,0x2c}, {0x01,0x2e}, {0x03,0x54}, {0x04,0x58},
+  {0x01,0x28}, {0x05,0x21}, {0x03,0x79}, {0x01,0x26}, {0x03,0x2e},
+  {0x01,0x25}, {0x05,0x25}, {0x05,0x35}, {0x05,0x26}, {0x03,0x78},
+  {0x05,0x28}, {0x4e,0x47}, {0x02,0x6e}, {0x06,0x57}, {0x01,0x35},
+  {0x04,0x35}, {0x02,0x6f}, {0x02,0x72}, {0x8b,0xd6}, {0x02,0x4b},
+  {0x8d,0x87}, {0x02,0x4a}, {0x81,0xcc}, {0x01,0x77}, {0x05,0x5e},
+  {0x03,0x5b}, {0x01,0x30}, {0x04,0x24}, {0x04,0x65}, {0x01,0x38},
+  {0x03,0x50}, {0x04,0x62}, {0x03,0x66}, {0x04,0x2b}, {0x04,0x60},
+  {0x04,0x59}, {0x06,0x43}, {0x03,0x75}, {0x03,0x39}, {0x03,0x3a},
+  {0x01,0x2b}, {0x01,0x27}, {0x01,0x21}, {0x01,0x22}, {0x01,0x23},
+  {0x01,0x24}, {0x01,0x25}, {0x01,0x26}, {0x01,0x27}, {0x01,0x28},
+  {0x01,0x29}, {0x01,0x2a}, {0x01,0x2b}, {0x01,0x2c}, {0x01,0x2d},
+  {0x01,0x2e}, {0x01,0x2f}, {0x01,0x30}, {0x01,0x31}, {0x01,0x32},
+  {0x01,0x33}, {0x01,0x34}, {0x01,0x35}, {0x01,0x36}, {0x01,0x37},
+  {0x01,0x38}, {0x01,0x39}, {0x01,0x3a}, {0x01,0x3b}, {0x01,0x3c},
+  {0x01,0x3d}, {0x01,0x3e}, {0x01,0x3f}, {0x01,0x40}, {0x01,0x41},
+  {0x01,0x42}, {0x01,0x43}, {0x01,0x44}, {0x01,0x45}, {0x01,0x46},
+  {0x01,0x47}, {0x01,0x48}, {0x01,0x49}, {0x01,0x4a}, {0x01,0x4b},
+  {0x01,0x4c}, {0x01,0x4d}, {0x01,0x4e}, {0x01,0x4f}, {0x01,0x50},
+  {0x01,0x51}, {0x01,0x52}, {0x01,0x53}, {0x01,0x54}, {0x01,0x55},
+  {0x01,0x56}, {0x01,0x57}, {0x01,0x58}, {0x01,0x59}, {0x01,0x5a},
+  {0x01,0x5b}, {0x01,0x5c}, {0x01,0x5d}, {0x01,0x5e}, {0x01,0x5f},
+  {0x01,0x60}, {0x01,0x61}, {0x01,0x62}, {0x01,0x63}, {0x01,0x64},
+  {0x01,0x65}, {0x01,0x66}, {0x01,0x67}, {0x01,0x68}, {0x01,0x69},
+  {0x01,0x6a}, {0x01,0x6b}, {0x01,0x6c}, {0x01,0x6d}, {0x01,0x6e},
+  {0x01,0x6f}, {0x01,0x70}, {0x01,0x71}, {0x01,0x72}, {0x01,0x73},
+  {0x01,0x74}, {0x01,0x75}, {0x01,0x76}, {0x01,0x77}, {0x01,0x78},
+  {0x01,0x79}, {0x01,0x7a}, {0x04,0x21}, {0x04,0x22}, {0x04,0x23},
+  {0x04,0x24}, {0x04,0x25}, {0x04,0x26}, {0x04,0x27}, {0x04,0x28},
+  {0x04,0x29}, {0x04,0x2a}, {0x04,0x2b}, {0x04,0x2c}, {0x04,0x2d},
+  {0x04,0x2e}, {0x04,0x2f}, {0x04,0x30}, {0x04,0x31}, {0x04,0x32},
+  {0x04,0x33}, {0x04,0x34}, {0x04,0x35}, {0x04,0x36}, {0x04,0x37},
+  {0x04,0x38}, {0x04,0x39}, {0x04,0x3a}, {0x04,0x3b}, {0x04,0x3c},
+  {0x04,0x3d}, {0x04,0x3e}, {0x04,0x3f}, {0x04,0x40}, {0x04,0x41},
+  {0x04,0x42}, {0x04,0x43}, {0x04,0x44}, {0x04,0x45}, {0x04,0x46},
+  {0x04,0x47}, {0x04,0x48}, {0x04,0x49}, {0x04,0x4a}, {0x04,0x4b},
+  {0x04,0x4c}, {0x04,0x4d}, {0x04,0x4e}, {0x04,0x4f}, {0x04,0x50},
+  {0x04,0x51}, {0x04,0x52}, {0x04,0x53}, {0x04,0x54}, {0x04,0x55},
+  {0x04,0x56}, {0x04,0x57}, {0x04,0x58}, {0x04,0x59}, {0x04,0x5a},
+  {0x04,0x5b}, {0x04,0x5c}, {0x04,0x5d}, {0x04,0x5e}, {0x04,0x5f},
+  {0x04,0x60}, {0x04,0x61}, {0x04,0x62}, {0x04,0x63}, {0x04,0x64},
+  {0x04,0x65}, {0x04,0x66}, {0x04,0x67}, {0x04,0x68}, {0x04,0x69},
+  {0x04,0x6a}, {0x04,0x6b}, {0x04,0x6c}, {0x04,0x6d}, {0x02,0x21},
+  {0x02,0x22}, {0x02,0x23}, {0x02,0x24}, {0x02,0x25}, {0x02,0x26},
+  {0x02,0x27}, {0x02,0x28}, {0x02,0x29}, {0x02,0x2a}, {0x02,0x2b},
+  {0x02,0x2c}, {0x02,0x2d}, {0x02,0x2e}, {0x02,0x2f}, {0x02,0x30},
+  {0x02,0x31}, {0x02,0x32}, {0x02,0x33}, {0x02,0x34}, {0x02,0x35},
+  {0x02,0x36}, {0x02,0x37}, {0x02,0x38}, {0x02,0x39}, {0x02,0x3a},
+  {0x02,0x3b}, {0x02,0x3c}, {0x02,0x3d}, {0x02,0x3e}, {0x02,0x3f},
+  {0x02,0x40}, {0x02,0x41}, {0x02,0x42}, {0x02,0x43}, {0x02,0x44},
+  {0x02,0x45}, {0x02,0x46}, {0x02,0x47}, {0x02,0x48}, {0x02,0x49},
+  {0x02,0x4a}, {0x02,0x4b}, {0x02,0x4c}, {0x02,0x4d}, {0x02,0x4e},
+  {0x02,0x4f}, {0x02,0x50}, {0x02,0x51}, {0x02,0x52}, {0x02,0x53},
+  {0x02,0x54}, {0x02,0x55}, {0x02,0x56}, {0x02,0x57}, {0x02,0x58},
+  {0x02,0x59}, {0x02,0x5a}, {0x02,0x5b}, {0x02,0x5c}, {0x02,0x5d},
+  {0x02,0x5e}, {0x02,0x5f}, {0x02,0x60}, {0x02,0x61}, {0x02,0x62},
+  {0x02,0x63}, {0x02,0x64}, {0x02,0x65}, {0x02,0x66}, {0x02,0x67},
+  {0x02,0x68}, {0x02,0x69}, {0x02,0x6a}, {0x02,0x6b}, {0x02,0x6c},
+  {0x02,0x6d}, {0x02,0x6e}, {0x02,0x6f}, {0x02,0x70}, {0x02,0x71},
+  {0x02,0x72}, {0x02,0x73}, {0x02,0x74}, {0x02,0x75}, {0x02,0x76},
+  {0x02,0x77}, {0x02,0x78}, {0x02,0x79}, {0x02,0x7a}, {0x05,0x21},
+  {0x05,0x22}, {0x05,0x23}, {0x05,0x24}, {0x05,0x25}, {0x05,0x26},
+  {0x05,0x27}, {0x05,0x28}, {0x05,0x29}, {0x05,0x2a}, {0x05,0x2b},
+  {0x05,0x2c}, {0x05,0x2d}, {0x05,0x2e}, {0x05,0x2f}, {0x05,0x30},
+  {0x05,0x31}, {0x05,0x32}, {0x05,0x33}, {0x05,0x34}, {0x05,0x35},
+  {0x05,0x36}, {0x05,0x37}, {0x05,0x38}, {0x05,0x39}, {0x05,0x3a},
+  {0x05,0x3b}, {0x05,0x3c}, {0x05,0x3d}, {0x05,0x3e}, {0x05,0x3f},
+  {0x05,0x40}, {0x05,0x41}, {0x05,0x42}, {0x05,0x43}, {0x05,0x44},
+  {0x05,0x45}, {0x05,0x46}, {0x05,0x47}, {0x05,0x48}, {0x05,0x49},
+  {0x05,0x4a}, {0x05,0x4b}, {0x05,0x4c}, {0x05,0x4d}, {0x05,0x4e},
+  {0x05,0x4f}, {0x05,0x50}, {0x05,0x51}, {0x05,0x52}, {0x05,0x53},
+  {0x05,0x54}, {0x05,0x55}, {0x05,0x56}, {0x05,0x57}, {0x05,0x58},
+  {0x05,0x59}, {0x05,0x5a}, {0x05,0x5b}, {0x05,0x5c}, {0x05,0x5d},
+  {0x05,0x5e}, {0x05,0x5f}, {0x05,0x60}, {0x05,0x61}, {0x05,0x62},
+  {0x05,0x63}, {0x05,0x64}, {0x05,0x65}, {0x05,0x66}, {0x05,0x67},
+  {0x05,0x68}, {0x05,0x69}, {0x05,0x6a}, {0x05,0x6b}, {0x05,0x6c},
+  {0x03,0x21}, {0x03,0x22}, {0x03,0x23}, {0x03,0x24}, {0x03,0x25},
+  {0x03,0x26}, {0x03,0x27}, {0x03,0x28}, {0x03,0x29}, {0x03,0x2a},
+  {0x03,0x2b}, {0x03,0x2c}, {0x03,0x2d}, {0x03,0x2e}, {0x03,0x2f},
+  {0x03,0x30}, {0x03,0x31}, {0x03,0x32}, {0x03,0x33}, {0x03,0x34},
+  {0x03,0x35}, {0x03,0x36}, {0x03,0x37}, {0x03,0x38}, {0x03,0x39},
+  {0x03,0x3a}, {0x03,0x3b}, {0x03,0x3c}, {0x03,0x3d}, {0x03,0x3e},
+  {0x03,0x3f}, {0x03,0x40}, {0x03,0x41}, {0x03,0x42}, {0x03,0x43},
+  {0x03,0x44}, {0x03,0x45}, {0x03,0x46}, {0x03,0x47}, {0x03,0x48},
+  {0x03,0x49}, {0x03,0x4a}, {0x03,0x4b}, {0x03,0x4c}, {0x03,0x4d},
+  {0x03,0x4e}, {0x03,0x4f}, {0x03,0x50}, {0x03,0x51}, {0x03,0x52},
+  {0x03,0x53}, {0x03,0x54}, {0x03,0x55}, {0x03,0x56}, {0x03,0x57},
+  {0x03,0x58}, {0x03,0x59}, {0x03,0x5a}, {0x03,0x5b}, {0x03,0x5c},
+  {0x03,0x5d}, {0x03,0x5e}, {0x03,0x5f}, {0x03,0x60}, {0x03,0x61},
+  {0x03,0x62}, {0x03,0x63}, {0x03,0x64}, {0x03,0x65}, {0x03,0x66},
+  {0x03,0x67}, {0x03,0x68}, {0x03,0x69}, {0x03,0x6a}, {0x03,0x6b},
+  {0x03,0x6c}, {0x03,0x6d}, {0x03,0x6e}, {0x03,0x6f}, {0x03,0x70},
+  {0x03,0x71}, {0x03,0x72}, {0x03,0x73}, {0x03,0x74}, {0x03,0x75},
+  {0x03,0x76}, {0x03,0x77}, {0x03,0x78}, {0x03,0x79}, {0x03,0x7a},
+  {0x06,0x21}, {0x06,0x22}, {0x06,0x23}, {0x06,0x24}, {0x06,0x25},
+  {0x06,0x26}, {0x06,0x27}, {0x06,0x28}, {0x06,0x29}, {0x06,0x2a},
+  {0x06,0x2b}, {0x06,0x2c}, {0x06,0x2d}, {0x06,0x2e}, {0x06,0x2f},
+  {0x06,0x30}, {0x06,0x31}, {0x06,0x32}, {0x06,0x33}, {0x06,0x34},
+  {0x06,0x35}, {0x06,0x36}, {0x06,0x37}, {0x06,0x38}, {0x06,0x39},
+  {0x06,0x3a}, {0x06,0x3b}, {0x06,0x3c}, {0x06,0x3d}, {0x06,0x3e},
+  {0x06,0x3f}, {0x06,0x40}, {0x06,0x41}, {0x06,0x42}, {0x06,0x43},
+  {0x06,0x44}, {0x06,0x45}, {0x06,0x46}, {0x06,0x47}, {0x06,0x48},
+  {0x06,0x49}, {0x06,0x4a}, {0x06,0x4b}, {0x06,0x4c}, {0x06,0x4d},
+  {0x06,0x4e}, {0x06,0x4f}, {0x06,0x50}, {0x06,0x51}, {0x06,0x52},
+  {0x06,0x53}, {0x06,0x54}, {0x06,0x55}, {0x06,0x56}, {0x06,0x57},
+  {0x06,0x58}, {0x06,0x59},
+};
+static const uj_emoji_run_t eu2j2_runs[] =
+{
+  {0x0001,8,0}, {0x000b,1,8}, {0x000d,2,9}, {0x0010,1,11}, {0x001a,5,12},
+  {0x0020,2,17}, {0x002a,3,19}, {0x002f,2,22}, {0x0032,2,24}, {0x0035,3,26},
+  {0x003d,1,29}, {0x003f,4,30}, {0x0044,5,34}, {0x004a,2,39}, {0x004d,2,41},
+  {0x0050,4,43}, {0x0055,1,47}, {0x0058,10,48}, {0x0063,4,58}, {0x0068,1,62},
+  {0x006a,5,63}, {0x0070,2,68}, {0x0073,1,70}, {0x0077,4,71}, {0x007c,2,75},
+  {0x0081,1,77}, {0x0085,2,78}, {0x008c,3,80}, {0x0090,1,83}, {0x0092,3,84},
+  {0x0097,1,87}, {0x009b,1,88}, {0x00a1,1,89}, {0x00a6,1,90}, {0x00a8,2,91},
+  {0x00ac,3,93}, {0x00b0,16,96}, {0x00cd,1,112}, {0x00cf,4,113},
+  {0x00d4,2,117}, {0x00d8,2,119}, {0x00dc,4,121}, {0x00e2,1,125},
+  {0x00e4,2,126}, {0x00e7,1,128}, {0x00ea,6,129}, {0x00f2,11,135},
+  {0x00fe,6,146}, {0x0105,9,152}, {0x010f,4,161}, {0x0114,2,165},
+  {0x0117,1,167}, {0x0119,2,168}, {0x011d,5,170}, {0x0123,2,175},
+  {0x0126,5,177}, {0x012c,2,182}, {0x012f,2,184}, {0x0132,2,186},
+  {0x0138,9,188}, {0x0145,2,197}, {0x0148,1,199}, {0x014a,1,200},
+  {0x014d,2,201}, {0x0151,2,203}, {0x0154,8,205}, {0x015d,16,213},
+  {0x016e,4,229}, {0x0173,1,233}, {0x0175,1,234}, {0x0177,17,235},
+  {0x0189,10,252}, {0x0194,2,262}, {0x0197,13,264}, {0x01a5,1,277},
+  {0x01a7,16,278}, {0x01b8,2,294}, {0x01bf,1,296}, {0x01c2,1,297},
+  {0x01c5,2,298}, {0x01c8,3,300}, {0x01cc,4,303}, {0x01d3,11,307},
+  {0x01e0,2,318}, {0x01e3,4,320}, {0x01e8,10,324}, {0x01f3,1,334},
+  {0x01fa,1,335}, {0x02bc,8,336}, {0x02c6,4,344}, {0x02cb,5,348},
+  {0x02d1,1,353}, {0x02d3,6,354}, {0x02dd,3,360}, {0x02ef,1,363},
+  {0x02f8,1,364}, {0x030b,1,365}, {0x0310,1,366}, {0x031f,2,367},
+  {0x0323,2,369}, {0x0328,1,371}, {0x032a,1,372}, {0x032f,1,373},
+  {0x0331,2,374}, {0x1040,46,376}, {0x106f,6,422}, {0x1083,5,428},
+  {0x108b,1,433}, {0x108d,6,434}, {0x1094,1,440}, {0x1098,2,441},
+  {0x109c,3,443}, {0x10a0,11,446}, {0x10ad,6,457}, {0x10b4,2,463},
+  {0x10b7,1,465}, {0x10b9,3,466}, {0x10bd,1,469}, {0x10bf,1,470},
+  {0x10c3,1,471}, {0x10c7,6,472}, {0x10d0,5,478}, {0x10d6,4,483},
+  {0x10dc,4,487}, {0x10e2,8,491}, {0x10eb,2,499}, {0x10f0,13,501},
+  {0x1140,4,514}, {0x1149,4,518}, {0x114e,1,522}, {0x1151,1,523},
+  {0x1157,1,524}, {0x1159,1,525}, {0x115b,1,526}, {0x115e,1,527},
+  {0x1162,5,528}, {0x1168,2,533}, {0x116e,2,535}, {0x1171,3,537},
+  {0x1175,2,540}, {0x1179,2,542}, {0x117c,1,544}, {0x117e,1,545},
+  {0x1181,2,546}, {0x1185,4,548}, {0x119b,2,552}, {0x11a2,5,554},
+  {0x11a8,1,559}, {0x11ac,1,560}, {0x11b2,1,561}, {0x11b4,4,562},
+  {0x11ba,1,566}, {0x11bd,1,567}, {0x11c3,1,568}, {0x11c6,1,569},
+  {0x11ca,1,570}, {0x11cc,1,571}, {0x11ce,8,572}, {0x124c,4,580},
+  {0x1264,16,584}, {0x1275,3,600}, {0x12b1,2,603}, {0x12b5,11,605},
+  {0x12c2,8,616}, {0x12cb,11,624}, {0x12df,30,635}, {0x1340,63,665},
+  {0x1380,123,728}, {0x1445,2,851}, {0x1480,1,853}, {0x1484,2,854},
+  {0x1489,2,856}, {0x148c,3,858}, {0x1490,1,861}, {0x1494,3,862},
+  {0x1498,2,865}, {0x149c,1,867}, {0x14a0,5,868}, {0x14a8,2,873},
+  {0x14ac,1,875}, {0x14ae,2,876}, {0x14be,1,878}, {0x14cc,1,879},
+  {0x189f,6,880}, {0x18a6,13,886}, {0x18b5,2,899}, {0x18b8,3,901},
+  {0x18bc,1,904}, {0x18be,20,905}, {0x18d3,7,925}, {0x18db,1,932},
+  {0x18df,8,933}, {0x18e8,4,941}, {0x18ed,13,945}, {0x18fc,1,958},
+  {0x1945,5,959}, {0x1950,1,964}, {0x195c,1,965}, {0x1972,6,966},
+  {0x197a,1,972}, {0x197c,2,973}, {0x1981,2,975}, {0x1984,21,977},
+  {0x199b,2,998}, {0x199e,6,1000}, {0x19a6,4,1006}, {0x19ab,6,1010},
+  {0x19b3,1,1016}, {0x19b5,1,1017}, {0x19b7,2,1018}, {0x19ba,2,1020},
+  {0x19bf,2,1022}, {0x19c3,1,1024}, {0x19c7,3,1025}, {0x19cb,6,1028},
+  {0x19d2,3,1034}, {0x19d6,4,1037}, {0x19db,7,1041}, {0x19e3,4,1048},
+  {0x19e8,1,1052}, {0x19ea,1,1053}, {0x19ec,7,1054}, {0x19f4,3,1061},
+  {0x19f9,2,1064}, {0x19fc,1,1066}, {0x1b21,90,1067}, {0x1ba1,77,1157},
+  {0x1c21,90,1234}, {0x1ca1,76,1324}, {0x1d21,90,1400}, {0x1da1,57,1490},
+  {0xffff,0,0},
+};
+static const unsigned short eu2j2_bucket[UJ_EMOJI_REV_CHARS>>UJ_EMOJI_REV_SHIFT] =
+{
+  0, 11, 25, 37, 47, 59, 70, 78, 88, 88, 88, 88, 96, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 106, 119, 127, 127, 143, 153, 158, 158, 161, 163, 166, 166,
+  167, 167, 168, 168, 169, 182, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 188, 195, 195, 201, 211, 225, 225, 225, 225,
+  225, 225, 226, 226, 227, 227, 228, 228, 229, 229, 230, 230, 231, 231, 231,
+  231, 231, 231, 231, 231,
+};
+const uj_emoji_rev_t g_eu2j2_rev = { eu2j2_bucket, eu2j2_runs, eu2j2_values, };
+
+/* ----------------------------------------------------------------------------
+ * eu2d (jcode/emoji2/eu2d.dat): 1503 chars in 248 runs.
+ * ------------------------------------------------------------------------- */
+static const unsigned char eu2d_values[][2] =
+{
+  {0xf4,0xa9}, {0xf4,0xa9}, {0x81,0x48}, {0xf0,0x5f}, {0xf0,0xeb},
+  {0xf0,0xec}, {0x81,0xe1}, {0x81,0xe2}, {0x82,0x89}, {0xf1,0xb4},
+  {0xf2,0xc4}, {0xf0,0xe9}, {0xf2,0xd0}, {0x81,0x7c}, {0x81,0x99},
+  {0x81,0xaa}, {0x81,0xab}, {0x81,0xa5}, {0x81,0xa3}, {0xf4,0xa2},
+  {0xf4,0xa1}, {0xf0,0xe5}, {0xf0,0xce}, {0xf1,0x6d}, {0xf1,0x84},
+  {0xf0,0x9d}, {0xf0,0xf9}, {0xf0,0xb3}, {0xf1,0x4a}, {0xf2,0xd2},
+  {0xf4,0xbc}, {0x81,0x7e}, {0xf4,0xbd}, {0x81,0xa8}, {0x81,0xa9},
+  {0xf0,0xb2}, {0xf2,0xd3}, {0xf1,0x83}, {0xf1,0xd3}, {0x81,0x99},
+  {0xf4,0xa0}, {0xf4,0xa3}, {0xf1,0xa3}, {0xf0,0x73}, {0xf4,0x9c},
+  {0xf1,0x6f}, {0xf0,0x9c}, {0xf1,0x5e}, {0xf1,0x65}, {0xf1,0xb3},
+  {0x81,0xa3}, {0x81,0xa5}, {0xf1,0x79}, {0xf1,0x79}, {0xf0,0xb4},
+  {0xf1,0x6e}, {0xf1,0xba}, {0xf1,0x7a}, {0xf4,0x90}, {0xf1,0x7a},
+  {0xf1,0x7a}, {0xf1,0x7a}, {0xf4,0xbc}, {0xf1,0x7c}, {0xf1,0x83},
+  {0xf1,0xb5}, {0xf0,0xe6}, {0xf1,0x81}, {0xf2,0xd5}, {0xf0,0xbf},
+  {0xf1,0x85}, {0xf0,0x8d}, {0xf1,0x60}, {0xf1,0x82}, {0xf1,0xa5},
+  {0xf1,0x79}, {0xf1,0x79}, {0xf1,0xa9}, {0xf4,0x89}, {0xf4,0xaa},
+  {0xf4,0xab}, {0xf0,0x73}, {0xf1,0x6b}, {0xf1,0x84}, {0xf0,0xf1},
+  {0xf0,0xf0}, {0xf1,0x79}, {0xf1,0x7d}, {0xf1,0xb6}, {0xf0,0xb5},
+  {0xf1,0x7a}, {0xf1,0x77}, {0xf1,0x81}, {0xf1,0x65}, {0xf1,0x7b},
+  {0xf1,0x7b}, {0xf1,0xb0}, {0xf1,0x64}, {0xf4,0xb5}, {0xf1,0x68},
+  {0xf0,0xa9}, {0xf4,0x8c}, {0xf0,0xa6}, {0x81,0x40}, {0x20,0x00},
+  {0xf0,0xe4}, {0xf0,0xe3}, {0xf4,0x96}, {0xf4,0xac}, {0xf0,0x4d},
+  {0xf0,0x4e}, {0xf0,0x4f}, {0xf0,0x50}, {0xf0,0x51}, {0xf0,0x52},
+  {0xf0,0x53}, {0xf0,0x54}, {0xf0,0x55}, {0xf0,0x56}, {0xf4,0x98},
+  {0xf0,0xe8}, {0xf0,0x75}, {0xf0,0x76}, {0xf0,0x77}, {0xf0,0x78},
+  {0xf0,0x79}, {0xf0,0x7a}, {0xf0,0x7b}, {0xf0,0x7c}, {0xf0,0x7e},
+  {0xf0,0x80}, {0xf0,0x81}, {0xf0,0x82}, {0xf0,0x7d}, {0xf4,0x94},
+  {0xf4,0x95}, {0xf0,0xd6}, {0xf0,0xd8}, {0xf0,0xda}, {0xf0,0xdf},
+  {0xf0,0xd7}, {0xf0,0xab}, {0xf0,0xa5}, {0xf0,0xa8}, {0xf0,0xcf},
+  {0xf0,0xd1}, {0xf0,0xd4}, {0xf4,0x8d}, {0xf0,0xbd}, {0xf0,0xc5},
+  {0xf0,0xc8}, {0xf1,0x70}, {0xf0,0x8b}, {0xf0,0x8f}, {0xf1,0xc6},
+  {0xf0,0x86}, {0xf0,0x94}, {0xf4,0x8e}, {0xf0,0xaf}, {0xf0,0x85},
+  {0xf0,0x6d}, {0xf0,0x70}, {0xf0,0x71}, {0xf4,0x80}, {0xf0,0x83},
+  {0xf0,0x8e}, {0xf1,0xd3}, {0xf1,0xd5}, {0xf1,0xd4}, {0xf1,0xd5},
+  {0xf0,0xfa}, {0x81,0x99}, {0xf1,0x9c}, {0xf1,0x44}, {0xf0,0xc7},
+  {0xf0,0xf9}, {0xf0,0xf7}, {0xf0,0xa1}, {0xf4,0x45}, {0xf0,0xa3},
+  {0xf0,0x62}, {0xf0,0xf4}, {0xf2,0xe1}, {0xf0,0xf8}, {0xf1,0x71},
+  {0xf0,0xb9}, {0xf1,0x49}, {0xf1,0xb2}, {0xf1,0x73}, {0xf1,0xb7},
+  {0xf1,0x9b}, {0x45,0x7a}, {0xf1,0x75}, {0x55,0x50}, {0xf0,0xd2},
+  {0xf0,0xd0}, {0xf1,0x41}, {0xf0,0xfc}, {0xf1,0x40}, {0xf4,0xcc},
+  {0xf0,0xf5}, {0xf0,0xf6}, {0xf2,0xb2}, {0xf2,0xdf}, {0xf4,0xae},
+  {0xf0,0xb0}, {0xf4,0xa8}, {0xf1,0x69}, {0xf1,0x72}, {0xf1,0x87},
+  {0xf0,0xc3}, {0xf1,0x49}, {0xf0,0xa2}, {0xf0,0x6c}, {0xf0,0x6b},
+  {0xf0,0xfa}, {0xf0,0x87}, {0xf1,0x76}, {0xf1,0xa2}, {0xf0,0xf7},
+  {0xf1,0xa8}, {0xf0,0x90}, {0xf1,0x5e}, {0xf0,0xdd}, {0xf0,0xc9},
+  {0x56,0x53}, {0xf0,0xe0}, {0xf1,0x7e}, {0xf0,0xdc}, {0xf0,0xe2},
+  {0xf0,0xba}, {0xf0,0xaa}, {0xf2,0xe2}, {0x83,0x54}, {0x49,0x44},
+  {0x96,0x9e}, {0x8b,0xf3}, {0xf0,0x5e}, {0xf0,0x57}, {0xf0,0xf3},
+  {0xf0,0xf2}, {0xf1,0x59}, {0xf0,0xb1}, {0xf1,0xca}, {0x8f,0x6a},
+  {0xf1,0xb8}, {0xf1,0xcc}, {0xf0,0xfb}, {0xf0,0xf9}, {0xf0,0xf9},
+  {0xf0,0xf9}, {0xf0,0xf9}, {0xf0,0xf9}, {0xf0,0xd3}, {0xf1,0xbd},
+  {0xf0,0xb7}, {0xf0,0x92}, {0xf0,0x91}, {0xf1,0x49}, {0xf1,0xd3},
+  {0xf4,0x99}, {0xf0,0xa0}, {0xf4,0x9c}, {0xf0,0xbb}, {0xf1,0x5b},
+  {0xf1,0x88}, {0x89,0xc2}, {0xf0,0x9a}, {0xf0,0x9b}, {0xf0,0x9e},
+  {0xf0,0x86}, {0xf0,0xc2}, {0xf0,0x86}, {0xf1,0x4b}, {0xf0,0x84},
+  {0x82,0x60}, {0x82,0x61}, {0x82,0x6e}, {0x41,0x42}, {0xf4,0x45},
+  {0xf1,0x56}, {0xf1,0x43}, {0xf1,0x42}, {0x81,0x60}, {0xf0,0x95},
+  {0xf0,0x93}, {0xf0,0x6e}, {0xf0,0x8c}, {0xf1,0xac}, {0xf1,0xad},
+  {0xf1,0xaf}, {0xf1,0xd5}, {0xf1,0x81}, {0xf0,0xd5}, {0xf1,0x81},
+  {0xf0,0xa7}, {0xf0,0xf9}, {0xf1,0x53}, {0xf1,0x80}, {0xf0,0xef},
+  {0xf4,0xa4}, {0xf0,0xed}, {0xf1,0x81}, {0xf0,0xf4}, {0xf2,0xb1},
+  {0xf0,0x40}, {0xf0,0x41}, {0xf0,0x42}, {0xf0,0x43}, {0xf0,0x44},
+  {0xf0,0x45}, {0xf0,0x46}, {0xf0,0x47}, {0xf0,0x48}, {0xf0,0x49},
+  {0xf0,0x4a}, {0xf0,0x4b}, {0xf0,0x4c}, {0xf0,0x4d}, {0xf0,0x4e},
+  {0xf0,0x4f}, {0xf0,0x50}, {0xf0,0x51}, {0xf0,0x52}, {0xf0,0x53},
+  {0xf0,0x54}, {0xf0,0x55}, {0xf0,0x56}, {0xf0,0x57}, {0xf0,0x58},
+  {0xf0,0x59}, {0xf0,0x5a}, {0xf0,0x5b}, {0xf0,0x5c}, {0xf0,0x5d},
+  {0xf0,0x5e}, {0xf0,0x5f}, {0xf0,0x60}, {0xf0,0x61}, {0xf0,0x62},
+  {0xf0,0x63}, {0xf0,0x64}, {0xf0,0x65}, {0xf0,0x66}, {0xf0,0x67},
+  {0xf0,0x68}, {0xf0,0x69}, {0xf0,0x6a}, {0xf0,0x6b}, {0xf0,0x6c},
+  {0xf0,0x6d}, {0xf0,0x6e}, {0xf0,0x6f}, {0xf0,0x70}, {0xf0,0x71},
+  {0xf0,0x72}, {0xf0,0x73}, {0xf0,0x74}, {0xf0,0x75}, {0xf0,0x76},
+  {0xf0,0x77}, {0xf0,0x78}, {0xf0,0x79}, {0xf0,0x7a}, {0xf0,0x7b},
+  {0xf0,0x7c}, {0xf0,0x7d}, {0xf0,0x7e}, {0xf0,0x80}, {0xf0,0x81},
+  {0xf0,0x82}, {0xf0,0x83}, {0xf0,0x84}, {0xf0,0x85}, {0xf0,0x86},
+  {0xf0,0x87}, {0xf0,0x88}, {0xf0,0x89}, {0xf0,0x8a}, {0xf0,0x8b},
+  {0xf0,0x8c}, {0xf0,0x8d}, {0xf0,0x8e}, {0xf0,0x8f}, {0xf0,0x90},
+  {0xf0,0x91}, {0xf0,0x92}, {0xf0,0x93}, {0xf0,0x94}, {0xf0,0x95},
+  {0xf0,0x96}, {0xf0,0x97}, {0xf0,0x98}, {0xf0,0x99}, {0xf0,0x9a},
+  {0xf0,0x9b}, {0xf0,0x9c}, {0xf0,0x9d}, {0xf0,0x9e}, {0xf0,0x9f},
+  {0xf0,0xa0}, {0xf0,0xa1}, {0xf0,0xa2}, {0xf0,0xa3}, {0xf0,0xa4},
+  {0xf0,0xa5}, {0xf0,0xa6}, {0xf0,0xa7}, {0xf0,0xa8}, {0xf0,0xa9},
+  {0xf0,0xaa}, {0xf0,0xab}, {0xf0,0xac}, {0xf0,0xad}, {0xf0,0xae},
+  {0xf0,0xaf}, {0xf0,0xb0}, {0xf0,0xb1}, {0xf0,0xb2}, {0xf0,0xb3},
+  {0xf0,0xb4}, {0xf0,0xb5}, {0xf0,0xb6}, {0xf0,0xb7}, {0xf0,0xb8},
+  {0xf0,0xb9}, {0xf0,0xba}, {0xf0,0xbb}, {0xf0,0xbc}, {0xf0,0xbd},
+  {0xf0,0xbe}, {0xf0,0xbf}, {0xf0,0xc0}, {0xf0,0xc1}, {0xf0,0xc2},
+  {0xf0,0xc3}, {0xf0,0xc4}, {0xf0,0xc5}, {0xf0,0xc6}, {0xf0,0xc7},
+  {0xf0,0xc8}, {0xf0,0xc9}, {0xf0,0xca}, {0xf0,0xcb}, {0xf0,0xcc},
+  {0xf0,0xcd}, {0xf0,0xce}, {0xf0,0xcf}, {0xf0,0xd0}, {0xf0,0xd1},
+  {0xf0,0xd2}, {0xf0,0xd3}, {0xf0,0xd4}, {0xf0,0xd5}, {0xf0,0xd6},
+  {0xf0,0xd7}, {0xf0,0xd8}, {0xf0,0xd9}, {0xf0,0xda}, {0xf0,0xdb},
+  {0xf0,0xdc}, {0xf0,0xdd}, {0xf0,0xde}, {0xf0,0xdf}, {0xf0,0xe0},
+  {0xf0,0xe1}, {0xf0,0xe2}, {0xf0,0xe3}, {0xf0,0xe4}, {0xf0,0xe5},
+  {0xf0,0xe6}, {0xf0,0xe7}, {0xf0,0xe8}, {0xf0,0xe9}, {0xf0,0xea},
+  {0xf0,0xeb}, {0xf0,0xec}, {0xf0,0xed}, {0xf0,0xee}, {0xf0,0xef},
+  {0xf0,0xf0}, {0xf0,0xf1}, {0xf0,0xf2}, {0xf0,0xf3}, {0xf0,0xf4},
+  {0xf0,0xf5}, {0xf0,0xf6}, {0xf0,0xf7}, {0xf0,0xf8}, {0xf0,0xf9},
+  {0xf0,0xfa}, {0xf0,0xfb}, {0xf0,0xfc}, {0xf1,0x40}, {0xf1,0x41},
+  {0xf1,0x42}, {0xf1,0x43}, {0xf1,0x44}, {0xf1,0x45}, {0xf1,0x46},
+  {0xf1,0x47}, {0xf1,0x48}, {0xf1,0x49}, {0xf1,0x4a}, {0xf1,0x4b},
+  {0xf1,0x4c}, {0xf1,0x4d}, {0xf1,0x4e}, {0xf1,0x4f}, {0xf1,0x50},
+  {0xf1,0x51}, {0xf1,0x52}, {0xf1,0x53}, {0xf1,0x54}, {0xf1,0x55},
+  {0xf1,0x56}, {0xf1,0x57}, {0xf1,0x58}, {0xf1,0x59}, {0xf1,0x5a},
+  {0xf1,0x5b}, {0xf1,0x5c}, {0xf1,0x5d}, {0xf1,0x5e}, {0xf1,0x5f},
+  {0xf1,0x60}, {0xf1,0x61}, {0xf1,0x62}, {0xf1,0x63}, {0xf1,0x64},
+  {0xf1,0x65}, {0xf1,0x66}, {0xf1,0x67}, {0xf1,0x68}, {0xf1,0x69},
+  {0xf1,0x6a}, {0xf1,0x6b}, {0xf1,0x6c}, {0xf1,0x6d}, {0xf1,0x6e},
+  {0xf1,0x6f}, {0xf1,0x70}, {0xf1,0x71}, {0xf1,0x72}, {0xf1,0x73},
+  {0xf1,0x74}, {0xf1,0x75}, {0xf1,0x76}, {0xf1,0x77}, {0xf1,0x78},
+  {0xf1,0x79}, {0xf1,0x7a}, {0xf1,0x7b}, {0xf1,0x7c}, {0xf1,0x7d},
+  {0xf1,0x7e}, {0xf1,0x80}, {0xf1,0x81}, {0xf1,0x82}, {0xf1,0x83},
+  {0xf1,0x84}, {0xf1,0x85}, {0xf1,0x86}, {0xf1,0x87}, {0xf1,0x88},
+  {0xf1,0x89}, {0xf1,0x8a}, {0xf1,0x8b}, {0xf1,0x8c}, {0xf1,0x8d},
+  {0xf1,0x8e}, {0xf1,0x8f}, {0xf1,0x90}, {0xf1,0x91}, {0xf1,0x92},
+  {0xf1,0x93}, {0xf1,0x94}, {0xf1,0x95}, {0xf1,0x96}, {0xf1,0x97},
+  {0xf1,0x98}, {0xf1,0x99}, {0xf1,0x9a}, {0xf1,0x9b}, {0xf1,0x9c},
+  {0xf1,0x9d}, {0xf1,0x9e}, {0xf1,0x9f}, {0xf1,0xa0}, {0xf1,0xa1},
+  {0xf1,0xa2}, {0xf1,0xa3}, {0xf1,0xa4}, {0xf1,0xa5}, {0xf1,0xa6},
+  {0xf1,0xa7}, {0xf1,0xa8}, {0xf1,0xa9}, {0xf1,0xaa}, {0xf1,0xab},
+  {0xf1,0xac}, {0xf1,0xad}, {0xf1,0xae}, {0xf1,0xaf}, {0xf1,0xb0},
+  {0xf1,0xb1}, {0xf1,0xb2}, {0xf1,0xb3}, {0xf1,0xb4}, {0xf1,0xb5},
+  {0xf1,0xb6}, {0xf1,0xb7}, {0xf1,0xb8}, {0xf1,0xb9}, {0xf1,0xba},
+  {0xf1,0xbb}, {0xf1,0xbc}, {0xf1,0xbd}, {0xf1,0xbe}, {0xf1,0xbf},
+  {0xf1,0xc0}, {0xf1,0xc1}, {0xf1,0xc2}, {0xf1,0xc3}, {0xf1,0xc4},
+  {0xf1,0xc5}, {0xf1,0xc6}, {0xf1,0xc7}, {0xf1,0xc8}, {0xf1,0xc9},
+  {0xf1,0xca}, {0xf1,0xcb}, {0xf1,0xcc}, {0xf1,0xcd}, {0xf1,0xce},
+  {0xf1,0xcf}, {0xf1,0xd0}, {0xf1,0xd1}, {0xf1,0xd2}, {0xf1,0xd3},
+  {0xf1,0xd4}, {0xf1,0xd5}, {0xf1,0xd6}, {0xf2,0x40}, {0xf2,0x41},
+  {0xf2,0x42}, {0xf2,0x43}, {0xf2,0x44}, {0xf2,0x45}, {0xf2,0x46},
+  {0xf2,0x47}, {0xf2,0x48}, {0xf2,0x49}, {0xf2,0x4a}, {0xf2,0x4b},
+  {0xf2,0x4c}, {0xf2,0x4d}, {0xf2,0x4e}, {0xf2,0x4f}, {0xf2,0x50},
+  {0xf2,0x51}, {0xf2,0x52}, {0xf2,0x53}, {0xf2,0x54}, {0xf2,0x55},
+  {0xf2,0x56}, {0xf2,0x57}, {0xf2,0x58}, {0xf2,0x59}, {0xf2,0x5a},
+  {0xf2,0x5b}, {0xf2,0x5c}, {0xf2,0x5d}, {0xf2,0x5e}, {0xf2,0x5f},
+  {0xf2,0x60}, {0xf2,0x61}, {0xf2,0x62}, {0xf2,0x63}, {0xf2,0x64},
+  {0xf2,0x65}, {0xf2,0x66}, {0xf2,0x67}, {0xf2,0x68}, {0xf2,0x69},
+  {0xf2,0x6a}, {0xf2,0x6b}, {0xf2,0x6c}, {0xf2,0x6d}, {0xf2,0x6e},
+  {0xf2,0x6f}, {0xf2,0x70}, {0xf2,0x71}, {0xf2,0x72}, {0xf2,0x73},
+  {0xf2,0x74}, {0xf2,0x75}, {0xf2,0x76}, {0xf2,0x77}, {0xf2,0x78},
+  {0xf2,0x79}, {0xf2,0x7a}, {0xf2,0x7b}, {0xf2,0x7c}, {0xf2,0x7d},
+  {0xf2,0x7e}, {0xf2,0x80}, {0xf2,0x81}, {0xf2,0x82}, {0xf2,0x83},
+  {0xf2,0x84}, {0xf2,0x85}, {0xf2,0x86}, {0xf2,0x87}, {0xf2,0x88},
+  {0xf2,0x89}, {0xf2,0x8a}, {0xf2,0x8b}, {0xf2,0x8c}, {0xf2,0x8d},
+  {0xf2,0x8e}, {0xf2,0x8f}, {0xf2,0x90}, {0xf2,0x91}, {0xf2,0x92},
+  {0xf2,0x93}, {0xf2,0x94}, {0xf2,0x95}, {0xf2,0x96}, {0xf2,0x97},
+  {0xf2,0x98}, {0xf2,0x99}, {0xf2,0x9a}, {0xf2,0x9b}, {0xf2,0x9c},
+  {0xf2,0x9d}, {0xf2,0x9e}, {0xf2,0x9f}, {0xf2,0xa0}, {0xf2,0xa1},
+  {0xf2,0xa2}, {0xf2,0xa3}, {0xf2,0xa4}, {0xf2,0xa5}, {0xf2,0xa6},
+  {0xf2,0xa7}, {0xf2,0xa8}, {0xf2,0xa9}, {0xf2,0xaa}, {0xf2,0xab},
+  {0xf2,0xb0}, {0xf2,0xb1}, {0xf2,0xb2}, {0xf2,0xb3}, {0xf2,0xb4},
+  {0xf2,0xb5}, {0xf2,0xb6}, {0xf2,0xb7}, {0xf2,0xb8}, {0xf2,0xb9},
+  {0xf2,0xba}, {0xf2,0xbb}, {0xf2,0xbc}, {0xf2,0xbd}, {0xf2,0xbe},
+  {0xf2,0xbf}, {0xf2,0xc0}, {0xf2,0xc1}, {0xf2,0xc2}, {0xf2,0xc3},
+  {0xf2,0xc4}, {0xf2,0xc5}, {0xf2,0xc6}, {0xf2,0xc7}, {0xf2,0xc8},
+  {0xf2,0xc9}, {0xf2,0xca}, {0xf2,0xcb}, {0xf2,0xcc}, {0xf2,0xcd},
+  {0xf2,0xce}, {0xf2,0xcf}, {0xf2,0xd0}, {0xf2,0xd1}, {0xf2,0xd2},
+  {0xf2,0xd3}, {0xf2,0xd4}, {0xf2,0xd5}, {0xf2,0xdf}, {0xf2,0xe0},
+  {0xf2,0xe1}, {0xf2,0xe2}, {0xf2,0xe3}, {0xf2,0xe4}, {0xf2,0xe5},
+  {0xf2,0xe6}, {0xf2,0xe7}, {0xf2,0xe8}, {0xf2,0xe9}, {0xf2,0xea},
+  {0xf2,0xeb}, {0xf2,0xec}, {0xf2,0xed}, {0xf2,0xee}, {0xf2,0xef},
+  {0xf2,0xf0}, {0xf2,0xf1}, {0xf2,0xf2}, {0xf2,0xf3}, {0xf2,0xf4},
+  {0xf2,0xf5}, {0xf2,0xf6}, {0xf2,0xf7}, {0xf2,0xf8}, {0xf2,0xf9},
+  {0xf2,0xfa}, {0xf2,0xfb}, {0xf2,0xfc}, {0xf3,0x40}, {0xf3,0x41},
+  {0xf3,0x42}, {0xf3,0x43}, {0xf3,0x44}, {0xf3,0x45}, {0xf3,0x46},
+  {0xf3,0x47}, {0xf3,0x48}, {0xf3,0x49}, {0xf3,0x4a}, {0xf3,0x4b},
+  {0xf3,0x4c}, {0xf3,0x4d}, {0xf3,0x4e}, {0xf3,0x4f}, {0xf3,0x50},
+  {0xf3,0x51}, {0xf3,0x52}, {0xf3,0x53}, {0xf3,0x54}, {0xf3,0x55},
+  {0xf3,0x56}, {0xf3,0x57}, {0xf3,0x58}, {0xf3,0x59}, {0xf3,0x5a},
+  {0xf3,0x5b}, {0xf3,0x5c}, {0xf3,0x5d}, {0xf3,0x5e}, {0xf3,0x5f},
+  {0xf3,0x60}, {0xf3,0x61}, {0xf3,0x62}, {0xf3,0x63}, {0xf3,0x64},
+  {0xf3,0x65}, {0xf3,0x66}, {0xf3,0x67}, {0xf3,0x68}, {0xf3,0x69},
+  {0xf3,0x6a}, {0xf3,0x6b}, {0xf3,0x6c}, {0xf3,0x6d}, {0xf3,0x6e},
+  {0xf3,0x6f}, {0xf3,0x70}, {0xf3,0x71}, {0xf3,0x72}, {0xf3,0x73},
+  {0xf3,0x74}, {0xf3,0x75}, {0xf3,0x76}, {0xf3,0x77}, {0xf3,0x78},
+  {0xf3,0x79}, {0xf3,0x7a}, {0xf3,0x7b}, {0xf3,0x7c}, {0xf3,0x7d},
+  {0xf3,0x7e}, {0xf3,0x80}, {0xf3,0x81}, {0xf3,0x82}, {0xf3,0x83},
+  {0xf3,0x84}, {0xf3,0x85}, {0xf3,0x86}, {0xf3,0x87}, {0xf3,0x88},
+  {0xf3,0x89}, {0xf3,0x8a}, {0xf3,0x8b}, {0xf3,0x8c}, {0xf3,0x8d},
+  {0xf3,0x8e}, {0xf3,0x8f}, {0xf3,0x90}, {0xf3,0x91}, {0xf3,0x92},
+  {0xf3,0x93}, {0xf3,0x94}, {0xf3,0x95}, {0xf3,0x96}, {0xf3,0x97},
+  {0xf3,0x98}, {0xf3,0x99}, {0xf3,0x9a}, {0xf3,0x9b}, {0xf3,0x9c},
+  {0xf3,0x9d}, {0xf3,0x9e}, {0xf3,0x9f}, {0xf3,0xa0}, {0xf3,0xa1},
+  {0xf3,0xa2}, {0xf3,0xa3}, {0xf3,0xa4}, {0xf3,0xa5}, {0xf3,0xa6},
+  {0xf3,0xa7}, {0xf3,0xa8}, {0xf3,0xa9}, {0xf3,0xaa}, {0xf3,0xab},
+  {0xf3,0xac}, {0xf3,0xad}, {0xf3,0xae}, {0xf3,0xaf}, {0xf3,0xb0},
+  {0xf3,0xb1}, {0xf3,0xb2}, {0xf3,0xb3}, {0xf3,0xb4}, {0xf3,0xb5},
+  {0xf3,0xb6}, {0xf3,0xb7}, {0xf3,0xb8}, {0xf3,0xb9}, {0xf3,0xba},
+  {0xf3,0xbb}, {0xf3,0xbc}, {0xf3,0xbd}, {0xf3,0xbe}, {0xf3,0xbf},
+  {0xf3,0xc0}, {0xf3,0xc1}, {0xf3,0xc2}, {0xf3,0xc3}, {0xf3,0xc4},
+  {0xf3,0xc5}, {0xf3,0xc6}, {0xf3,0xc7}, {0xf3,0xc8}, {0xf3,0xc9},
+  {0xf3,0xca}, {0xf3,0xcb}, {0xf3,0xcc}, {0xf3,0xcd}, {0xf3,0xce},
+  {0xf3,0xcf}, {0xf3,0xd0}, {0xf3,0xd1}, {0xf3,0xd2}, {0xf3,0xd3},
+  {0xf3,0xd4}, {0xf3,0xd5}, {0xf3,0xd6}, {0xf3,0xd7}, {0xf3,0xd8},
+  {0xf3,0xd9}, {0xf3,0xda}, {0xf3,0xdb}, {0xf3,0xdc}, {0xf3,0xdd},
+  {0xf3,0xde}, {0xf3,0xdf}, {0xf3,0xe0}, {0xf3,0xe1}, {0xf3,0xe2},
+  {0xf3,0xe3}, {0xf3,0xe4}, {0xf3,0xe5}, {0xf3,0xe6}, {0xf3,0xe7},
+  {0xf3,0xe8}, {0xf3,0xe9}, {0xf3,0xea}, {0xf3,0xeb}, {0xf3,0xec},
+  {0xf3,0xed}, {0xf3,0xee}, {0xf3,0xef}, {0xf3,0xf0}, {0xf3,0xf1},
+  {0xf3,0xf2}, {0xf3,0xf3}, {0xf3,0xf4}, {0xf3,0xf5}, {0xf3,0xf6},
+  {0xf3,0xf7}, {0xf3,0xf8}, {0xf3,0xf9}, {0xf3,0xfa}, {0xf4,0x40},
+  {0xf4,0x41}, {0xf4,0x42}, {0xf4,0x43}, {0xf4,0x44}, {0xf4,0x45},
+  {0xf4,0x46}, {0xf4,0x47}, {0xf4,0x48}, {0xf4,0x49}, {0xf4,0x4a},
+  {0xf4,0x4b}, {0xf4,0x4c}, {0xf4,0x4d}, {0xf4,0x4e}, {0xf4,0x4f},
+  {0xf4,0x80}, {0xf4,0x84}, {0xf4,0x85}, {0xf4,0x86}, {0xf4,0x87},
+  {0xf4,0x88}, {0xf4,0x89}, {0xf4,0x8a}, {0xf4,0x8c}, {0xf4,0x8d},
+  {0xf4,0x8e}, {0xf4,0x90}, {0xf4,0x94}, {0xf4,0x95}, {0xf4,0x96},
+  {0xf4,0x98}, {0xf4,0x99}, {0xf4,0x9a}, {0xf4,0x9b}, {0xf4,0x9c},
+  {0xf4,0xa0}, {0xf4,0xa1}, {0xf4,0xa2}, {0xf4,0xa3}, {0xf4,0xa4},
+  {0xf4,0xa8}, {0xf4,0xa9}, {0xf4,0xaa}, {0xf4,0xab}, {0xf4,0xac},
+  {0xf4,0xad}, {0xf4,0xae}, {0xf4,0xaf}, {0xf4,0xb4}, {0xf4,0xb5},
+  {0xf4,0xbc}, {0xf4,0xbd}, {0xf4,0xbe}, {0xf4,0xc4}, {0xf4,0xc5},
+  {0xf4,0xc8}, {0xf4,0xcc}, {0xf0,0xe5}, {0xf0,0xe6}, {0xf1,0xba},
+  {0xf0,0xe8}, {0xf0,0xe9}, {0xf4,0x98}, {0xf4,0x99}, {0xf0,0x75},
+  {0xf0,0x76}, {0xf0,0x77}, {0xf0,0x78}, {0xf0,0x79}, {0xf0,0x7a},
+  {0xf0,0x7b}, {0xf0,0x7c}, {0xf0,0x7e}, {0xf0,0x80}, {0xf0,0x81},
+  {0xf0,0x82}, {0xf0,0xce}, {0xf0,0xd2}, {0xf0,0xd1}, {0xf0,0xcf},
+  {0xf0,0xd3}, {0xf0,0xd0}, {0xf4,0x8d}, {0xf1,0x67}, {0xf0,0xa6},
+  {0xf0,0xa8}, {0xf4,0x89}, {0xf0,0xa4}, {0xf0,0xa5}, {0xf0,0xaa},
+  {0xf0,0xa9}, {0xf1,0x85}, {0xf1,0x86}, {0xf1,0x7e}, {0xf0,0xdc},
+  {0xf0,0xdf}, {0xf4,0x94}, {0xf0,0xba}, {0xf0,0xae}, {0xf0,0xd7},
+  {0xf0,0xd6}, {0xf4,0x90}, {0xf4,0x95}, {0xf0,0xb5}, {0xf0,0xb4},
+  {0xf0,0xb3}, {0xf0,0xb2}, {0xf0,0xaf}, {0xf1,0x57}, {0xf1,0x7c},
+  {0xf0,0xb9}, {0xf0,0xbf}, {0xf4,0xa0}, {0xf1,0x73}, {0xf0,0xc0},
+  {0xf1,0xb5}, {0xf0,0xe4}, {0xf0,0xe3}, {0xf1,0x6e}, {0xf1,0x5e},
+  {0xf1,0x7a}, {0xf1,0xb6}, {0xf1,0x65}, {0xf1,0x64}, {0xf1,0x79},
+  {0xf1,0x71}, {0xf1,0x70}, {0xf1,0x75}, {0xf0,0xfb}, {0xf1,0x41},
+  {0xf0,0xfc}, {0xf1,0x40}, {0xf4,0xcc}, {0xf0,0xf4}, {0xf0,0xf5},
+  {0xf0,0xf6}, {0xf4,0xa1}, {0xf4,0xa2}, {0xf4,0x45}, {0xf1,0x56},
+  {0xf1,0x60}, {0xf4,0x96}, {0xf4,0x9a}, {0xf4,0x9b}, {0xf0,0x73},
+  {0xf0,0x83}, {0xf4,0x8c}, {0xf0,0x8b}, {0xf4,0xa3}, {0xf1,0x77},
+  {0xf1,0xc2}, {0x4f,0x4e}, {0xf1,0x6d}, {0xf1,0x63}, {0xf1,0x81},
+  {0xf1,0x68}, {0x82,0x89}, {0x82,0x89}, {0xf1,0x81}, {0xf2,0xd5},
+  {0x49,0x44}, {0xf1,0xa5}, {0xf0,0xee}, {0xf1,0x82}, {0xf4,0xa8},
+  {0xf4,0xaf}, {0xf2,0xb1}, {0xf0,0x5f}, {0xf2,0xb6}, {0xf2,0xb7},
+  {0xf2,0xb8}, {0xf2,0xb9}, {0xf2,0xba}, {0xf2,0xbb}, {0xf2,0xbc},
+  {0xf2,0xbd}, {0xf2,0xbe}, {0xf2,0xb5}, {0xf0,0xf9}, {0xf4,0xae},
+  {0xf0,0xfa}, {0xf1,0xd3}, {0xf1,0xd5}, {0xf1,0xd4}, {0xf1,0x49},
+  {0xf0,0xde}, {0xf0,0x8c}, {0xf0,0xf7}, {0xf1,0x6f}, {0xf1,0xd5},
+  {0xf0,0xf4}, {0xf1,0x9c}, {0xf4,0xa9}, {0xf1,0x43}, {0xf1,0x42},
+  {0x81,0x60}, {0x81,0x60}, {0xf2,0xdf}, {0xf1,0x4f}, {0xf1,0xb7},
+  {0xf1,0x53}, {0xf0,0xd4}, {0xf1,0x8b}, {0xf1,0xa4}, {0xf1,0x69},
+  {0xf1,0x80}, {0xf1,0x77}, {0xf1,0xa2}, {0xf1,0x62}, {0xf0,0xab},
+  {0xf1,0xd5}, {0xf0,0xfa}, {0xf1,0xd3}, {0xf1,0xd4}, {0xf1,0xd2},
+  {0xf2,0xe0}, {0xf1,0x7d}, {0xf2,0x4c}, {0xf0,0x62}, {0xf0,0xef},
+  {0xf4,0xa9}, {0x8b,0xd6}, {0x8b,0xf3}, {0x8d,0x87}, {0x96,0x9e},
+  {0xf4,0xa4}, {0xf0,0xed}, {0xf0,0xe2}, {0xf0,0xc3}, {0xf1,0x4a},
+  {0xf0,0x8d}, {0xf0,0x93}, {0xf0,0x92}, {0xf0,0x8f}, {0xf4,0x8e},
+  {0xf1,0xc6}, {0xf0,0xb1}, {0xf0,0xb0}, {0xf0,0x86}, {0xf0,0x70},
+  {0xf1,0x81}, {0xf1,0x63}, {0xf0,0xfa}, {0xf0,0x71}, {0xf0,0x87},
+  {0xf0,0xa1}, {0xf1,0x76}, {0xf1,0xa2}, {0xf1,0x6f}, {0xf1,0x4a},
+  {0xf0,0xf7}, {0xf1,0xb6}, {0xf1,0x9b}, {0xf1,0x82}, {0xf2,0x4c},
+  {0xf1,0xa8}, {0xf0,0x90}, {0xf0,0xa3}, {0xf0,0xf8}, {0xf0,0xaf},
+  {0xf0,0xdd}, {0xf0,0xde}, {0xf0,0xbd}, {0xf1,0xb5}, {0xf1,0x75},
+  {0xf1,0x75}, {0xf1,0x72}, {0xf1,0x71}, {0xf0,0xc9}, {0x56,0x53},
+  {0xf1,0xa4}, {0xf4,0x8d}, {0xf0,0xc8}, {0xf0,0xca}, {0xf0,0xcc},
+  {0xf0,0xcb}, {0xf0,0xe9}, {0xf1,0x57}, {0xf4,0x95}, {0xf1,0xb4},
+  {0xf1,0xb4}, {0xf1,0xa6}, {0xf1,0x7a}, {0xf0,0xc7}, {0xf0,0xdf},
+  {0xf4,0x90}, {0xf0,0xd6}, {0xf0,0xd8}, {0xf4,0x95}, {0xf1,0x7e},
+  {0xf4,0x94}, {0xf0,0xdc}, {0xf0,0xae}, {0xf0,0xe2}, {0xf0,0xba},
+  {0xf0,0xa5}, {0xf4,0x8a}, {0xf1,0x59}, {0xf0,0x8d}, {0xf0,0x8e},
+  {0xf4,0x95}, {0xf1,0x73}, {0xf0,0xb1}, {0xf1,0xca}, {0x8f,0x6a},
+  {0xf0,0xe4}, {0xf1,0x9c}, {0xf1,0xcc}, {0xf1,0x7c}, {0xf0,0x62},
+  {0xf1,0xb4}, {0xf1,0xb7}, {0xf1,0x5e}, {0xf1,0x49}, {0xf0,0xf9},
+  {0xf0,0xf9}, {0xf0,0xf9}, {0xf0,0xf9}, {0xf0,0xf9}, {0xf0,0xf9},
+  {0xf0,0xf9}, {0x81,0x99}, {0xf2,0xd4}, {0x81,0x7e}, {0xf1,0xd5},
+  {0x81,0x99}, {0x81,0x48}, {0xf4,0xa9}, {0xf1,0xbd}, {0xf0,0xb0},
+  {0xf4,0x8e}, {0xf0,0xb7}, {0xf0,0x92}, {0xf0,0x91}, {0xf0,0x94},
+  {0xf0,0xa7}, {0xf0,0xaa}, {0xf0,0xe3}, {0xf4,0xac}, {0xf4,0x96},
+  {0xf0,0xfb}, {0xf0,0xfc}, {0xf1,0x41}, {0xf1,0x40}, {0xf2,0xb1},
+  {0xf4,0xaf}, {0xf4,0xa8}, {0x55,0x50}, {0x97,0x4c}, {0x8c,0x8e},
+  {0x90,0x5c}, {0xf0,0x4d}, {0xf0,0x4e}, {0xf0,0x4f}, {0xf0,0x50},
+  {0xf0,0x51}, {0xf0,0x52}, {0xf0,0x53}, {0xf0,0x54}, {0xf0,0x55},
+  {0xf2,0xb2}, {0xf2,0xe1}, {0xf2,0xe2}, {0x83,0x54}, {0x49,0x44},
+  {0x96,0x9e}, {0x8b,0xf3}, {0xf0,0x5e}, {0xf0,0x57}, {0xf0,0xf3},
+  {0xf0,0xf2}, {0xf0,0xf1}, {0xf0,0xf0}, {0x81,0xaa}, {0x81,0xab},
+  {0x81,0xa8}, {0x81,0xa9}, {0xf4,0xa0}, {0xf4,0xa2}, {0xf4,0xa1},
+  {0xf4,0xa3}, {0xf0,0xec}, {0xf0,0xeb}, {0x81,0xe2}, {0x81,0xe1},
+  {0xf0,0x75}, {0xf0,0x76}, {0xf0,0x77}, {0xf0,0x78}, {0xf0,0x79},
+  {0xf0,0x7a}, {0xf0,0x7b}, {0xf0,0x7c}, {0xf0,0x7e}, {0xf0,0x80},
+  {0xf0,0x81}, {0xf0,0x82}, {0xf0,0x7d}, {0xf2,0xdf}, {0xf4,0xa9},
+  {0x82,0x69}, {0xf1,0xd2}, {0xf1,0xd3}, {0xf1,0xd3}, {0xf1,0xd5},
+  {0xf4,0xcc}, {0xf0,0xd0}, {0xf0,0xa4}, {0xf0,0xa8}, {0xf1,0x4c},
+  {0xf4,0x99}, {0xf1,0x87}, {0xf4,0x98}, {0xf0,0xa0}, {0xf4,0x9c},
+  {0xf0,0x9c}, {0xf0,0x9d}, {0xf0,0xf7}, {0xf0,0x98}, {0xf0,0x99},
+  {0xf1,0x4f}, {0xf1,0x6e}, {0xf1,0x65}, {0xf1,0x64}, {0xf1,0x68},
+  {0xf1,0x69}, {0xf0,0xf4}, {0xf0,0xf4}, {0xf0,0xf5}, {0xf0,0xf6},
+  {0xf0,0xd3}, {0xf0,0xd2}, {0xf0,0xd1}, {0xf0,0xce}, {0xf0,0xcf},
+  {0xf0,0x86}, {0xf0,0x70}, {0xf0,0xa4}, {0xf4,0x8c}, {0xf0,0xa9},
+  {0xf0,0xa6}, {0xf0,0xa8}, {0x81,0x48}, {0xf4,0xa9}, {0xf0,0xf9},
+  {0xf0,0x8f}, {0xf0,0x8b}, {0xf1,0x62}, {0xf1,0xa3}, {0xf1,0x85},
+  {0xf1,0x87}, {0xf1,0x86}, {0xf0,0xd7}, {0xf0,0xc3}, {0xf0,0xb9},
+  {0xf0,0xbf}, {0xf1,0x49}, {0xf1,0xa5}, {0xf1,0xb2}, {0xf0,0xb5},
+  {0xf0,0xb4}, {0xf1,0xc6}, {0xf0,0xb2}, {0xf0,0xe8}, {0xf0,0xe6},
+  {0xf0,0xe5}, {0xf1,0xba}, {0xf0,0xa2}, {0xf0,0x83}, {0xf0,0x6c},
+  {0xf0,0x73}, {0xf0,0x6b}, {0xf0,0x85}, {0xf1,0xd3}, {0xf1,0xd3},
+  {0xf1,0xd4}, {0xf1,0xd5}, {0xf1,0xc3}, {0xf1,0x5b}, {0xf1,0x88},
+  {0xf0,0xbf}, {0xf0,0x9e}, {0xf0,0x86}, {0xf0,0x86}, {0xf1,0x4b},
+  {0xf0,0x84}, {0xf0,0x71}, {0xf0,0x73}, {0xf0,0x6d}, {0xf0,0x6f},
+  {0xf0,0x72}, {0xf0,0x74}, {0xf4,0x80}, {0x82,0x60}, {0x82,0x61},
+  {0x41,0x42}, {0x82,0x6e}, {0xf4,0x45},
+};
+static const uj_emoji_run_t eu2d_runs[] =
+{
+  {0x0001,8,0}, {0x000b,1,8}, {0x000d,2,9}, {0x0010,1,11}, {0x001a,5,12},
+  {0x0020,2,17}, {0x002a,5,19}, {0x0031,5,24}, {0x0037,2,29}, {0x003d,12,31},
+  {0x004a,2,43}, {0x004d,1,45}, {0x0050,1,46}, {0x0053,1,47}, {0x0055,1,48},
+  {0x0057,3,49}, {0x005b,5,52}, {0x0061,1,57}, {0x0063,12,58}, {0x0070,2,70},
+  {0x0074,1,72}, {0x0077,5,73}, {0x007d,1,78}, {0x007f,2,79}, {0x0086,2,81},
+  {0x0089,1,83}, {0x008c,5,84}, {0x0092,2,89}, {0x0095,1,91}, {0x0097,1,92},
+  {0x009b,1,93}, {0x009d,2,94}, {0x00a0,3,96}, {0x00a6,1,99}, {0x00a8,2,100},
+  {0x00ac,3,102}, {0x00b0,30,105}, {0x00cf,3,135}, {0x00d3,3,138},
+  {0x00d7,3,141}, {0x00db,5,144}, {0x00e3,1,149}, {0x00e5,1,150},
+  {0x00e8,1,151}, {0x00ea,2,152}, {0x00ef,1,154}, {0x00f2,10,155},
+  {0x0100,4,165}, {0x0106,1,169}, {0x010a,3,170}, {0x010e,5,173},
+  {0x0114,2,178}, {0x0117,1,180}, {0x0119,1,181}, {0x011d,2,182},
+  {0x0120,2,184}, {0x0123,2,186}, {0x0126,3,188}, {0x012a,1,191},
+  {0x012c,1,192}, {0x012f,1,193}, {0x0132,2,194}, {0x013a,3,196},
+  {0x013e,3,199}, {0x0145,2,202}, {0x0148,1,204}, {0x014d,2,205},
+  {0x0151,2,207}, {0x0154,1,209}, {0x0156,4,210}, {0x015b,1,214},
+  {0x015d,1,215}, {0x0160,5,216}, {0x0166,3,221}, {0x016a,2,224},
+  {0x0176,6,226}, {0x017f,9,232}, {0x018c,1,241}, {0x0190,4,242},
+  {0x0195,1,246}, {0x019e,6,247}, {0x01a5,1,253}, {0x01ac,1,254},
+  {0x01b1,3,255}, {0x01c5,2,258}, {0x01e1,1,260}, {0x01e9,2,261},
+  {0x01ec,1,263}, {0x01ee,1,264}, {0x01f1,1,265}, {0x01fa,1,266},
+  {0x02c4,3,267}, {0x02c9,5,270}, {0x02d4,6,275}, {0x02dd,3,281},
+  {0x02e2,2,284}, {0x02ed,1,286}, {0x02f7,2,287}, {0x02fb,2,289},
+  {0x030b,1,291}, {0x0310,1,292}, {0x031b,1,293}, {0x031f,2,294},
+  {0x0323,1,296}, {0x0325,5,297}, {0x032f,1,302}, {0x0331,2,303},
+  {0x1040,63,305}, {0x1080,125,368}, {0x1140,63,493}, {0x1180,87,556},
+  {0x1240,63,643}, {0x1280,44,706}, {0x12b0,38,750}, {0x12df,30,788},
+  {0x1340,63,818}, {0x1380,123,881}, {0x1440,16,1004}, {0x1480,1,1020},
+  {0x1484,7,1021}, {0x148c,3,1028}, {0x1490,1,1031}, {0x1494,3,1032},
+  {0x1498,5,1035}, {0x14a0,5,1040}, {0x14a8,8,1045}, {0x14b4,2,1053},
+  {0x14bc,3,1055}, {0x14c4,2,1058}, {0x14c8,1,1060}, {0x14cc,1,1061},
+  {0x189f,6,1062}, {0x18a6,13,1068}, {0x18b4,9,1081}, {0x18be,28,1090},
+  {0x18db,1,1118}, {0x18dd,1,1119}, {0x18df,6,1120}, {0x18e6,1,1126},
+  {0x18e8,10,1127}, {0x18f3,10,1137}, {0x1943,7,1147}, {0x1952,1,1154},
+  {0x1956,1,1155}, {0x195c,1,1156}, {0x195e,1,1157}, {0x1972,6,1158},
+  {0x197a,1,1164}, {0x197c,3,1165}, {0x1981,2,1168}, {0x1984,15,1170},
+  {0x1994,4,1185}, {0x199b,4,1189}, {0x19a0,4,1193}, {0x19a7,3,1197},
+  {0x19ae,3,1200}, {0x19b3,1,1203}, {0x19b5,3,1204}, {0x19b9,4,1207},
+  {0x19be,3,1211}, {0x19c2,1,1214}, {0x19c9,1,1215}, {0x19cb,1,1216},
+  {0x19cf,1,1217}, {0x19d2,4,1218}, {0x19d8,3,1222}, {0x19dc,8,1225},
+  {0x19e5,2,1233}, {0x19e8,3,1235}, {0x19ed,5,1238}, {0x19f6,1,1243},
+  {0x19f9,1,1244}, {0x1b23,2,1245}, {0x1b26,1,1247}, {0x1b29,2,1248},
+  {0x1b2c,11,1250}, {0x1b39,2,1261}, {0x1b3c,1,1263}, {0x1b40,2,1264},
+  {0x1b43,6,1266}, {0x1b4a,1,1272}, {0x1b4d,3,1273}, {0x1b52,5,1276},
+  {0x1b5d,2,1281}, {0x1b60,3,1283}, {0x1b64,1,1286}, {0x1b68,1,1287},
+  {0x1b6c,6,1288}, {0x1b73,8,1294}, {0x1ba2,1,1302}, {0x1ba4,2,1303},
+  {0x1ba9,6,1305}, {0x1bb1,3,1311}, {0x1bb5,1,1314}, {0x1bb7,1,1315},
+  {0x1bbc,1,1316}, {0x1bc3,1,1317}, {0x1bc6,8,1318}, {0x1bcf,1,1326},
+  {0x1bd2,6,1327}, {0x1bdd,1,1333}, {0x1be0,1,1334}, {0x1be2,1,1335},
+  {0x1be4,4,1336}, {0x1c21,2,1340}, {0x1c28,3,1342}, {0x1c2c,8,1345},
+  {0x1c35,1,1353}, {0x1c37,2,1354}, {0x1c3c,34,1356}, {0x1c5f,13,1390},
+  {0x1c6d,1,1403}, {0x1c72,1,1404}, {0x1c74,1,1405}, {0x1ca8,1,1406},
+  {0x1cb4,3,1407}, {0x1cbb,1,1410}, {0x1cca,1,1411}, {0x1cce,1,1412},
+  {0x1cd5,1,1413}, {0x1cd9,1,1414}, {0x1cdc,2,1415}, {0x1ce3,1,1417},
+  {0x1ce8,1,1418}, {0x1ceb,1,1419}, {0x1d21,6,1420}, {0x1d28,6,1426},
+  {0x1d30,7,1432}, {0x1d38,11,1439}, {0x1d50,1,1450}, {0x1d53,6,1451},
+  {0x1d5a,6,1457}, {0x1d61,1,1463}, {0x1d63,1,1464}, {0x1d65,7,1465},
+  {0x1d6e,3,1472}, {0x1d72,3,1475}, {0x1d76,5,1478}, {0x1da3,1,1483},
+  {0x1da6,2,1484}, {0x1dba,1,1486}, {0x1dc0,1,1487}, {0x1dc2,1,1488},
+  {0x1dc5,2,1489}, {0x1dc8,1,1491}, {0x1dca,1,1492}, {0x1dcc,4,1493},
+  {0x1dd1,6,1497}, {0xffff,0,0},
+};
+static const unsigned short eu2d_bucket[UJ_EMOJI_REV_CHARS>>UJ_EMOJI_REV_SHIFT] =
+{
+  0, 9, 23, 36, 47, 63, 76, 84, 91, 91, 91, 91, 99, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 108, 108, 109, 109, 110, 110, 111, 111, 112, 113, 115, 115,
+  116, 116, 117, 117, 118, 128, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+  131, 131, 131, 131, 131, 131, 134, 141, 141, 149, 159, 172, 172, 172, 172,
+  172, 178, 189, 196, 204, 209, 214, 217, 225, 228, 238, 241, 248, 248, 248,
+  248, 248, 248, 248, 248,
+};
+const uj_emoji_rev_t g_eu2d_rev = { eu2d_bucket, eu2d_runs, eu2d_values, };
+
+/* ----------------------------------------------------------------------------
+ * End of File.
+ * ------------------------------------------------------------------------- */
@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------------
+ * emoji_rev.h
+ * utf8 => sjis(carrier) emoji maps.
+ * ----------------------------------------------------------------------------
+ * Mastering programed by YAMASHINA Hio
+ * ----------------------------------------------------------------------------
+ * $Id$
+ * ------------------------------------------------------------------------- */
+#ifndef UNICODE__JAPANESE__EMOJI_REV_H__
+#define UNICODE__JAPANESE__EMOJI_REV_H__
+
+/* the eu2*.dat tables map each of U+FE000..U+FFFFF to sjis, but most of
+ * the entries are '?'.  emoji_rev.c (generated by gen_emoji_rev.pl) keeps
+ * only the runs of mapped chars, with a bucket index of the first run
+ * for each 64 chars, so a lookup reads a few runs in one or two lines.
+ *
+ * each value is 2 bytes: a sjis code (nul padded), or for a j-sky escape
+ * "\x1b$" page char "\x0f", the page number (1.., a byte which never
+ * starts a sjis code) and the char.
+ */
+
+#ifndef UJ_INLINE
+#ifdef _MSC_VER
+#define UJ_INLINE __inline
+#else
+#define UJ_INLINE __inline__
+#endif
+#endif
+
+#define UJ_EMOJI_REV_BASE  0x0fe000
+#define UJ_EMOJI_REV_CHARS 0x2000
+#define UJ_EMOJI_REV_SHIFT 6
+
+/* page letters of j-sky escapes, for page number 1.. */
+#define UJ_EMOJI_REV_JSKY_PAGES "EFGOPQ"
+#define UJ_EMOJI_REV_IS_JSKY(val) ((val)[0]<0x20)
+#define UJ_EMOJI_REV_JSKY_PAGE(val) (UJ_EMOJI_REV_JSKY_PAGES[(val)[0]-1])
+
+typedef struct uj_emoji_run_s
+{
+  unsigned short first;  /* offset from UJ_EMOJI_REV_BASE. */
+  unsigned short count;
+  unsigned short offset; /* index of the first value. */
+} uj_emoji_run_t;
+
+typedef struct uj_emoji_rev_s
+{
+  const unsigned short*  bucket; /* [UJ_EMOJI_REV_CHARS>>UJ_EMOJI_REV_SHIFT] */
+  const uj_emoji_run_t*  runs;   /* terminated by first==0xffff. */
+  const unsigned char  (*values)[2];
+} uj_emoji_rev_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern const uj_emoji_rev_t g_eu2i1_rev;
+extern const uj_emoji_rev_t g_eu2i2_rev;
+extern const uj_emoji_rev_t g_eu2j1_rev;
+extern const uj_emoji_rev_t g_eu2j2_rev;
+extern const uj_emoji_rev_t g_eu2d_rev;
+#ifdef __cplusplus
+}
+#endif
+
+/* ----------------------------------------------------------------------------
+ * uj_emoji_rev_lookup(rev, ucs)
+ *   value for ucs in U+FE000..U+FFFFF ("?\0" when not mapped).
+ * ------------------------------------------------------------------------- */
+static UJ_INLINE const unsigned char*
+uj_emoji_rev_lookup(const uj_emoji_rev_t* rev, unsigned long ucs)
+{
+  const unsigned int off = (unsigned int)(ucs - UJ_EMOJI_REV_BASE);
+  const uj_emoji_run_t* run = &rev->runs[rev->bucket[off>>UJ_EMOJI_REV_SHIFT]];
+  for( ; run->first<=off; ++run )
+  {
+    if( off < (unsigned int)run->first+run->count )
+    {
+      return rev->values[run->offset + off - run->first];
+    }
+  }
+  return (const unsigned char*)"?";
+}
+
+#endif /* !defined(UNICODE__JAPANESE__EMOJI_REV_H__) */
+/* ----------------------------------------------------------------------------
+ * End of File.
+ * ------------------------------------------------------------------------- */
@@ -1,5 +1,6 @@
 
 #include "Japanese.h"
+#include "simd.h"
 #include "sjis.h"
 
 #ifdef TEST
@@ -25,6 +26,10 @@ xs_sjis_eucjp(SV* sv_str)
   
   src = (unsigned char*)SvPV(sv_str,PL_na);
   len = sv_len(sv_str);
+  if( uj_is_plain_ascii(src, len) )
+  { /* ascii reads the same in every code. */
+    return SvREFCNT_inc(sv_str);
+  }
   /*fprintf(stderr,"Unicode::Japanese::(xs)sjis_eucjp\n",len); */
   /*bin_dump("in ",src,len); */
   SV_Buf_init(&result,len);
@@ -136,6 +141,10 @@ xs_eucjp_sjis(SV* sv_str)
   
   src = (unsigned char*)SvPV(sv_str,PL_na);
   len = sv_len(sv_str);
+  if( uj_is_plain_ascii(src, len) )
+  { /* ascii reads the same in every code. */
+    return SvREFCNT_inc(sv_str);
+  }
 #if DISP_E2S
   fprintf(stderr,"Unicode::Japanese::(xs)eucjp_sjis\n",len);
   bin_dump("in ",src,len);
@@ -0,0 +1,124 @@
+#! /usr/bin/perl -w
+# -----------------------------------------------------------------------------
+# gen_emoji_rev.pl
+#   generate emoji_rev.c, the compact utf8 => sjis(carrier) emoji maps,
+#   from the eu2*.dat tables embedded in lib/Unicode/Japanese.pm.
+# -----------------------------------------------------------------------------
+# $Id$
+# -----------------------------------------------------------------------------
+use strict;
+use warnings;
+use lib 'lib';
+use Unicode::Japanese qw(PurePerl);
+
+our $BUCKET_SHIFT = 6;     # UJ_EMOJI_REV_SHIFT
+our $CHARS        = 0x2000; # UJ_EMOJI_REV_CHARS
+our $JSKY_PAGES   = 'EFGOPQ'; # UJ_EMOJI_REV_JSKY_PAGES
+
+our @MAPS = (
+  # name,  file,                   bytes per entry
+  [ eu2i1 => 'jcode/emoji2/eu2i.dat',  2 ],
+  [ eu2i2 => 'jcode/emoji2/eu2i2.dat', 2 ],
+  [ eu2j1 => 'jcode/emoji2/eu2j.dat',  5 ],
+  [ eu2j2 => 'jcode/emoji2/eu2j2.dat', 5 ],
+  [ eu2d  => 'jcode/emoji2/eu2d.dat',  2 ],
+);
+
+my $outpath = shift || 'emoji_rev.c';
+open(my $out, '>', $outpath) or die "open: $outpath: $!";
+print $out "/* This file was auto-generated by gen_emoji_rev.pl */\n";
+print $out "/* \$Id\$ */\n\n";
+print $out "#include \"emoji_rev.h\"\n";
+
+foreach my $map (@MAPS)
+{
+  my ($name, $file, $usize) = @$map;
+  my $data = Unicode::Japanese->_getFile($file);
+  length($data)==$CHARS*$usize or die "$file: unexpected size ".length($data);
+
+  # each entry as 2 bytes: sjis code (nul padded), or page number and
+  # char of a j-sky escape "\x1b\$" page char "\x0f".  '?' is the default.
+  my @values;
+  for( my $i=0; $i<$CHARS; ++$i )
+  {
+    my $ent = substr($data, $i*$usize, $usize);
+    my $val;
+    if( $usize==5 && substr($ent,4,1) ne "\0" )
+    {
+      $ent =~ /^\x1b\$([EFGOPQ])([\x21-\x7a])\x0f\z/
+        or die "$file: invalid escape at $i: ".unpack('H*',$ent);
+      $val = chr(index($JSKY_PAGES, $1)+1).$2;
+    }else
+    {
+      $val = substr($ent, 0, 2);
+      $usize==5 && substr($ent,2) ne "\0\0\0" and die "$file: long entry at $i";
+      $val =~ /^[\x01-\x1f]/ and die "$file: ambiguous entry at $i";
+    }
+    $val eq "\0\0" and $val = "?\0";
+    push(@values, $val);
+  }
+
+  # runs of entries other than '?'.
+  my @runs;
+  my @vals;
+  for( my $i=0; $i<$CHARS; ++$i )
+  {
+    $values[$i] eq "?\0" and next;
+    if( @runs && $runs[-1][0]+$runs[-1][1]==$i )
+    {
+      ++$runs[-1][1];
+    }else
+    {
+      push(@runs, [ $i, 1, scalar(@vals) ]);
+    }
+    push(@vals, $values[$i]);
+  }
+
+  # first run which ends after the head of each bucket.
+  my @bucket;
+  my $r = 0;
+  for( my $b=0; $b<($CHARS>>$BUCKET_SHIFT); ++$b )
+  {
+    my $head = $b<<$BUCKET_SHIFT;
+    ++$r while( $r<@runs && $runs[$r][0]+$runs[$r][1]<=$head );
+    push(@bucket, $r);
+  }
+
+  print $out "\n";
+  print $out "/* ----------------------------------------------------------------------------\n";
+  print $out " * $name ($file): ".scalar(@vals)." chars in ".scalar(@runs)." runs.\n";
+  print $out " * ------------------------------------------------------------------------- */\n";
+  print $out "static const unsigned char ${name}_values[][2] =\n{\n";
+  print $out _wrap(map{ sprintf('{0x%02x,0x%02x}', unpack('C2',$_)) } @vals);
+  print $out "};\n";
+  print $out "static const uj_emoji_run_t ${name}_runs[] =\n{\n";
+  print $out _wrap((map{ sprintf('{0x%04x,%d,%d}', @$_) } @runs), '{0xffff,0,0}');
+  print $out "};\n";
+  print $out "static const unsigned short ${name}_bucket[UJ_EMOJI_REV_CHARS>>UJ_EMOJI_REV_SHIFT] =\n{\n";
+  print $out _wrap(@bucket);
+  print $out "};\n";
+  print $out "const uj_emoji_rev_t g_${name}_rev = { ${name}_bucket, ${name}_runs, ${name}_values, };\n";
+}
+
+print $out "\n";
+print $out "/* ----------------------------------------------------------------------------\n";
+print $out " * End of File.\n";
+print $out " * ------------------------------------------------------------------------- */\n";
+close $out;
+
+sub _wrap
+{
+  my $text = '';
+  my $line = ' ';
+  foreach my $item (@_)
+  {
+    if( length($line)+length($item)+2 > 78 )
+    {
+      $text .= "$line\n";
+      $line = ' ';
+    }
+    $line .= " $item,";
+  }
+  $text .= "$line\n";
+  $text;
+}
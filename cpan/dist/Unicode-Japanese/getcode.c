@@ -224,22 +224,13 @@ static bool _is_acceptable_state(const CodeCheck* check)
   return false;
 }
 
-static int getcode_list(SV* sv_str, CodeCheck* check)
+/* ----------------------------------------------------------------------------
+ * getcode_bom(src, len, check)
+ *   decides empty string and utf16/utf32 with BOM without the state
+ *   machines.  returns the number of matches, or -1 to run them.
+ * ------------------------------------------------------------------------- */
+static int getcode_bom(const unsigned char* src, int len, CodeCheck* check)
 {
-  unsigned char* src;
-  int len;
-  const unsigned char* src_end;
-  int cc_max;
-  
-  if( sv_str==&PL_sv_undef )
-  {
-    return 0;
-  }
-  
-  src = (unsigned char*)SvPV(sv_str,PL_na);
-  len = sv_len(sv_str);
-  src_end = src+len;
-  
   /* empty string */
   /* (jp:) ʸ unknown */
   if( len==0 )
@@ -262,20 +253,23 @@ static int getcode_list(SV* sv_str, CodeCheck* check)
     check[0].code = cc_utf16;
     return 1;
   }
+  return -1;
+}
 
-  /* fprintf(stderr,"Unicode::Japanese::(xs)getcode[%d]\n",len); */
-  /* fprintf(stderr,">>%s<<\n",src); */
-  /* bin_dump("in ",src,len); */
-
-  memcpy(check,cc_tmpl,sizeof(cc_tmpl));
-  cc_max = cc_tmpl_max;
-
+/* ----------------------------------------------------------------------------
+ * getcode_feed(check, cc_max, src, src_end)
+ *   steps the cc_max state machines in check over src..src_end, drops
+ *   the ones which got invalid, and returns how many are left.  the
+ *   order of check (the priority) is kept.
+ * ------------------------------------------------------------------------- */
+static int getcode_feed(CodeCheck* check, int cc_max, const unsigned char* src, const unsigned char* src_end)
+{
   for( ; src<src_end; ++src )
   {
     int invalids;
     int i;
 #if TEST && GC_DISP
-    fprintf(stderr,"[%d] '%c' 0x%02x (%d)\n",len-(src_end-src),(0x20<=*src&&*src<=0x7f?*src:'.'),*src,*src);
+    fprintf(stderr,"[-%d] '%c' 0x%02x (%d)\n",(int)(src_end-src),(0x20<=*src&&*src<=0x7f?*src:'.'),*src,*src);
 #endif
     /* ܤ򣱤Ŀʤ */
     invalids = 0;
@@ -318,39 +312,71 @@ static int getcode_list(SV* sv_str, CodeCheck* check)
       return 0;
     }
   }
+  return cc_max;
+}
 
+/* ----------------------------------------------------------------------------
+ * getcode_finish(check, cc_max)
+ *   keeps the state machines which have stopped at a final state.
+ * ------------------------------------------------------------------------- */
+static int getcode_finish(CodeCheck* check, int cc_max)
+{
   /* check if we have stopped at a valid (final?) state */
+  int wr = 0;
+  int i;
+  for( i=0; i<cc_max; ++i )
   {
-    int wr = 0;
-    int i;
-    for( i=0; i<cc_max; ++i )
+    if( check[i].table == check[i].base || _is_acceptable_state(&check[i]) )
     {
-      if( check[i].table == check[i].base || _is_acceptable_state(&check[i]) )
+      if( wr!=i )
       {
-        if( wr!=i )
-	{
-	  check[wr] = check[i];
-	}
-	++wr;
+        check[wr] = check[i];
       }
+      ++wr;
     }
-    cc_max = wr;
   }
+  cc_max = wr;
 
 #if TEST && GC_DISP
   fprintf(stderr,"<availables>\n");
+  for( i=0; i<cc_max; ++i )
   {
-    int i;
-    for( i=0; i<cc_max; ++i )
-    {
-      fprintf(stderr,"  %s\n",charcodeToStr(check[i].code));
-    }
+    fprintf(stderr,"  %s\n",charcodeToStr(check[i].code));
   }
 #endif
   
   return cc_max;
 }
 
+static int getcode_list(SV* sv_str, CodeCheck* check)
+{
+  unsigned char* src;
+  int len;
+  int cc_max;
+  
+  if( sv_str==&PL_sv_undef )
+  {
+    return 0;
+  }
+  
+  src = (unsigned char*)SvPV(sv_str,PL_na);
+  len = sv_len(sv_str);
+  
+  cc_max = getcode_bom(src, len, check);
+  if( cc_max>=0 )
+  {
+    return cc_max;
+  }
+
+  /* fprintf(stderr,"Unicode::Japanese::(xs)getcode[%d]\n",len); */
+  /* fprintf(stderr,">>%s<<\n",src); */
+  /* bin_dump("in ",src,len); */
+
+  memcpy(check,cc_tmpl,sizeof(cc_tmpl));
+  cc_max = getcode_feed(check, cc_tmpl_max, src, src+len);
+  return getcode_finish(check, cc_max);
+}
+
 #ifndef NO_XSUBS
 
 /* getcodeؿ */
@@ -20,12 +20,15 @@ DECL_MAP(ascii,1);
 DECL_MAP(eucjp,5);
 DECL_MAP(sjis,2);
 DECL_MAP(utf8,6);
-DECL_MAP(jis,10);
+DECL_MAP(jis,11);
+DECL_MAP(jis_au,12);
+DECL_MAP(jis_jsky,13);
 DECL_MAP(utf32_be,4);
 DECL_MAP(utf32_le,4);
 DECL_MAP(sjis_jsky,5);
 DECL_MAP(sjis_imode,4);
 DECL_MAP(sjis_doti,7);
+DECL_MAP(sjis_au,3);
 
 #define map_invalid 0x7f
 
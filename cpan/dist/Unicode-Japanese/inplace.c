@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------------
+ * inplace.c
+ * in-place utf8=>sjis, utf8=>eucjp and jis=>sjis (see inplace.h).
+ * ----------------------------------------------------------------------------
+ * Mastering programed by YAMASHINA Hio
+ * ----------------------------------------------------------------------------
+ * $Id$
+ * ------------------------------------------------------------------------- */
+
+#include "Japanese.h"
+#include "inplace.h"
+
+typedef SV* (*inplace_conv_t)(SV* sv_str);
+typedef size_t (*inplace_split_t)(const unsigned char* src, size_t len, size_t want);
+
+/* ----------------------------------------------------------------------------
+ * converts the string of sv_str in its own buffer, a chunk at a time.
+ * ------------------------------------------------------------------------- */
+static void
+xs_inplace(SV* sv_str, inplace_conv_t conv, inplace_split_t split)
+{
+  unsigned char* buf;
+  STRLEN len;
+  STRLEN r; /* read from. */
+  STRLEN w; /* write to. */
+
+  if( SvROK(sv_str) )
+  {
+    sv_str = SvRV(sv_str);
+  }
+  if( !SvOK(sv_str) )
+  {
+    return;
+  }
+  buf = (unsigned char*)SvPV_force(sv_str,len);
+  r = 0;
+  w = 0;
+  while( r<len )
+  {
+    STRLEN n = split(buf+r,len-r,UJ_INPLACE_CHUNK);
+    SV* sv_chunk = newSVpvn((char*)buf+r,n);
+    SV* sv_out = conv(sv_chunk);
+    STRLEN out_len;
+    const char* out = SvPV(sv_out,out_len);
+    r += n;
+    if( w+out_len > r )
+    { /* an entity reference would pass the text not read yet. */
+      STRLEN extra = w+out_len-r+UJ_INPLACE_CHUNK;
+      buf = (unsigned char*)SvGROW(sv_str,len+extra+1);
+      Move(buf+r,buf+r+extra,len-r,unsigned char);
+      r   += extra;
+      len += extra;
+    }
+    Move(out,buf+w,out_len,char);
+    w += out_len;
+    SvREFCNT_dec(sv_out);
+    SvREFCNT_dec(sv_chunk);
+  }
+  buf[w] = '\0';
+  SvCUR_set(sv_str,w);
+  SvPOK_only(sv_str);
+  SvSETMAGIC(sv_str);
+}
+
+/* utf8=>sjis=>eucjp, for a chunk. */
+static SV*
+xs_utf8_eucjp(SV* sv_str)
+{
+  SV* sv_sjis = xs_utf8_sjis(sv_str);
+  SV* sv_eucjp = xs_sjis_eucjp(sv_sjis);
+  SvREFCNT_dec(sv_sjis);
+  return sv_eucjp;
+}
+
+EXTERN_C
+void
+xs_utf8_sjis_inplace(SV* sv_str)
+{
+  xs_inplace(sv_str,xs_utf8_sjis,uj_inplace_split_utf8);
+}
+
+EXTERN_C
+void
+xs_utf8_eucjp_inplace(SV* sv_str)
+{
+  xs_inplace(sv_str,xs_utf8_eucjp,uj_inplace_split_utf8);
+}
+
+EXTERN_C
+void
+xs_jis_sjis_inplace(SV* sv_str)
+{
+  xs_inplace(sv_str,xs_jis_sjis,uj_inplace_split_jis);
+}
+
+/* ----------------------------------------------------------------------------
+ * End of File.
+ * ------------------------------------------------------------------------- */
@@ -0,0 +1,95 @@
+/* ----------------------------------------------------------------------------
+ * inplace.h
+ * chunking for the in-place converters (inplace.c, c_lib/inplace.c).
+ * ----------------------------------------------------------------------------
+ * Mastering programed by YAMASHINA Hio
+ * ----------------------------------------------------------------------------
+ * $Id$
+ * ------------------------------------------------------------------------- */
+#ifndef UNICODE__JAPANESE__INPLACE_H__
+#define UNICODE__JAPANESE__INPLACE_H__
+
+/* utf8=>sjis, utf8=>eucjp and jis=>sjis do not make the text longer
+ * (but for the entity references of chars sjis does not have), so they
+ * can be run over the caller's buffer: the text is converted a chunk at
+ * a time into a scratch buffer, which is moved back to the front of the
+ * text.  that never passes the part not read yet, and when an entity
+ * reference would, the buffer is grown and the rest moved up.  the
+ * peak memory is the text and one chunk instead of the text twice.
+ *
+ * the chunks are cut where the converters start over, so the result is
+ * the same as converting the whole text at once.
+ */
+
+#include <stddef.h>
+
+#ifndef UJ_INLINE
+#ifdef _MSC_VER
+#define UJ_INLINE __inline
+#else
+#define UJ_INLINE __inline__
+#endif
+#endif
+
+#define UJ_INPLACE_CHUNK (64*1024)
+
+/* ----------------------------------------------------------------------------
+ * uj_inplace_split_utf8(src, len, want)
+ *   length of the next chunk of utf8 text: at most want bytes, cut
+ *   before the lead byte of a char.  a run of stray continuation bytes
+ *   is cut anywhere, as each of them is converted alone.
+ * ------------------------------------------------------------------------- */
+static UJ_INLINE size_t
+uj_inplace_split_utf8(const unsigned char* src, size_t len, size_t want)
+{
+  size_t end;
+  if( len<=want )
+  {
+    return len;
+  }
+  /* a sequence is 6 bytes at most. */
+  for( end=want; end>0 && end+6>want; --end )
+  {
+    if( (src[end] & 0xc0)!=0x80 )
+    {
+      return end;
+    }
+  }
+  return want;
+}
+
+/* ----------------------------------------------------------------------------
+ * uj_inplace_split_jis(src, len, want)
+ *   length of the next chunk of jis text: cut before an escape, as each
+ *   escape starts over from no mode.  the last escape within want bytes,
+ *   or the first one after when there is none.
+ * ------------------------------------------------------------------------- */
+static UJ_INLINE size_t
+uj_inplace_split_jis(const unsigned char* src, size_t len, size_t want)
+{
+  size_t end;
+  if( len<=want )
+  {
+    return len;
+  }
+  for( end=want; end>0; --end )
+  {
+    if( src[end]=='\x1b' )
+    {
+      return end;
+    }
+  }
+  for( end=want+1; end<len; ++end )
+  {
+    if( src[end]=='\x1b' )
+    {
+      return end;
+    }
+  }
+  return len;
+}
+
+#endif /* !defined(UNICODE__JAPANESE__INPLACE_H__) */
+/* ----------------------------------------------------------------------------
+ * End of File.
+ * ------------------------------------------------------------------------- */
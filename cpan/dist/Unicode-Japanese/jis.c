@@ -2,6 +2,7 @@
 /* $Id$ */
 
 #include "Japanese.h"
+#include "simd.h"
 #include "sjis.h"
 
 #include <string.h>
@@ -68,6 +69,10 @@ xs_sjis_jis(SV* sv_str)
   
   src = (unsigned char*)SvPV(sv_str,PL_na);
   len = sv_len(sv_str);
+  if( uj_is_plain_ascii(src, len) )
+  { /* ascii reads the same in every code. */
+    return SvREFCNT_inc(sv_str);
+  }
   ECHO_S2J((stderr,"Unicode::Japanese::(xs)sjis_jis, len:%d\n",len));
   ON_S2J(bin_dump("in ",src,len));
   SV_Buf_init(&result,len+8);
@@ -199,6 +204,10 @@ xs_jis_sjis(SV* sv_str)
   
   src = (unsigned char*)SvPV(sv_str,PL_na);
   len = sv_len(sv_str);
+  if( uj_is_plain_ascii(src, len) )
+  { /* ascii reads the same in every code. */
+    return SvREFCNT_inc(sv_str);
+  }
   ECHO_J2S((stderr,"Unicode::Japanese::(xs)jis_sjis, len:%d\n",len));
   ON_J2S(bin_dump("in ",src,len));
   SV_Buf_init(&result,len);
@@ -145,12 +145,27 @@ sub load_xs
     {
       sub do_memmap($){}
       sub do_memunmap($){}
+      # in-place conversions of a scalar (or scalar ref).
+      sub _u2s_inplace{ my $r = ref($_[1]) ? $_[1] : \$_[1]; defined($$r) and $$r = $_[0]->_u2s($$r); }
+      sub _u2e_inplace{ my $r = ref($_[1]) ? $_[1] : \$_[1]; defined($$r) and $$r = $_[0]->_s2e($_[0]->_u2s($$r)); }
+      sub _j2s_inplace{ my $r = ref($_[1]) ? $_[1] : \$_[1]; defined($$r) and $$r = $_[0]->_j2s($$r); }
     };
   }
   $xs_loaderror = '' if( !defined($xs_loaderror) );
   #print STDERR "load_xs done.\n";
 }
 
+# -----------------------------------------------------------------------------
+# $backend = Unicode::Japanese->backend();
+#   'XS' or 'PurePerl', whichever the conversions run on.
+#   why XS is not used is in $Unicode::Japanese::xs_loaderror.
+#
+sub backend
+{
+  defined($xs_loaderror) or Unicode::Japanese::PurePerl::_init_table();
+  $xs_loaderror eq '' ? 'XS' : 'PurePerl';
+}
+
 # -----------------------------------------------------------------------------
 # Unicode::Japanese->new();
 # cache for char conversion.
@@ -458,6 +473,15 @@ sub DESTROY
 {
 }
 
+# -----------------------------------------------------------------------------
+# Unicode::Japanese::PurePerl->backend()
+#   objects of this class never use XS.
+# 
+sub backend
+{
+  'PurePerl';
+}
+
 # -----------------------------------------------------------------------------
 # gensym
 # 
@@ -1563,6 +1587,21 @@ This module maps AU emoji to U+0FF500 - U+0FF6FF.
 If you want to explicitly take the pure perl implementation, pass
 C<'PurePerl'> to the argument of the C<use> statement.
 
+=over 4
+
+=item $backend = Unicode::Japanese->backend
+
+Returns C<'XS'> or C<'PurePerl'>, whichever implementation the
+conversions run on. When the XS could not be loaded, the pure perl
+implementation is taken without any warning, and the reason is left
+in C<$Unicode::Japanese::xs_loaderror>. Objects made by
+C<< Unicode::Japanese::PurePerl->new >> always return C<'PurePerl'>.
+
+B<ujcompare> runs the methods under both implementations and reports
+the speed ratio and the outputs which differ.
+
+=back
+
 
 =head1 BUGS
 
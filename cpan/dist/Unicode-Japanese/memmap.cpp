@@ -6,6 +6,9 @@
 #include <sys/mman.h> // memmap
 #include <sys/stat.h> // stat
 #include <fcntl.h>    // open
+#ifdef USE_ITHREADS
+#include <pthread.h>  // mutex
+#endif
 
 #ifndef MAP_FAILED
 #define MAP_FAILED ((void*)-1)
@@ -42,6 +45,27 @@ EXTERN_C
 
 }
 
+// the tables are mapped once for the process and shared by every
+// interpreter (ithreads) and thread.  each do_memmap (and CLONE) takes a
+// reference and each do_memunmap drops one; the files are unmapped with
+// the last one, so no thread sees the tables go away under it.
+static int g_mmap_users;
+#ifdef USE_ITHREADS
+static pthread_mutex_t g_mmap_mutex = PTHREAD_MUTEX_INITIALIZER;
+static void memmap_unlock(pTHX_ void* p)
+{
+  pthread_mutex_unlock(&g_mmap_mutex);
+}
+// locks until the end of the current perl scope, also when croaked.
+#define MEMMAP_LOCK() \
+  ( pthread_mutex_lock(&g_mmap_mutex), SAVEDESTRUCTOR_X(memmap_unlock,NULL) )
+#else
+#define MEMMAP_LOCK() ((void)0)
+#endif
+
+static void memmap_tables();
+static void memunmap_tables();
+
 static int
 findfile(AV* INC, const char* filename)
 {
@@ -75,6 +99,44 @@ void
 do_memmap()
 {
   //fprintf(stderr,"* Unicode::Japanese::(xs)do_memmap *\n");
+  ENTER;
+  MEMMAP_LOCK();
+  if( g_mmap_users==0 )
+  {
+    memmap_tables();
+  }
+  ++g_mmap_users;
+  LEAVE;
+}
+
+void
+do_memmap_clone()
+{
+  // a new interpreter shares the tables of the one it was cloned from.
+  ENTER;
+  MEMMAP_LOCK();
+  if( g_mmap_users!=0 )
+  {
+    ++g_mmap_users;
+  }
+  LEAVE;
+}
+
+void
+do_memunmap()
+{
+  ENTER;
+  MEMMAP_LOCK();
+  if( g_mmap_users!=0 && --g_mmap_users==0 )
+  {
+    memunmap_tables();
+  }
+  LEAVE;
+}
+
+static void
+memmap_tables()
+{
   AV* INC = get_av("INC",0);
   if( INC==NULL )
   {
@@ -139,21 +201,24 @@ do_memmap()
 
   if( g_mmap_u2s_start==MAP_FAILED || g_mmap_emj_start==MAP_FAILED )
   {
+    const char* what;
     if( g_mmap_u2s_start!=MAP_FAILED )
     {
-      Perl_croak(aTHX_ "do_memmap, mmap emoji table failed.");
+      what = "emoji table";
       g_mmap_emj_start = NULL;
     }else if( g_mmap_emj_start!=MAP_FAILED )
     {
-      Perl_croak(aTHX_ "do_memmap, mmap u2s table failed.");
+      what = "u2s table";
       g_mmap_u2s_start = NULL;
     }else
     {
-      Perl_croak(aTHX_ "do_memmap, mmap u2s and emoji table failed.");
+      what = "u2s and emoji table";
       g_mmap_u2s_start = NULL;
       g_mmap_emj_start = NULL;
     }
-    do_memunmap();
+    // unmap the other one before croak leaves.
+    memunmap_tables();
+    Perl_croak(aTHX_ "do_memmap, mmap %s failed.",what);
     return;
   }
 
@@ -176,8 +241,8 @@ do_memmap()
   g_ed2u_size  = 0x1400/4;
 }
 
-void
-do_memunmap()
+static void
+memunmap_tables()
 {
   // printf("* do_memunmap() *\n");
 
@@ -189,6 +254,7 @@ do_memunmap()
     {
       Perl_croak(aTHX_ "do_memunmap, munmap u2s table failed.");
     }
+    g_mmap_u2s_start = NULL;
   }
   // emoji table
   if( g_mmap_emj_start!=NULL )
@@ -198,5 +264,6 @@ do_memunmap()
     {
       Perl_croak(aTHX_ "do_memunmap, munmap emoji table failed.");
     }
+    g_mmap_emj_start = NULL;
   }
 }
@@ -60,6 +60,93 @@ UJ_UINT16 const* g_eu2a2s_table;
 int              g_eu2a2s_size;
 
 
+/* ----------------------------------------------------------------------------
+ * the tables are mapped once for the process and shared by every
+ * interpreter (ithreads) and thread.  each do_memmap (and CLONE) takes a
+ * reference and each do_memunmap drops one; the file is unmapped with
+ * the last one, so no thread sees the tables go away under it.
+ */
+extern void do_memmap_file(void);
+extern void do_memunmap_file(void);
+
+static int s_mmap_users;
+
+#ifndef USE_ITHREADS
+#define memmap_lock() ((void)0)
+#elif defined(WIN32)
+#include <windows.h>
+static LONG volatile s_mmap_lock;
+static void memmap_unlock(pTHX_ void* p)
+{
+  InterlockedExchange(&s_mmap_lock, 0);
+}
+/* locks until the end of the current perl scope, also when croaked. */
+static void memmap_lock(void)
+{
+  dTHX;
+  while( InterlockedExchange(&s_mmap_lock, 1)!=0 )
+  {
+    Sleep(0);
+  }
+  SAVEDESTRUCTOR_X(memmap_unlock, NULL);
+}
+#else
+#include <pthread.h>
+static pthread_mutex_t s_mmap_mutex = PTHREAD_MUTEX_INITIALIZER;
+static void memmap_unlock(pTHX_ void* p)
+{
+  pthread_mutex_unlock(&s_mmap_mutex);
+}
+/* locks until the end of the current perl scope, also when croaked. */
+static void memmap_lock(void)
+{
+  dTHX;
+  pthread_mutex_lock(&s_mmap_mutex);
+  SAVEDESTRUCTOR_X(memmap_unlock, NULL);
+}
+#endif
+
+void
+do_memmap(void)
+{
+  dTHX;
+  ENTER;
+  memmap_lock();
+  if( s_mmap_users==0 )
+  {
+    do_memmap_file();
+  }
+  ++s_mmap_users;
+  LEAVE;
+}
+
+/* a new interpreter shares the tables of the one it was cloned from. */
+void
+do_memmap_clone(void)
+{
+  dTHX;
+  ENTER;
+  memmap_lock();
+  if( s_mmap_users!=0 )
+  {
+    ++s_mmap_users;
+  }
+  LEAVE;
+}
+
+void
+do_memunmap(void)
+{
+  dTHX;
+  ENTER;
+  memmap_lock();
+  if( s_mmap_users!=0 && --s_mmap_users==0 )
+  {
+    do_memunmap_file();
+  }
+  LEAVE;
+}
+
 /* ----------------------------------------------------------------------------
  * split mapping table.
  */
@@ -18,11 +18,15 @@ static int   s_mmap_pmfile_size;
 /* split mapping table. */
 extern void do_memmap_set(const char* mmap_pmfile, int mmap_pmfile_size);
 
+/* called by do_memmap/do_memunmap (memmap_common.c) under its lock. */
+void do_memmap_file(void);
+void do_memunmap_file(void);
+
 /* ----------------------------------------------------------------------------
  * mmap data files.
  */
 void
-do_memmap(void)
+do_memmap_file(void)
 {
   int fd_pmfile;
   struct stat st_pmfile;
@@ -74,7 +78,7 @@ do_memmap(void)
  * ޥåפβ
  */
 void
-do_memunmap(void)
+do_memunmap_file(void)
 {
   /* printf("* do_memunmap() *\n"); */
 
@@ -84,6 +88,7 @@ do_memunmap(void)
     {
       Perl_warn(aTHX_ "Unicode::Japanese#do_memunmap, munmap failed: %s",strerror(errno));
     }
+    s_mmap_pmfile = NULL;
   }
   
   return;
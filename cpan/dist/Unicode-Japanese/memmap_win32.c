@@ -35,11 +35,15 @@ static int   s_mmap_pmfile_size;
 /* split mapping table. */
 extern void do_memmap_set(const char* mmap_pmfile, int mmap_pmfile_size);
 
+/* called by do_memmap/do_memunmap (memmap_common.c) under its lock. */
+void do_memmap_file(void);
+void do_memunmap_file(void);
+
 /* ----------------------------------------------------------------------------
  * ɬפʥե˥ޥåԥ
  */
 void
-do_memmap(void)
+do_memmap_file(void)
 {
   int fd_pmfile;
   DWORD dwFileSizeLow, dwFileSizeHigh;
@@ -102,13 +106,13 @@ do_memmap(void)
  * ޥåפβ
  */
 void
-do_memunmap(void)
+do_memunmap_file(void)
 {
   /* printf("* do_memunmap() *\n"); */
   if( s_mmap_pmfile!=NULL )
   {
     UnmapViewOfFile(s_mmap_pmfile);
-    s_mmap_pmfile;
+    s_mmap_pmfile = NULL;
   }
   if( hFileMapping!=NULL )
   {
@@ -0,0 +1,572 @@
+/* ----------------------------------------------------------------------------
+ * simd.h
+ * vector kernels for the unicode transcoders (utf16.c, ucs2_utf8.c, ucs4.c),
+ * the utf-8 validator (utf8.c) and the ascii check of the japanese
+ * transcoders (conv.c, eucjp.c, jis.c).
+ * ----------------------------------------------------------------------------
+ * Mastering programed by YAMASHINA Hio
+ * ----------------------------------------------------------------------------
+ * $Id$
+ * ------------------------------------------------------------------------- */
+#ifndef UNICODE__JAPANESE__SIMD_H__
+#define UNICODE__JAPANESE__SIMD_H__
+
+/* each kernel converts a run of whole blocks from the head of the input
+ * and stops at the first block which is not pure ascii (or, with ssse3,
+ * not pure 3-byte BMP).  it returns how much input was consumed, and
+ * the caller converts the next character with the scalar code.
+ * surrogates, overlong forms and short input are always left to the
+ * scalar code, so both paths produce identical output.
+ *
+ * the kernel is chosen at runtime from the cpu features.
+ * set UNIJP_NO_SIMD=1 in the environment to force the scalar code.
+ */
+
+#include <stdlib.h>
+
+/* Japanese.h (xs) or c_lib/xs_compat.h defines them before us;
+ * define them here if neither did. */
+#ifndef UJ_UINT8
+#define UJ_UINT8  unsigned char
+#define UJ_UINT16 unsigned short
+#define UJ_UINT32 unsigned int
+#endif
+
+#ifndef UJ_INLINE
+#ifdef _MSC_VER
+#define UJ_INLINE __inline
+#else
+#define UJ_INLINE __inline__
+#endif
+#endif
+
+#if !defined(UJ_NO_SIMD) \
+  && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__))) \
+  && (defined(__clang__) || (defined(__GNUC__) && __GNUC__>=5))
+#define UJ_SIMD_X86 1
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#define UJ_TARGET_SSSE3 __attribute__((target("ssse3")))
+#endif
+
+#define UJ_SIMD_NONE  0
+#define UJ_SIMD_SSE2  1
+#define UJ_SIMD_SSSE3 2
+
+/* blocks converted per kernel call, and the scratch buffer the caller
+ * hands to a kernel (64 bytes of output per block at most, plus slack
+ * for the overlapping 16 byte stores). */
+#define UJ_SIMD_BLOCKS 16
+#define UJ_SIMD_OUTBUF (UJ_SIMD_BLOCKS*64+16)
+
+/* ----------------------------------------------------------------------------
+ * uj_simd_level()
+ *   detects the vector unit once and returns UJ_SIMD_*.
+ *   safe to call from any thread: racing detections store the same value.
+ * ------------------------------------------------------------------------- */
+#ifdef UJ_SIMD_X86
+static UJ_INLINE int uj_simd_level(void)
+{
+  static int level = -1;
+  int detected = __atomic_load_n(&level, __ATOMIC_RELAXED);
+  if( detected<0 )
+  {
+    const char* env = getenv("UNIJP_NO_SIMD");
+    detected = UJ_SIMD_NONE;
+    if( env==NULL || env[0]=='\0' || env[0]=='0' )
+    {
+      __builtin_cpu_init();
+      if( __builtin_cpu_supports("sse2") )
+      {
+        detected = UJ_SIMD_SSE2;
+      }
+      if( __builtin_cpu_supports("ssse3") )
+      {
+        detected = UJ_SIMD_SSSE3;
+      }
+    }
+    __atomic_store_n(&level, detected, __ATOMIC_RELAXED);
+  }
+  return detected;
+}
+#else
+#define uj_simd_level() UJ_SIMD_NONE
+#endif
+
+/* ----------------------------------------------------------------------------
+ * uj_u16_bytes(ch, le), uj_u32_bytes(ch, le)
+ *   native integer whose in-memory bytes are ch in big (le==0) or
+ *   little (le!=0) endian, for SV_Buf_append_ch2/ch4.
+ * ------------------------------------------------------------------------- */
+static UJ_INLINE UJ_UINT16 uj_u16_bytes(UJ_UINT32 ch, int le)
+{
+  UJ_UINT16 v;
+  UJ_UINT8* p = (UJ_UINT8*)&v;
+  if( le )
+  {
+    p[0] = (UJ_UINT8)ch;
+    p[1] = (UJ_UINT8)(ch>>8);
+  }else
+  {
+    p[0] = (UJ_UINT8)(ch>>8);
+    p[1] = (UJ_UINT8)ch;
+  }
+  return v;
+}
+
+static UJ_INLINE UJ_UINT32 uj_u32_bytes(UJ_UINT32 ch, int le)
+{
+  UJ_UINT32 v;
+  UJ_UINT8* p = (UJ_UINT8*)&v;
+  if( le )
+  {
+    p[0] = (UJ_UINT8)ch;
+    p[1] = (UJ_UINT8)(ch>>8);
+    p[2] = (UJ_UINT8)(ch>>16);
+    p[3] = (UJ_UINT8)(ch>>24);
+  }else
+  {
+    p[0] = (UJ_UINT8)(ch>>24);
+    p[1] = (UJ_UINT8)(ch>>16);
+    p[2] = (UJ_UINT8)(ch>>8);
+    p[3] = (UJ_UINT8)ch;
+  }
+  return v;
+}
+
+#ifdef UJ_SIMD_X86
+
+/* ------------------------------------------------------------------------- */
+/* 16bit lanes helpers.                                                      */
+/* ------------------------------------------------------------------------- */
+#define UJ_SIMD_SET16(x) _mm_set1_epi16((short)(x))
+#define UJ_SIMD_SET32(x) _mm_set1_epi32((int)(x))
+#define UJ_SIMD_ALL(v)   (_mm_movemask_epi8(v)==0xffff)
+
+static UJ_INLINE __m128i uj_simd_bswap16(__m128i v)
+{
+  return _mm_or_si128(_mm_slli_epi16(v,8), _mm_srli_epi16(v,8));
+}
+
+/* every lane of u (native code units) is ascii. */
+static UJ_INLINE int uj_simd_u16_is_ascii(__m128i u)
+{
+  return UJ_SIMD_ALL(_mm_cmpeq_epi16(_mm_and_si128(u, UJ_SIMD_SET16(0xff80)),
+                                     _mm_setzero_si128()));
+}
+
+/* every lane of u is U+0800..U+FFFF except surrogates (3 bytes in utf-8). */
+static UJ_INLINE int uj_simd_u16_is_bmp3(__m128i u)
+{
+  const __m128i t = _mm_and_si128(u, UJ_SIMD_SET16(0xf800));
+  const __m128i bad = _mm_or_si128(_mm_cmpeq_epi16(t, _mm_setzero_si128()),
+                                   _mm_cmpeq_epi16(t, UJ_SIMD_SET16(0xd800)));
+  return _mm_movemask_epi8(bad)==0;
+}
+
+/* 8 native code units into 16 bytes of utf-16be/le. */
+static UJ_INLINE void uj_simd_store_u16(UJ_UINT8* dst, __m128i u, int le)
+{
+  _mm_storeu_si128((__m128i*)dst, le ? u : uj_simd_bswap16(u));
+}
+
+/* 8 native code units into 32 bytes of ucs-4be/le. */
+static UJ_INLINE void uj_simd_store_u32(UJ_UINT8* dst, __m128i u, int le)
+{
+  const __m128i zero = _mm_setzero_si128();
+  if( le )
+  {
+    _mm_storeu_si128((__m128i*)dst,      _mm_unpacklo_epi16(u, zero));
+    _mm_storeu_si128((__m128i*)(dst+16), _mm_unpackhi_epi16(u, zero));
+  }else
+  {
+    const __m128i s = uj_simd_bswap16(u);
+    _mm_storeu_si128((__m128i*)dst,      _mm_unpacklo_epi16(zero, s));
+    _mm_storeu_si128((__m128i*)(dst+16), _mm_unpackhi_epi16(zero, s));
+  }
+}
+
+/* 8 native 3-byte code units into 24 bytes of utf-8.
+ * writes 28 bytes, the last 4 are garbage. */
+UJ_TARGET_SSSE3
+static UJ_INLINE void uj_simd_store_bmp3(UJ_UINT8* dst, __m128i u)
+{
+  const __m128i b0 = _mm_or_si128(_mm_srli_epi16(u,12), UJ_SIMD_SET16(0xe0));
+  const __m128i b1 = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(u,6), UJ_SIMD_SET16(0x3f)),
+                                  UJ_SIMD_SET16(0x80));
+  const __m128i b2 = _mm_or_si128(_mm_and_si128(u, UJ_SIMD_SET16(0x3f)),
+                                  UJ_SIMD_SET16(0x80));
+  const __m128i b01 = _mm_or_si128(b0, _mm_slli_epi16(b1,8));
+  const __m128i bb2 = _mm_packus_epi16(b2, b2);
+  const __m128i lo  = _mm_unpacklo_epi64(b01, bb2);
+  const __m128i hi  = _mm_unpackhi_epi64(b01, _mm_slli_si128(bb2,4));
+  const __m128i shuf = _mm_setr_epi8(0,1,8, 2,3,9, 4,5,10, 6,7,11,
+                                     -1,-1,-1,-1);
+  _mm_storeu_si128((__m128i*)dst,      _mm_shuffle_epi8(lo, shuf));
+  _mm_storeu_si128((__m128i*)(dst+12), _mm_shuffle_epi8(hi, shuf));
+}
+
+/* 24 bytes of utf-8 at src as 8 native 3-byte code units, when they are
+ * exactly 8 well-formed, non-overlong, non-surrogate 3-byte sequences.
+ * reads 28 bytes. */
+UJ_TARGET_SSSE3
+static UJ_INLINE int uj_simd_load_bmp3(const UJ_UINT8* src, __m128i* p_u)
+{
+  const __m128i s0 = _mm_loadu_si128((const __m128i*)src);
+  const __m128i s1 = _mm_loadu_si128((const __m128i*)(src+12));
+  const __m128i m0 = _mm_setr_epi8(0,-1,3,-1,6,-1, 9,-1, -1,-1,-1,-1,-1,-1,-1,-1);
+  const __m128i m1 = _mm_setr_epi8(1,-1,4,-1,7,-1,10,-1, -1,-1,-1,-1,-1,-1,-1,-1);
+  const __m128i m2 = _mm_setr_epi8(2,-1,5,-1,8,-1,11,-1, -1,-1,-1,-1,-1,-1,-1,-1);
+  const __m128i c0 = _mm_unpacklo_epi64(_mm_shuffle_epi8(s0,m0), _mm_shuffle_epi8(s1,m0));
+  const __m128i c1 = _mm_unpacklo_epi64(_mm_shuffle_epi8(s0,m1), _mm_shuffle_epi8(s1,m1));
+  const __m128i c2 = _mm_unpacklo_epi64(_mm_shuffle_epi8(s0,m2), _mm_shuffle_epi8(s1,m2));
+  const __m128i ok =
+    _mm_and_si128(_mm_cmpeq_epi16(_mm_and_si128(c0, UJ_SIMD_SET16(0xf0)), UJ_SIMD_SET16(0xe0)),
+    _mm_and_si128(_mm_cmpeq_epi16(_mm_and_si128(c1, UJ_SIMD_SET16(0xc0)), UJ_SIMD_SET16(0x80)),
+                  _mm_cmpeq_epi16(_mm_and_si128(c2, UJ_SIMD_SET16(0xc0)), UJ_SIMD_SET16(0x80))));
+  __m128i u;
+  if( !UJ_SIMD_ALL(ok) )
+  {
+    return 0;
+  }
+  u = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(c0, UJ_SIMD_SET16(0x0f)), 12),
+      _mm_or_si128(_mm_slli_epi16(_mm_and_si128(c1, UJ_SIMD_SET16(0x3f)), 6),
+                   _mm_and_si128(c2, UJ_SIMD_SET16(0x3f))));
+  if( !uj_simd_u16_is_bmp3(u) )
+  {
+    return 0;
+  }
+  *p_u = u;
+  return 1;
+}
+
+/* ------------------------------------------------------------------------- */
+/* utf-16/ucs-2 (be/le) => utf-8.                                            */
+/* ------------------------------------------------------------------------- */
+static UJ_INLINE size_t uj_simd_u16_utf8_sse2(const UJ_UINT8* src, size_t units, int le, UJ_UINT8* dst, size_t* p_dst_len)
+{
+  size_t i;
+  size_t blocks = units/8 < UJ_SIMD_BLOCKS ? units/8 : UJ_SIMD_BLOCKS;
+  UJ_UINT8* dst_begin = dst;
+  for( i=0; i<blocks; ++i )
+  {
+    __m128i u = _mm_loadu_si128((const __m128i*)(src+i*16));
+    if( !le )
+    {
+      u = uj_simd_bswap16(u);
+    }
+    if( !uj_simd_u16_is_ascii(u) )
+    {
+      break;
+    }
+    _mm_storel_epi64((__m128i*)dst, _mm_packus_epi16(u, u));
+    dst += 8;
+  }
+  *p_dst_len = dst-dst_begin;
+  return i*8;
+}
+
+UJ_TARGET_SSSE3
+static UJ_INLINE size_t uj_simd_u16_utf8_ssse3(const UJ_UINT8* src, size_t units, int le, UJ_UINT8* dst, size_t* p_dst_len)
+{
+  size_t i;
+  size_t blocks = units/8 < UJ_SIMD_BLOCKS ? units/8 : UJ_SIMD_BLOCKS;
+  UJ_UINT8* dst_begin = dst;
+  for( i=0; i<blocks; ++i )
+  {
+    __m128i u = _mm_loadu_si128((const __m128i*)(src+i*16));
+    if( !le )
+    {
+      u = uj_simd_bswap16(u);
+    }
+    if( uj_simd_u16_is_ascii(u) )
+    {
+      _mm_storel_epi64((__m128i*)dst, _mm_packus_epi16(u, u));
+      dst += 8;
+    }else if( uj_simd_u16_is_bmp3(u) )
+    {
+      uj_simd_store_bmp3(dst, u);
+      dst += 24;
+    }else
+    {
+      break;
+    }
+  }
+  *p_dst_len = dst-dst_begin;
+  return i*8;
+}
+
+/* returns code units consumed (0 when the head block is mixed). */
+static UJ_INLINE size_t uj_simd_u16_utf8(int level, const UJ_UINT8* src, size_t units, int le, UJ_UINT8* dst, size_t* p_dst_len)
+{
+  return level>=UJ_SIMD_SSSE3
+    ? uj_simd_u16_utf8_ssse3(src, units, le, dst, p_dst_len)
+    : uj_simd_u16_utf8_sse2(src, units, le, dst, p_dst_len);
+}
+
+/* ------------------------------------------------------------------------- */
+/* utf-8 => utf-16/ucs-2 (width==2) or ucs-4 (width==4), be/le.              */
+/* ------------------------------------------------------------------------- */
+static UJ_INLINE void uj_simd_store_ascii16(UJ_UINT8* dst, __m128i v, int width, int le)
+{
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i lo = _mm_unpacklo_epi8(v, zero);
+  const __m128i hi = _mm_unpackhi_epi8(v, zero);
+  if( width==2 )
+  {
+    uj_simd_store_u16(dst,    lo, le);
+    uj_simd_store_u16(dst+16, hi, le);
+  }else
+  {
+    uj_simd_store_u32(dst,    lo, le);
+    uj_simd_store_u32(dst+32, hi, le);
+  }
+}
+
+static UJ_INLINE size_t uj_simd_utf8_uN_sse2(const UJ_UINT8* src, size_t len, int width, int le, UJ_UINT8* dst, size_t* p_dst_len)
+{
+  size_t i;
+  size_t blocks = len/16 < UJ_SIMD_BLOCKS ? len/16 : UJ_SIMD_BLOCKS;
+  UJ_UINT8* dst_begin = dst;
+  for( i=0; i<blocks; ++i )
+  {
+    const __m128i v = _mm_loadu_si128((const __m128i*)(src+i*16));
+    if( _mm_movemask_epi8(v)!=0 )
+    {
+      break;
+    }
+    uj_simd_store_ascii16(dst, v, width, le);
+    dst += 16*width;
+  }
+  *p_dst_len = dst-dst_begin;
+  return i*16;
+}
+
+UJ_TARGET_SSSE3
+static UJ_INLINE size_t uj_simd_utf8_uN_ssse3(const UJ_UINT8* src, size_t len, int width, int le, UJ_UINT8* dst, size_t* p_dst_len)
+{
+  const UJ_UINT8* src_begin = src;
+  const UJ_UINT8* src_end   = src+len;
+  UJ_UINT8* dst_begin = dst;
+  int i;
+  for( i=0; i<UJ_SIMD_BLOCKS; ++i )
+  {
+    __m128i u;
+    if( src_end-src>=16 )
+    {
+      const __m128i v = _mm_loadu_si128((const __m128i*)src);
+      if( _mm_movemask_epi8(v)==0 )
+      {
+        uj_simd_store_ascii16(dst, v, width, le);
+        dst += 16*width;
+        src += 16;
+        continue;
+      }
+    }
+    if( src_end-src>=28 && uj_simd_load_bmp3(src, &u) )
+    {
+      if( width==2 )
+      {
+        uj_simd_store_u16(dst, u, le);
+      }else
+      {
+        uj_simd_store_u32(dst, u, le);
+      }
+      dst += 8*width;
+      src += 24;
+      continue;
+    }
+    break;
+  }
+  *p_dst_len = dst-dst_begin;
+  return src-src_begin;
+}
+
+/* returns bytes consumed (0 when the head block is mixed). */
+static UJ_INLINE size_t uj_simd_utf8_uN(int level, const UJ_UINT8* src, size_t len, int width, int le, UJ_UINT8* dst, size_t* p_dst_len)
+{
+  return level>=UJ_SIMD_SSSE3
+    ? uj_simd_utf8_uN_ssse3(src, len, width, le, dst, p_dst_len)
+    : uj_simd_utf8_uN_sse2(src, len, width, le, dst, p_dst_len);
+}
+
+/* ------------------------------------------------------------------------- */
+/* ucs-4 (be/le) => utf-8.                                                   */
+/* ------------------------------------------------------------------------- */
+static UJ_INLINE size_t uj_simd_u32_utf8_sse2(const UJ_UINT8* src, size_t units, int le, UJ_UINT8* dst, size_t* p_dst_len)
+{
+  size_t i;
+  size_t blocks = units/8 < UJ_SIMD_BLOCKS ? units/8 : UJ_SIMD_BLOCKS;
+  const __m128i mask = le ? UJ_SIMD_SET32(0xffffff80) : UJ_SIMD_SET32(0x80ffffff);
+  UJ_UINT8* dst_begin = dst;
+  for( i=0; i<blocks; ++i )
+  {
+    __m128i a = _mm_loadu_si128((const __m128i*)(src+i*32));
+    __m128i b = _mm_loadu_si128((const __m128i*)(src+i*32+16));
+    const __m128i nz = _mm_or_si128(_mm_and_si128(a,mask), _mm_and_si128(b,mask));
+    __m128i u;
+    if( !UJ_SIMD_ALL(_mm_cmpeq_epi32(nz, _mm_setzero_si128())) )
+    {
+      break;
+    }
+    if( !le )
+    {
+      a = _mm_srli_epi32(a,24);
+      b = _mm_srli_epi32(b,24);
+    }
+    u = _mm_packs_epi32(a, b);
+    _mm_storel_epi64((__m128i*)dst, _mm_packus_epi16(u, u));
+    dst += 8;
+  }
+  *p_dst_len = dst-dst_begin;
+  return i*8;
+}
+
+UJ_TARGET_SSSE3
+static UJ_INLINE size_t uj_simd_u32_utf8_ssse3(const UJ_UINT8* src, size_t units, int le, UJ_UINT8* dst, size_t* p_dst_len)
+{
+  size_t i;
+  size_t blocks = units/8 < UJ_SIMD_BLOCKS ? units/8 : UJ_SIMD_BLOCKS;
+  const __m128i hi_mask = le ? UJ_SIMD_SET32(0xffff0000) : UJ_SIMD_SET32(0x0000ffff);
+  const __m128i shuf = le
+    ? _mm_setr_epi8(0,1,4,5,8,9,12,13, -1,-1,-1,-1,-1,-1,-1,-1)
+    : _mm_setr_epi8(3,2,7,6,11,10,15,14, -1,-1,-1,-1,-1,-1,-1,-1);
+  UJ_UINT8* dst_begin = dst;
+  for( i=0; i<blocks; ++i )
+  {
+    const __m128i a = _mm_loadu_si128((const __m128i*)(src+i*32));
+    const __m128i b = _mm_loadu_si128((const __m128i*)(src+i*32+16));
+    const __m128i nz = _mm_or_si128(_mm_and_si128(a,hi_mask), _mm_and_si128(b,hi_mask));
+    __m128i u;
+    if( !UJ_SIMD_ALL(_mm_cmpeq_epi32(nz, _mm_setzero_si128())) )
+    {
+      break;
+    }
+    u = _mm_unpacklo_epi64(_mm_shuffle_epi8(a,shuf), _mm_shuffle_epi8(b,shuf));
+    if( uj_simd_u16_is_ascii(u) )
+    {
+      _mm_storel_epi64((__m128i*)dst, _mm_packus_epi16(u, u));
+      dst += 8;
+    }else if( uj_simd_u16_is_bmp3(u) )
+    {
+      uj_simd_store_bmp3(dst, u);
+      dst += 24;
+    }else
+    {
+      break;
+    }
+  }
+  *p_dst_len = dst-dst_begin;
+  return i*8;
+}
+
+/* returns code units consumed (0 when the head block is mixed). */
+static UJ_INLINE size_t uj_simd_u32_utf8(int level, const UJ_UINT8* src, size_t units, int le, UJ_UINT8* dst, size_t* p_dst_len)
+{
+  return level>=UJ_SIMD_SSSE3
+    ? uj_simd_u32_utf8_ssse3(src, units, le, dst, p_dst_len)
+    : uj_simd_u32_utf8_sse2(src, units, le, dst, p_dst_len);
+}
+
+/* ------------------------------------------------------------------------- */
+/* utf-8 validation (utf8.c).                                                */
+/* ------------------------------------------------------------------------- */
+/* returns the bytes (whole blocks) at the head of src in which no byte can
+ * start an overlong or out of range form, ie. none of 0xc0, 0xc1, 0xe0,
+ * 0xf0 or 0xf4..0xff. */
+static UJ_INLINE size_t uj_simd_utf8_clean_sse2(const UJ_UINT8* src, size_t len)
+{
+  const __m128i fe = _mm_set1_epi8((char)0xfe);
+  const __m128i c0 = _mm_set1_epi8((char)0xc0);
+  const __m128i e0 = _mm_set1_epi8((char)0xe0);
+  const __m128i f0 = _mm_set1_epi8((char)0xf0);
+  const __m128i f4 = _mm_set1_epi8((char)0xf4);
+  size_t done = 0;
+  while( done+16<=len )
+  {
+    __m128i v = _mm_loadu_si128((const __m128i*)(src+done));
+    __m128i hit = _mm_cmpeq_epi8(_mm_and_si128(v, fe), c0);
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, e0));
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, f0));
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi8(_mm_max_epu8(v, f4), v));
+    if( _mm_movemask_epi8(hit)!=0 )
+    {
+      break;
+    }
+    done += 16;
+  }
+  return done;
+}
+
+/* returns bytes skipped (0 when the head block has a candidate). */
+static UJ_INLINE size_t uj_simd_utf8_clean(int level, const UJ_UINT8* src, size_t len)
+{
+  (void)level;
+  return uj_simd_utf8_clean_sse2(src, len);
+}
+
+/* ------------------------------------------------------------------------- */
+/* ascii check (conv.c, eucjp.c, jis.c).                                     */
+/* ------------------------------------------------------------------------- */
+/* returns the bytes (whole blocks) at the head of src which are ascii
+ * other than ESC. */
+static UJ_INLINE size_t uj_simd_ascii_sse2(const UJ_UINT8* src, size_t len)
+{
+  const __m128i esc = _mm_set1_epi8(0x1b);
+  size_t done = 0;
+  while( done+16<=len )
+  {
+    __m128i v = _mm_loadu_si128((const __m128i*)(src+done));
+    if( _mm_movemask_epi8(_mm_or_si128(v, _mm_cmpeq_epi8(v, esc)))!=0 )
+    {
+      break;
+    }
+    done += 16;
+  }
+  return done;
+}
+
+static UJ_INLINE size_t uj_simd_ascii(int level, const UJ_UINT8* src, size_t len)
+{
+  (void)level;
+  return uj_simd_ascii_sse2(src, len);
+}
+
+#else /* !UJ_SIMD_X86 */
+
+/* scalar only build: the kernels never consume anything. */
+#define uj_simd_u16_utf8(level,src,units,le,dst,p_dst_len)      ((void)(dst),*(p_dst_len)=0,(size_t)0)
+#define uj_simd_utf8_uN(level,src,len,width,le,dst,p_dst_len)  ((void)(dst),*(p_dst_len)=0,(size_t)0)
+#define uj_simd_u32_utf8(level,src,units,le,dst,p_dst_len)      ((void)(dst),*(p_dst_len)=0,(size_t)0)
+#define uj_simd_utf8_clean(level,src,len)                        ((void)(src),(size_t)0)
+#define uj_simd_ascii(level,src,len)                             ((void)(src),(size_t)0)
+
+#endif /* UJ_SIMD_X86 */
+
+/* ----------------------------------------------------------------------------
+ * uj_is_plain_ascii(src, len)
+ *   true when src is ascii without ESC.  such a text reads the same in
+ *   sjis, eucjp, jis and utf8, so the transcoders return it as is.
+ * ------------------------------------------------------------------------- */
+static UJ_INLINE int uj_is_plain_ascii(const UJ_UINT8* src, size_t len)
+{
+  const UJ_UINT8* src_end = src + len;
+  const int simd = uj_simd_level();
+  if( simd )
+  {
+    src += uj_simd_ascii(simd, src, len);
+  }
+  for( ; src<src_end; ++src )
+  {
+    if( *src>=0x80 || *src=='\x1b' )
+    {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+#endif /* !defined(UNICODE__JAPANESE__SIMD_H__) */
+/* ----------------------------------------------------------------------------
+ * End Of File.
+ * ------------------------------------------------------------------------- */
@@ -0,0 +1,418 @@
+/* ----------------------------------------------------------------------------
+ * sjis_carrier.h
+ * sjis(mobile carrier) <=> utf8 kernel.
+ * ----------------------------------------------------------------------------
+ * Mastering programed by YAMASHINA Hio
+ * ----------------------------------------------------------------------------
+ * $Id$
+ * ------------------------------------------------------------------------- */
+
+/* this file is included once by each carrier source (sjis_imode1.c,
+ * sjis_imode2.c, sjis_jsky1.c, sjis_jsky2.c, sjis_doti.c), which first
+ * defines the carrier traits below.  both conversion functions are
+ * expanded for that carrier, so the carriers share one loop and only
+ * differ in how the emoji are found and written.
+ *
+ * always:
+ *   CARRIER_S2U         name of the sjis => utf8 function.
+ *   CARRIER_U2S         name of the utf8 => sjis function.
+ *   CARRIER_EU2_REV     emoji (U+FE000..) => sjis map (see emoji_rev.h).
+ *
+ * carriers writing emoji as a double-byte sjis code (i-mode, dot-i):
+ *   CARRIER_EI2U        emoji (sjis) => utf8 table, 4 bytes per entry.
+ *   CARRIER_LEAD_MIN    range of the lead byte of the emoji.
+ *   CARRIER_LEAD_MAX
+ *   CARRIER_ENTITY_MIN  range of "&#ddddd;" references to the emoji.
+ *   CARRIER_ENTITY_MAX
+ *
+ * carriers writing emoji as escape sequences (j-sky):
+ *   CARRIER_JSKY        defined as 1.
+ *   CARRIER_JSKY_PAGE(ch)  emoji => utf8 table for the page letter ch
+ *                       ("\x1b$" ch ... "\x0f"), or NULL.
+ *                       utf8 => sjis writes the emoji of the same page
+ *                       in one escape.
+ */
+
+#ifndef CARRIER_JSKY
+#define CARRIER_JSKY 0
+#endif
+
+#if CARRIER_JSKY
+#define CARRIER_ESCAPE '\x1b'
+#else
+#define CARRIER_ESCAPE '&'
+#endif
+
+#include <string.h>
+#include "emoji_rev.h"
+
+#ifndef UNICODE__JAPANESE__SJIS_CARRIER_H__
+#define UNICODE__JAPANESE__SJIS_CARRIER_H__
+
+/* ----------------------------------------------------------------------------
+ * sjis part, common to the carriers.
+ * ------------------------------------------------------------------------- */
+
+/* append utf8 of an entry in g_s2u_table (3 bytes, nul padded). */
+static void
+carrier_append_s2u(SV_Buf* result, const UJ_UINT8* ptr)
+{
+  if( ptr[2] )
+  {
+    SV_Buf_append_mem(result, ptr, 3);
+  }else if( ptr[1] )
+  {
+    SV_Buf_append_mem(result, ptr, 2);
+  }else if( ptr[0] )
+  {
+    SV_Buf_append_ch(result, *ptr);
+  }else
+  {
+    SV_Buf_append_ch(result, '?');
+  }
+}
+
+/* append utf8 of an emoji table entry (4 bytes, nul padded). */
+static void
+carrier_append_emoji(SV_Buf* result, const UJ_UINT8* str)
+{
+  SV_Buf_append_mem(result, str, str[3] ? 4 : strlen((const char*)str));
+}
+
+/* append sjis of a code point out of the carrier emoji area. */
+static void
+carrier_append_u2s(SV_Buf* result, UJ_UINT32 ucs)
+{
+  const UJ_UINT8* sjis_ptr;
+  if( ucs<=0x9FFF )
+  {
+    sjis_ptr = (const UJ_UINT8*)g_u2s_table + ucs*2;
+  }else if( 0xF900<=ucs && ucs<=0xFFFF )
+  {
+    sjis_ptr = (const UJ_UINT8*)g_u2s_table + (ucs - 0xF900 + 0xA000)*2;
+  }else
+  {
+    SV_Buf_append_ch(result, '?');
+    return;
+  }
+  if( sjis_ptr[1]!=0 )
+  {
+    SV_Buf_append_mem(result, sjis_ptr, 2);
+  }else if( sjis_ptr[0]!=0 )
+  {
+    SV_Buf_append_ch(result, sjis_ptr[0]);
+  }else if( ucs<=0x7F )
+  {
+    SV_Buf_append_ch(result, (UJ_UINT8)ucs);
+  }else
+  {
+    SV_Buf_append_ch(result, '?');
+  }
+}
+
+/* ----------------------------------------------------------------------------
+ * decode one non-ascii utf8 char at *p_src.
+ * returns its code point and advances *p_src, or returns 0 and advances
+ * *p_src over the bytes which are written as a single '?'.
+ * ------------------------------------------------------------------------- */
+static UJ_UINT32
+carrier_decode_utf8(const UJ_UINT8** p_src, const UJ_UINT8* src_end)
+{
+  static const UJ_UINT32 ucs_min[5] = { 0, 0, 0x80, 0x800, 0x010000, };
+  const UJ_UINT8* src = *p_src;
+  UJ_UINT32 ucs;
+  int utf8_len;
+  int i;
+
+  if( 0xc0<=*src && *src<=0xdf )
+  {
+    utf8_len = 2;
+  }else if( *src<=0xef )
+  {
+    utf8_len = *src>=0xe0 ? 3 : 0;
+  }else if( *src<=0xf7 )
+  {
+    utf8_len = 4;
+  }else if( *src<=0xfb )
+  {
+    utf8_len = 5;
+  }else
+  {
+    utf8_len = *src<=0xfd ? 6 : 0;
+  }
+
+  /* check length and follow sequences. */
+  if( utf8_len==0 || src_end-src<utf8_len )
+  {
+    *p_src = src+1;
+    return 0;
+  }
+  ucs = src[0] & (0x7f>>utf8_len);
+  for( i=1; i<utf8_len; ++i )
+  {
+    if( src[i]<0x80 || 0xbf<src[i] )
+    {
+      *p_src = src+1;
+      return 0;
+    }
+    ucs = (ucs<<6) | (src[i] & 0x3f);
+  }
+  *p_src = src+utf8_len;
+
+  /* > U+10FFFF not supported by UTF-8 (RFC 3629), and overlong forms. */
+  if( utf8_len>4 || ucs<ucs_min[utf8_len] || ucs>0x10FFFF )
+  {
+    return 0;
+  }
+  return ucs;
+}
+
+#endif /* !defined(UNICODE__JAPANESE__SJIS_CARRIER_H__) */
+
+/* ----------------------------------------------------------------------------
+ * SV* sv_utf8 = CARRIER_S2U(SV* sv_sjis)
+ * convert sjis(carrier) into utf8.
+ * ------------------------------------------------------------------------- */
+EXTERN_C
+SV*
+CARRIER_S2U(SV* sv_str)
+{
+  STRLEN len;
+  const UJ_UINT8* src;
+  const UJ_UINT8* src_end;
+  SV_Buf result;
+
+  if( sv_str==&PL_sv_undef )
+  {
+    return newSVsv(&PL_sv_undef);
+  }
+
+  src = (const UJ_UINT8*)SvPV(sv_str, len);
+  src_end = src+len;
+  SV_Buf_init(&result, len*3/2+4);
+
+  while( src<src_end )
+  {
+    const UJ_UINT8* ptr;
+    if( src[0]<0x80 )
+    {
+      /* ascii chars sequence up to the next emoji escape. */
+      const UJ_UINT8* begin = src;
+      while( src<src_end && src[0]<0x80 && src[0]!=CARRIER_ESCAPE )
+      {
+        ++src;
+      }
+      if( src!=begin )
+      {
+        SV_Buf_append_mem(&result, begin, src-begin);
+        continue;
+      }
+#if CARRIER_JSKY
+      /* "\x1b$" page chars... "\x0f" */
+      if( src+2<src_end && src[1]=='$' && CARRIER_JSKY_PAGE(src[2])!=NULL )
+      {
+        const UJ_UINT32* table = CARRIER_JSKY_PAGE(src[2]);
+        begin = src+3;
+        src = begin;
+        while( src<src_end && '!'<=src[0] && src[0]<='z' )
+        {
+          ++src;
+        }
+        /* accept with terminator, or without it at the end of string. */
+        if( src==src_end || src[0]==0x0f )
+        {
+          for( ptr=begin; ptr<src; ++ptr )
+          {
+            carrier_append_emoji(&result, (const UJ_UINT8*)&table[*ptr]);
+          }
+          if( src<src_end )
+          {
+            ++src;
+          }
+          continue;
+        }
+        /* invalid, rollback. */
+        src = begin-3;
+      }
+#else
+      /* "&#ddddd;" */
+      if( src+3<src_end && src[1]=='#' )
+      {
+        int num = 0;
+        const UJ_UINT8* ptr_end = src_end-src>10 ? src+10 : src_end;
+        for( ptr=src+2; ptr<ptr_end; ++ptr )
+        {
+          if( *ptr<'0' || '9'<*ptr ) break;
+          num = num*10 + *ptr-'0';
+        }
+        if( ptr<ptr_end && *ptr==';'
+            && CARRIER_ENTITY_MIN<=num && num<=CARRIER_ENTITY_MAX )
+        {
+          const UJ_UINT8* emoji = (const UJ_UINT8*)&CARRIER_EI2U[num-CARRIER_ENTITY_MIN];
+          if( emoji[3] )
+          {
+            SV_Buf_append_mem(&result, emoji, 4);
+            src = ptr+1;
+            continue;
+          }
+        }
+      }
+#endif
+      SV_Buf_append_ch(&result, *src);
+      ++src;
+      continue;
+    }else if( 0xa1<=src[0] && src[0]<=0xdf )
+    { /* half-width katakana */
+      ptr = (const UJ_UINT8*)&g_s2u_table[(src[0]-0xa1)*3];
+      ++src;
+    }else if( src+1<src_end && 0x81<=src[0] && src[0]<=0x9f )
+    { /* a double-byte letter */
+      const UJ_UINT16 sjis = (src[0]<<8)+src[1]; /* ntohs */
+      ptr = (const UJ_UINT8*)&g_s2u_table[(sjis - 0x8100 + 0x3f)*3];
+      src += 2;
+#if !CARRIER_JSKY
+    }else if( src+1<src_end && CARRIER_LEAD_MIN<=src[0] && src[0]<=CARRIER_LEAD_MAX )
+    { /* emoji */
+      const UJ_UINT32* emoji = &CARRIER_EI2U[((src[0]-CARRIER_LEAD_MIN)<<8)|src[1]];
+      if( *emoji!=0 )
+      {
+        carrier_append_emoji(&result, (const UJ_UINT8*)emoji);
+        src += 2;
+        continue;
+      }else
+      {
+        const UJ_UINT16 sjis = (src[0]<<8)+src[1]; /* ntohs */
+        ptr = (const UJ_UINT8*)&g_s2u_table[(sjis - 0xe000 + 0x1f3f)*3];
+        src += 2;
+      }
+#endif
+    }else if( src+1<src_end && 0xe0<=src[0] && src[0]<=0xfc )
+    { /* a double-byte letter */
+      const UJ_UINT16 sjis = (src[0]<<8)+src[1]; /* ntohs */
+      ptr = (const UJ_UINT8*)&g_s2u_table[(sjis - 0xe000 + 0x1f3f)*3];
+      src += 2;
+    }else
+    { /* unknown */
+      SV_Buf_append_ch(&result, '?');
+      ++src;
+      continue;
+    }
+    carrier_append_s2u(&result, ptr);
+  }
+  SV_Buf_setLength(&result);
+
+  return SV_Buf_getSv(&result);
+}
+
+/* ----------------------------------------------------------------------------
+ * SV* sv_sjis = CARRIER_U2S(SV* sv_utf8)
+ * convert utf8 into sjis(carrier).
+ * ------------------------------------------------------------------------- */
+#if CARRIER_JSKY
+/* close the open j-sky escape, if any. */
+#define CARRIER_JSKY_CLOSE() \
+  if( jsky_page!=0 ) \
+  { \
+    SV_Buf_append_ch(&result, '\x0f'); \
+    jsky_page = 0; \
+  }
+#else
+#define CARRIER_JSKY_CLOSE()
+#endif
+
+EXTERN_C
+SV*
+CARRIER_U2S(SV* sv_str)
+{
+  STRLEN len;
+  const UJ_UINT8* src;
+  const UJ_UINT8* src_end;
+  SV_Buf result;
+#if CARRIER_JSKY
+  UJ_UINT8 jsky_page = 0; /* page letter of the open "\x1b$" escape. */
+#endif
+
+  if( sv_str==&PL_sv_undef )
+  {
+    return newSVsv(&PL_sv_undef);
+  }
+
+  src = (const UJ_UINT8*)SvPV(sv_str, len);
+  src_end = src+len;
+  SV_Buf_init(&result, len+4);
+
+  while( src<src_end )
+  {
+    UJ_UINT32 ucs;
+    const UJ_UINT8* sjis;
+
+    if( *src<=0x7f )
+    {
+      /* ascii chars sequence. */
+      const UJ_UINT8* begin = src;
+      while( src<src_end && *src<=0x7f )
+      {
+        ++src;
+      }
+      CARRIER_JSKY_CLOSE();
+      SV_Buf_append_mem(&result, begin, src-begin);
+      continue;
+    }
+
+    ucs = carrier_decode_utf8(&src, src_end);
+    if( ucs==0 || (0x0f0000<=ucs && ucs<0x0fe000) )
+    { /* invalid, or unknown area. */
+      sjis = (const UJ_UINT8*)"?";
+    }else if( 0x0fe000<=ucs && ucs<=0x0fffff )
+    { /* private area: block emoji */
+      sjis = uj_emoji_rev_lookup(&CARRIER_EU2_REV, ucs);
+    }else
+    {
+      CARRIER_JSKY_CLOSE();
+      carrier_append_u2s(&result, ucs);
+      continue;
+    }
+
+#if CARRIER_JSKY
+    if( UJ_EMOJI_REV_IS_JSKY(sjis) && CARRIER_JSKY_PAGE(UJ_EMOJI_REV_JSKY_PAGE(sjis))!=NULL )
+    { /* emoji of the same page share one escape. */
+      if( jsky_page!=UJ_EMOJI_REV_JSKY_PAGE(sjis) )
+      {
+        CARRIER_JSKY_CLOSE();
+        jsky_page = UJ_EMOJI_REV_JSKY_PAGE(sjis);
+        SV_Buf_append_mem(&result, (const UJ_UINT8*)"\x1b$", 2);
+        SV_Buf_append_ch(&result, jsky_page);
+      }
+      SV_Buf_append_ch(&result, sjis[1]);
+      continue;
+    }
+    CARRIER_JSKY_CLOSE();
+    if( UJ_EMOJI_REV_IS_JSKY(sjis) )
+    { /* page of the other carrier. */
+      SV_Buf_append_mem(&result, (const UJ_UINT8*)"\x1b$", 2);
+      SV_Buf_append_ch(&result, UJ_EMOJI_REV_JSKY_PAGE(sjis));
+      SV_Buf_append_ch(&result, sjis[1]);
+      SV_Buf_append_ch(&result, '\x0f');
+      continue;
+    }
+#endif
+    if( sjis[1]!=0 )
+    { /* double-byte char */
+      SV_Buf_append_mem(&result, sjis, 2);
+    }else
+    {
+      SV_Buf_append_ch(&result, sjis[0]);
+    }
+  } /* while */
+  CARRIER_JSKY_CLOSE();
+
+  SV_Buf_setLength(&result);
+  return SV_Buf_getSv(&result);
+}
+
+#undef CARRIER_JSKY_CLOSE
+#undef CARRIER_ESCAPE
+
+/* ----------------------------------------------------------------------------
+ * End Of File.
+ * ------------------------------------------------------------------------- */
@@ -0,0 +1,22 @@
+## ----------------------------------------------------------------------------
+# t/backend.t
+# -----------------------------------------------------------------------------
+# $Id$
+# -----------------------------------------------------------------------------
+
+use strict;
+use Test::More tests => 4;
+use Unicode::Japanese;
+
+# -----------------------------------------------------------------------------
+# backend follows xs_loaderror.
+
+my $backend = Unicode::Japanese->backend;
+like($backend, qr/^(XS|PurePerl)$/, "backend: $backend");
+is($backend eq 'XS', $Unicode::Japanese::xs_loaderror eq '', 'XS iff no xs_loaderror');
+is(Unicode::Japanese->new('')->backend, $backend, 'same on an object');
+
+# -----------------------------------------------------------------------------
+# PurePerl objects never use XS.
+
+is(Unicode::Japanese::PurePerl->new('')->backend, 'PurePerl', 'PurePerl object');
@@ -8,6 +8,7 @@
 
 
 #include "Japanese.h"
+#include "simd.h"
 
 #undef ENABLE_SURROGATE_PAIR
 
@@ -23,6 +24,9 @@ xs_ucs2_utf8(SV* sv_str)
   SV_Buf result;
   const UJ_UINT8* src_end;
   UJ_UINT8 buf[4];
+  const int simd = uj_simd_level();
+  const UJ_UINT8* simd_retry;
+  UJ_UINT8 simd_buf[UJ_SIMD_OUTBUF];
 
   if( sv_str==&PL_sv_undef )
   {
@@ -41,9 +45,26 @@ xs_ucs2_utf8(SV* sv_str)
     Perl_croak(aTHX_ "Unicode::Japanese::ucs2_utf8, invalid length (not 2*n)");
   }
 
-  for(; src<src_end; src+=2 )
+  simd_retry = src;
+  while( src<src_end )
   {
-    const UJ_UINT16 ucs2 = (src[0]<<8)+src[1]; /* ntohs */
+    UJ_UINT16 ucs2;
+    if( simd && src>=simd_retry )
+    {
+      size_t out_len;
+      size_t n = uj_simd_u16_utf8(simd, src, (src_end-src)/2, 0, simd_buf, &out_len);
+      if( n!=0 )
+      {
+        SV_Buf_append_mem(&result, simd_buf, out_len);
+        src += n*2;
+        continue;
+      }
+      /* mixed block, walk through it with scalar code. */
+      simd_retry = src+16;
+    }
+
+    ucs2 = (src[0]<<8)+src[1]; /* ntohs */
+    src += 2;
     if( ucs2<0x80 )
     {
       SV_Buf_append_ch(&result,(UJ_UINT8)ucs2);
@@ -60,23 +81,22 @@ xs_ucs2_utf8(SV* sv_str)
       SV_Buf_append_mem(&result, buf, 3);
     }else
     { /* surrogate pair */
-      if( src+2<src_end )
+      if( src<src_end )
       {
 #ifdef ENABLE_SURROGATE_PAIR
         const UJ_UINT16 ucs2a = (src[0]<<8)+src[1]; /* ntohs */
         const UJ_UINT32 ucs4  = ((ucs2&0x03FF)<<10|(ucs2a&0x3FF))+0x010000;
-        src += 2;
-        if( 0x010000<=ucs4 && ucs4<=0x1FFFFF )
+        if( ucs2<=0xdbff && 0xdc00<=ucs2a && ucs2a<=0xdfff )
         {
-          buf[0] = 0xF0 | ((ucs2>>18) & 0x3F);
-          buf[1] = 0x80 | ((ucs2>>12) & 0x3F);
-          buf[2] = 0x80 | ((ucs2>>6) & 0x3F);
-          buf[3] = 0x80 | (ucs2 & 0x3F);
+          src += 2;
+          buf[0] = 0xF0 | ((ucs4>>18) & 0x07);
+          buf[1] = 0x80 | ((ucs4>>12) & 0x3F);
+          buf[2] = 0x80 | ((ucs4>>6) & 0x3F);
+          buf[3] = 0x80 | (ucs4 & 0x3F);
           SV_Buf_append_mem(&result, buf, 4);
         }else
         {
-          /* utf8 not support >= U+1FFFFF */
-          /* or illegal representation */
+          /* invalid surrogate */
           SV_Buf_append_ch(&result,'?');
         }
 #else
@@ -110,6 +130,9 @@ xs_utf8_ucs2(SV* sv_str)
   int len;
   SV_Buf result;
   const UJ_UINT8* src_end;
+  const int simd = uj_simd_level();
+  const UJ_UINT8* simd_retry;
+  UJ_UINT8 simd_buf[UJ_SIMD_OUTBUF];
 
   if( sv_str==&PL_sv_undef )
   {
@@ -122,10 +145,24 @@ xs_utf8_ucs2(SV* sv_str)
   /*fprintf(stderr,"Unicode::Japanese::(xs)utf8_ucs2\n",len); */
   /*bin_dump("in ",src,len); */
   SV_Buf_init(&result,len*2);
+  simd_retry = src;
   
   while( src<src_end )
   {
     UJ_UINT32 ucs;
+    if( simd && src>=simd_retry )
+    {
+      size_t out_len;
+      size_t n = uj_simd_utf8_uN(simd, src, src_end-src, 2, 0, simd_buf, &out_len);
+      if( n!=0 )
+      {
+        SV_Buf_append_mem(&result, simd_buf, out_len);
+        src += n;
+        continue;
+      }
+      /* mixed block, walk through it with scalar code. */
+      simd_retry = src+16;
+    }
     if( *src<=0x7f )
     { /* ascii. */
       SV_Buf_append_ch2(&result,htons(*src));
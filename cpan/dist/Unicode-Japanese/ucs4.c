@@ -8,104 +8,99 @@
 
 
 #include "Japanese.h"
+#include "simd.h"
 
 /* ----------------------------------------------------------------------------
- * convert ucs4 into utf-8
+ * ucs-4 (be/le) into utf-8, appended to result.
  * ------------------------------------------------------------------------- */
-EXTERN_C
-SV*
-xs_ucs4_utf8(SV* sv_str)
+static void
+ucs4_utf8_conv(SV_Buf* result, const UJ_UINT8* src, const UJ_UINT8* src_end, int le)
 {
-  UJ_UINT8* src;
-  int len;
-  SV_Buf result;
-  const UJ_UINT8* src_end;
+  const int simd = uj_simd_level();
+  const UJ_UINT8* simd_retry = src;
+  UJ_UINT8 simd_buf[UJ_SIMD_OUTBUF];
   UJ_UINT8 buf[4];
 
-  if( sv_str==&PL_sv_undef )
-  {
-    return newSVpvn("",0);
-  }
-  
-  src = (UJ_UINT8*)SvPV(sv_str,PL_na);
-  len = sv_len(sv_str);
-  src_end = src+(len&~1);
-  /*fprintf(stderr,"Unicode::Japanese::(xs)ucs4_utf8\n",len);*/
-  /*bin_dump("in ",src,len);*/
-  SV_Buf_init(&result,len*3/2+4);
-
-  if( len&3 )
+  while( src<src_end )
   {
-    Perl_croak(aTHX_ "Unicode::Japanese::ucs4_utf8, invalid length (not 4*n)");
-  }
+    UJ_UINT32 ucs4;
+    if( simd && src>=simd_retry )
+    {
+      size_t out_len;
+      size_t n = uj_simd_u32_utf8(simd, src, (src_end-src)/4, le, simd_buf, &out_len);
+      if( n!=0 )
+      {
+        SV_Buf_append_mem(result, simd_buf, out_len);
+        src += n*4;
+        continue;
+      }
+      /* mixed block, walk through it with scalar code. */
+      simd_retry = src+32;
+    }
 
-  for(; src<src_end; src+=4 )
-  {
-    const UJ_UINT32 ucs4 = (src[0]<<24)+(src[1]<<16)+(src[2]<<8)+src[3]; /* ntohs */
+    ucs4 = le
+      ? ((UJ_UINT32)src[3]<<24)+(src[2]<<16)+(src[1]<<8)+src[0]
+      : ((UJ_UINT32)src[0]<<24)+(src[1]<<16)+(src[2]<<8)+src[3]; /* ntohl */
+    src += 4;
     if( ucs4<0x80 )
     {
-      SV_Buf_append_ch(&result,(UJ_UINT8)ucs4);
+      SV_Buf_append_ch(result,(UJ_UINT8)ucs4);
     }else if( ucs4<0x800 )
     {
       buf[0] = 0xC0 | (ucs4 >> 6);
       buf[1] = 0x80 | (ucs4 & 0x3F);
-      SV_Buf_append_mem(&result, buf, 2);
+      SV_Buf_append_mem(result, buf, 2);
     }else if( ucs4 < 0x10000 )
     {
       buf[0] = 0xE0 | (ucs4 >> 12);
       buf[1] = 0x80 | ((ucs4 >> 6) & 0x3F);
       buf[2] = 0x80 | (ucs4 & 0x3F);
-      SV_Buf_append_mem(&result, buf, 3);
+      SV_Buf_append_mem(result, buf, 3);
     }else if( ucs4 <= 0x0010FFFF )
     {
       buf[0] = 0xF0 |  (ucs4 >> 18);
       buf[1] = 0x80 | ((ucs4 >> 12) & 0x3F);
       buf[2] = 0x80 | ((ucs4 >>  6) & 0x3F);
       buf[3] = 0x80 | ( ucs4        & 0x3F);
-      SV_Buf_append_mem(&result, buf, 4);
+      SV_Buf_append_mem(result, buf, 4);
     }else
     {
-      SV_Buf_append_ch(&result,'?');
+      SV_Buf_append_ch(result,'?');
     }
   }
-
-  /*bin_dump("out",result.getBegin(),result.getLength()); */
-  SV_Buf_setLength(&result);
-
-  return SV_Buf_getSv(&result);
 }
 
 /* ----------------------------------------------------------------------------
- * convert utf-8 into ucs4
+ * utf-8 into ucs-4 (be/le), appended to result.
  * ------------------------------------------------------------------------- */
-EXTERN_C
-SV*
-xs_utf8_ucs4(SV* sv_str)
+static void
+utf8_ucs4_conv(SV_Buf* result, const UJ_UINT8* src, const UJ_UINT8* src_end, int le)
 {
-  UJ_UINT8* src;
-  int len;
-  SV_Buf result;
-  const UJ_UINT8* src_end;
-  const UJ_UINT8 buf_failed[4] = { 0, 0, 0, '?' };
+  const int simd = uj_simd_level();
+  const UJ_UINT8* simd_retry = src;
+  UJ_UINT8 simd_buf[UJ_SIMD_OUTBUF];
+  const UJ_UINT32 failed = uj_u32_bytes('?',le);
 
-  if( sv_str==&PL_sv_undef )
-  {
-    return newSVpvn("",0);
-  }
-  
-  src = (UJ_UINT8*)SvPV(sv_str,PL_na);
-  len = sv_len(sv_str);
-  src_end = src+len;
-  /*fprintf(stderr,"Unicode::Japanese::(xs)utf8_ucs4\n",len); */
-  /*bin_dump("in ",src,len); */
-  SV_Buf_init(&result,len*4);
-  
   while( src<src_end )
   {
     UJ_UINT32 ucs;
+    if( simd && src>=simd_retry )
+    {
+      size_t out_len;
+      size_t n = uj_simd_utf8_uN(simd, src, src_end-src, 4, le, simd_buf, &out_len);
+      if( n!=0 )
+      {
+        SV_Buf_append_mem(result, simd_buf, out_len);
+        src += n;
+        continue;
+      }
+      /* mixed block, walk through it with scalar code. */
+      simd_retry = src+16;
+    }
+
     if( *src<=0x7f )
     { /* ascii. */
-      SV_Buf_append_ch4(&result,htonl(*src));
+      SV_Buf_append_ch4(result,uj_u32_bytes(*src,le));
       ++src;
       continue;
     }
@@ -117,7 +112,7 @@ xs_utf8_ucs4(SV* sv_str)
       if( src+1>=src_end ||
           src[1]<0x80 || 0xbf<src[1] )
       {
-        SV_Buf_append_ch4(&result,htonl(*src));
+        SV_Buf_append_ch4(result,uj_u32_bytes(*src,le));
         ++src;
         continue;
       }
@@ -129,7 +124,7 @@ xs_utf8_ucs4(SV* sv_str)
       { /* noop */
       }else
       { /* illegal sequence */
-        SV_Buf_append_ch4(&result, *(UJ_UINT32*)buf_failed);
+        SV_Buf_append_ch4(result, failed);
         continue;
       }
       
@@ -143,7 +138,7 @@ xs_utf8_ucs4(SV* sv_str)
           src[1]<0x80 || 0xbf<src[1] ||
           src[2]<0x80 || 0xbf<src[2] )
       {
-        SV_Buf_append_ch4(&result,htonl(*src));
+        SV_Buf_append_ch4(result,uj_u32_bytes(*src,le));
         ++src;
         continue;
       }
@@ -155,7 +150,7 @@ xs_utf8_ucs4(SV* sv_str)
       { /* noop */
       }else
       { /* illegal sequence */
-        SV_Buf_append_ch4(&result, *(UJ_UINT32*)buf_failed);
+        SV_Buf_append_ch4(result, failed);
         continue;
       }
       
@@ -163,7 +158,7 @@ xs_utf8_ucs4(SV* sv_str)
       { /* normal char, noop */
       }else
       { /* delete surrogate pair range */
-        SV_Buf_append_ch4(&result, *(UJ_UINT32*)buf_failed);
+        SV_Buf_append_ch4(result, failed);
         continue;
       }
       
@@ -178,7 +173,7 @@ xs_utf8_ucs4(SV* sv_str)
           src[2]<0x80 || 0xbf<src[2] ||
           src[3]<0x80 || 0xbf<src[3] )
       {
-        SV_Buf_append_ch4(&result,htonl(*src));
+        SV_Buf_append_ch4(result,uj_u32_bytes(*src,le));
         ++src;
         continue;
       }
@@ -191,7 +186,7 @@ xs_utf8_ucs4(SV* sv_str)
       { /* noop */
       }else
       { /* illegal sequence */
-        SV_Buf_append_ch4(&result, *(UJ_UINT32*)buf_failed);
+        SV_Buf_append_ch4(result, failed);
         continue;
       }
       
@@ -203,7 +198,7 @@ xs_utf8_ucs4(SV* sv_str)
       { /* noop */
       }else
       { /* no enough sequence */
-        SV_Buf_append_ch4(&result, *(UJ_UINT32*)buf_failed);
+        SV_Buf_append_ch4(result, failed);
         ++src;
         continue;
       }
@@ -213,14 +208,14 @@ xs_utf8_ucs4(SV* sv_str)
       { /* noop */
       }else
       {
-        SV_Buf_append_ch4(&result, *(UJ_UINT32*)buf_failed);
+        SV_Buf_append_ch4(result, failed);
         ++src;
         continue;
       }
       
       /* compute code point */
       src += utf8_len;
-      SV_Buf_append_ch4(&result, *(UJ_UINT32*)buf_failed);
+      SV_Buf_append_ch4(result, failed);
       continue;
     }else if( 0xfc<=*src && *src<=0xfd )
     {
@@ -229,7 +224,7 @@ xs_utf8_ucs4(SV* sv_str)
       { /* noop */
       }else
       { /* no enough sequence */
-        SV_Buf_append_ch4(&result, *(UJ_UINT32*)buf_failed);
+        SV_Buf_append_ch4(result, failed);
         ++src;
         continue;
       }
@@ -240,27 +235,140 @@ xs_utf8_ucs4(SV* sv_str)
       { /* noop */
       }else
       {
-        SV_Buf_append_ch4(&result, *(UJ_UINT32*)buf_failed);
+        SV_Buf_append_ch4(result, failed);
         ++src;
         continue;
       }
       
       /* compute code point */
       src += utf8_len;
-      SV_Buf_append_ch4(&result, *(UJ_UINT32*)buf_failed);
+      SV_Buf_append_ch4(result, failed);
       continue;
     }else
     { /* invalid */
-      SV_Buf_append_ch4(&result,htonl(*src));
+      SV_Buf_append_ch4(result,uj_u32_bytes(*src,le));
       ++src;
       continue;
     }
 
-    SV_Buf_append_ch4(&result,htonl(ucs));
+    SV_Buf_append_ch4(result,uj_u32_bytes(ucs,le));
     /*bin_dump("now",dst_begin,dst-dst_begin); */
   }
+}
+
+/* ----------------------------------------------------------------------------
+ * convert ucs4 into utf-8
+ * ------------------------------------------------------------------------- */
+EXTERN_C
+SV*
+xs_ucs4_utf8(SV* sv_str)
+{
+  UJ_UINT8* src;
+  int len;
+  SV_Buf result;
+
+  if( sv_str==&PL_sv_undef )
+  {
+    return newSVpvn("",0);
+  }
+  
+  src = (UJ_UINT8*)SvPV(sv_str,PL_na);
+  len = sv_len(sv_str);
+  SV_Buf_init(&result,len*3/2+4);
+
+  if( len&3 )
+  {
+    Perl_croak(aTHX_ "Unicode::Japanese::ucs4_utf8, invalid length (not 4*n)");
+  }
+
+  ucs4_utf8_conv(&result, src, src+len, 0);
+
+  SV_Buf_setLength(&result);
+
+  return SV_Buf_getSv(&result);
+}
+
+/* ----------------------------------------------------------------------------
+ * convert ucs4le into utf-8
+ * ------------------------------------------------------------------------- */
+EXTERN_C
+SV*
+xs_ucs4le_utf8(SV* sv_str)
+{
+  UJ_UINT8* src;
+  int len;
+  SV_Buf result;
+
+  if( sv_str==&PL_sv_undef )
+  {
+    return newSVpvn("",0);
+  }
+  
+  src = (UJ_UINT8*)SvPV(sv_str,PL_na);
+  len = sv_len(sv_str);
+  SV_Buf_init(&result,len*3/2+4);
+
+  if( len&3 )
+  {
+    Perl_croak(aTHX_ "Unicode::Japanese::ucs4le_utf8, invalid length (not 4*n)");
+  }
+
+  ucs4_utf8_conv(&result, src, src+len, 1);
+
+  SV_Buf_setLength(&result);
+
+  return SV_Buf_getSv(&result);
+}
+
+/* ----------------------------------------------------------------------------
+ * convert utf-8 into ucs4
+ * ------------------------------------------------------------------------- */
+EXTERN_C
+SV*
+xs_utf8_ucs4(SV* sv_str)
+{
+  UJ_UINT8* src;
+  int len;
+  SV_Buf result;
+
+  if( sv_str==&PL_sv_undef )
+  {
+    return newSVpvn("",0);
+  }
+  
+  src = (UJ_UINT8*)SvPV(sv_str,PL_na);
+  len = sv_len(sv_str);
+  SV_Buf_init(&result,len*4);
+
+  utf8_ucs4_conv(&result, src, src+len, 0);
+
+  SV_Buf_setLength(&result);
+
+  return SV_Buf_getSv(&result);
+}
+
+/* ----------------------------------------------------------------------------
+ * convert utf-8 into ucs4le
+ * ------------------------------------------------------------------------- */
+EXTERN_C
+SV*
+xs_utf8_ucs4le(SV* sv_str)
+{
+  UJ_UINT8* src;
+  int len;
+  SV_Buf result;
+
+  if( sv_str==&PL_sv_undef )
+  {
+    return newSVpvn("",0);
+  }
+  
+  src = (UJ_UINT8*)SvPV(sv_str,PL_na);
+  len = sv_len(sv_str);
+  SV_Buf_init(&result,len*4);
+
+  utf8_ucs4_conv(&result, src, src+len, 1);
 
-  /*bin_dump("out",result.getBegin(),result.getLength()); */
   SV_Buf_setLength(&result);
 
   return SV_Buf_getSv(&result);
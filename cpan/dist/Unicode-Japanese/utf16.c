@@ -8,61 +8,59 @@
 
 
 #include "Japanese.h"
+#include "simd.h"
 
 #define ENABLE_SURROGATE_PAIR 1
 
 /* ----------------------------------------------------------------------------
- * convert utf-16 into utf-8
+ * utf-16 (be/le) into utf-8, appended to result.
  * ------------------------------------------------------------------------- */
-EXTERN_C
-SV*
-xs_utf16_utf8(SV* sv_str)
+static void
+utf16_utf8_conv(SV_Buf* result, const UJ_UINT8* src, const UJ_UINT8* src_end, int le)
 {
-  UJ_UINT8* src;
-  int len;
-  SV_Buf result;
-  const UJ_UINT8* src_end;
+  const int simd = uj_simd_level();
+  const UJ_UINT8* simd_retry = src;
+  UJ_UINT8 simd_buf[UJ_SIMD_OUTBUF];
   UJ_UINT8 buf[4];
 
-  if( sv_str==&PL_sv_undef )
-  {
-    return newSVpvn("",0);
-  }
-  
-  src = (UJ_UINT8*)SvPV(sv_str,PL_na);
-  len = sv_len(sv_str);
-  src_end = src+(len&~1);
-  /*fprintf(stderr,"Unicode::Japanese::(xs)utf16_utf8\n",len);*/
-  /*bin_dump("in ",src,len);*/
-  SV_Buf_init(&result,len*3/2+4);
-
-  if( len&1 )
+  while( src<src_end )
   {
-    Perl_croak(aTHX_ "Unicode::Japanese::utf16_utf8, invalid length (not 2*n)");
-  }
+    UJ_UINT16 utf16;
+    if( simd && src>=simd_retry )
+    {
+      size_t out_len;
+      size_t n = uj_simd_u16_utf8(simd, src, (src_end-src)/2, le, simd_buf, &out_len);
+      if( n!=0 )
+      {
+        SV_Buf_append_mem(result, simd_buf, out_len);
+        src += n*2;
+        continue;
+      }
+      /* mixed block, walk through it with scalar code. */
+      simd_retry = src+16;
+    }
 
-  for(; src<src_end; src+=2 )
-  {
-    const UJ_UINT16 utf16 = (src[0]<<8)+src[1]; /* ntohs */
+    utf16 = le ? (src[1]<<8)+src[0] : (src[0]<<8)+src[1]; /* ntohs */
+    src += 2;
     if( utf16<0x80 )
     {
-      SV_Buf_append_ch(&result,(UJ_UINT8)utf16);
+      SV_Buf_append_ch(result,(UJ_UINT8)utf16);
     }else if( utf16<0x800 )
     {
       buf[0] = 0xC0 | (utf16 >> 6);
       buf[1] = 0x80 | (utf16 & 0x3F);
-      SV_Buf_append_ch2(&result, *(UJ_UINT16*)buf);
+      SV_Buf_append_ch2(result, *(UJ_UINT16*)buf);
     }else if( !(0xd800 <= utf16 && utf16 <= 0xdfff) )
     { /* normal char (non surrogate pair) */
       buf[0] = 0xE0 | (utf16 >> 12);
       buf[1] = 0x80 | ((utf16 >> 6) & 0x3F);
       buf[2] = 0x80 | (utf16 & 0x3F);
-      SV_Buf_append_ch3(&result,*(UJ_UINT32*)buf);
+      SV_Buf_append_ch3(result,*(UJ_UINT32*)buf);
     }else
     { /* surrogate pair */
-      if( src+2<src_end )
+      if( src<src_end )
       {
-        const UJ_UINT16 utf16a = (src[2]<<8)+src[3]; /* ntohs */
+        const UJ_UINT16 utf16a = le ? (src[1]<<8)+src[0] : (src[0]<<8)+src[1]; /* ntohs */
         if( utf16<=0xdbff && 0xdc00 <= utf16a && utf16a <= 0xdfff )
         {
 #if ENABLE_SURROGATE_PAIR
@@ -74,68 +72,63 @@ xs_utf16_utf8(SV* sv_str)
             buf[1] = 0x80 | ((ucs4>>12) & 0x3F);
             buf[2] = 0x80 | ((ucs4>>6) & 0x3F);
             buf[3] = 0x80 | (ucs4 & 0x3F);
-            SV_Buf_append_ch4(&result,*(UJ_UINT32*)buf);
+            SV_Buf_append_ch4(result,*(UJ_UINT32*)buf);
           }else
           {
             /* utf8 not support >= U+10FFFF */
             /* or illegal representation */
-            SV_Buf_append_ch(&result,'?');
+            SV_Buf_append_ch(result,'?');
           }
 #else
           {
             /* surrogate pair disabled. */
-            SV_Buf_append_ch(&result,'?');
+            SV_Buf_append_ch(result,'?');
           }
 #endif
         }else
         {
           /* invalid surrogate */
-          SV_Buf_append_ch(&result,'?');
+          SV_Buf_append_ch(result,'?');
         }
       }else
       {
         /* no trail surrogate */
-        SV_Buf_append_ch(&result,'?');
+        SV_Buf_append_ch(result,'?');
       }
     }
   }
-
-  /*bin_dump("out",result.getBegin(),result.getLength()); */
-  SV_Buf_setLength(&result);
-
-  return SV_Buf_getSv(&result);
 }
 
 /* ----------------------------------------------------------------------------
- * convert utf-8 into utf-16
+ * utf-8 into utf-16 (be/le), appended to result.
  * ------------------------------------------------------------------------- */
-EXTERN_C
-SV*
-xs_utf8_utf16(SV* sv_str)
+static void
+utf8_utf16_conv(SV_Buf* result, const UJ_UINT8* src, const UJ_UINT8* src_end, int le)
 {
-  UJ_UINT8* src;
-  int len;
-  SV_Buf result;
-  const UJ_UINT8* src_end;
+  const int simd = uj_simd_level();
+  const UJ_UINT8* simd_retry = src;
+  UJ_UINT8 simd_buf[UJ_SIMD_OUTBUF];
 
-  if( sv_str==&PL_sv_undef )
-  {
-    return newSVpvn("",0);
-  }
-  
-  src = (UJ_UINT8*)SvPV(sv_str,PL_na);
-  len = sv_len(sv_str);
-  src_end = src+len;
-  /*fprintf(stderr,"Unicode::Japanese::(xs)utf8_utf16\n",len); */
-  /*bin_dump("in ",src,len); */
-  SV_Buf_init(&result,len*2);
-  
   while( src<src_end )
   {
     UJ_UINT32 ucs;
+    if( simd && src>=simd_retry )
+    {
+      size_t out_len;
+      size_t n = uj_simd_utf8_uN(simd, src, src_end-src, 2, le, simd_buf, &out_len);
+      if( n!=0 )
+      {
+        SV_Buf_append_mem(result, simd_buf, out_len);
+        src += n;
+        continue;
+      }
+      /* mixed block, walk through it with scalar code. */
+      simd_retry = src+16;
+    }
+
     if( *src<=0x7f )
     {
-      SV_Buf_append_ch2(&result,htons(*src));
+      SV_Buf_append_ch2(result,uj_u16_bytes(*src,le));
       ++src;
       continue;
     }
@@ -147,11 +140,11 @@ xs_utf8_utf16(SV* sv_str)
       if( src+1>=src_end ||
           src[1]<0x80 || 0xbf<src[1] )
       {
-        SV_Buf_append_ch2(&result,htons(*src));
+        SV_Buf_append_ch2(result,uj_u16_bytes(*src,le));
         ++src;
         continue;
       }
-      
+
       /* compute code point */
       ucs = ((src[0] & 0x1F)<<6)|(src[1] & 0x3F);
       src += utf8_len;
@@ -159,10 +152,10 @@ xs_utf8_utf16(SV* sv_str)
       { /* noop */
       }else
       { /* illegal sequence */
-        SV_Buf_append_ch2(&result,htons('?'));
+        SV_Buf_append_ch2(result,uj_u16_bytes('?',le));
         continue;
       }
-      
+
       /* ok. */
     }else if( 0xe0<=*src && *src<=0xef )
     { /* length [3] */
@@ -173,11 +166,11 @@ xs_utf8_utf16(SV* sv_str)
           src[1]<0x80 || 0xbf<src[1] ||
           src[2]<0x80 || 0xbf<src[2] )
       {
-        SV_Buf_append_ch2(&result,htons(*src));
+        SV_Buf_append_ch2(result,uj_u16_bytes(*src,le));
         ++src;
         continue;
       }
-      
+
       /* compute code point */
       ucs = ((src[0] & 0x0F)<<12)|((src[1] & 0x3F)<<6)|(src[2] & 0x3F);
       src += utf8_len;
@@ -185,18 +178,18 @@ xs_utf8_utf16(SV* sv_str)
       { /* noop */
       }else
       { /* illegal sequence */
-        SV_Buf_append_ch2(&result,htons('?'));
+        SV_Buf_append_ch2(result,uj_u16_bytes('?',le));
         continue;
       }
-      
+
       if( ucs<0xD800 || ucs>0xDBFF )
       { /* normal char, noop */
       }else
       { /* delete surrogate pair range */
-        SV_Buf_append_ch2(&result,htons('?'));
+        SV_Buf_append_ch2(result,uj_u16_bytes('?',le));
         continue;
       }
-      
+
       /* ok. */
     }else if( 0xf0<=*src && *src<=0xf7 )
     { /* length [4] */
@@ -208,11 +201,11 @@ xs_utf8_utf16(SV* sv_str)
           src[2]<0x80 || 0xbf<src[2] ||
           src[3]<0x80 || 0xbf<src[3] )
       {
-        SV_Buf_append_ch2(&result,htons(*src));
+        SV_Buf_append_ch2(result,uj_u16_bytes(*src,le));
         ++src;
         continue;
       }
-      
+
       /* compute code point */
       ucs = ((src[0] & 0x07)<<18)|((src[1] & 0x3F)<<12)|
              ((src[2] & 0x3f) << 6)|(src[3] & 0x3F);
@@ -221,24 +214,24 @@ xs_utf8_utf16(SV* sv_str)
       { /* noop */
       }else
       { /* illegal sequence */
-        SV_Buf_append_ch2(&result,htons('?'));
+        SV_Buf_append_ch2(result,uj_u16_bytes('?',le));
         continue;
       }
-      
+
 #if ENABLE_SURROGATE_PAIR
       { /* encode surrogate pair */
         const UJ_UINT32 surrogate = ucs - 0x010000;
-        SV_Buf_append_ch2(&result,htons(((surrogate>>10)&0x03FF)|0xD800));
-        SV_Buf_append_ch2(&result,htons(((surrogate    )&0x03FF)|0xDC00));
+        SV_Buf_append_ch2(result,uj_u16_bytes(((surrogate>>10)&0x03FF)|0xD800,le));
+        SV_Buf_append_ch2(result,uj_u16_bytes(((surrogate    )&0x03FF)|0xDC00,le));
         continue;
       }
 #else
       { /* not supported */
-        SV_Buf_append_ch2(&result,htons('?'));
+        SV_Buf_append_ch2(result,uj_u16_bytes('?',le));
         continue;
       }
 #endif
-      
+
       /* ok. */
     }else if( 0xf8<=*src && *src<=0xfb )
     {
@@ -247,7 +240,7 @@ xs_utf8_utf16(SV* sv_str)
       { /* noop */
       }else
       { /* no enough sequence */
-        SV_Buf_append_ch2(&result,htons('?'));
+        SV_Buf_append_ch2(result,uj_u16_bytes('?',le));
         ++src;
         continue;
       }
@@ -257,14 +250,14 @@ xs_utf8_utf16(SV* sv_str)
       { /* noop */
       }else
       {
-        SV_Buf_append_ch2(&result,htons('?'));
+        SV_Buf_append_ch2(result,uj_u16_bytes('?',le));
         ++src;
         continue;
       }
-      
+
       /* compute code point */
       src += utf8_len;
-      SV_Buf_append_ch2(&result,htons('?'));
+      SV_Buf_append_ch2(result,uj_u16_bytes('?',le));
       continue;
     }else if( 0xfc<=*src && *src<=0xfd )
     {
@@ -273,7 +266,7 @@ xs_utf8_utf16(SV* sv_str)
       { /* noop */
       }else
       { /* no enough sequence */
-        SV_Buf_append_ch2(&result,htons('?'));
+        SV_Buf_append_ch2(result,uj_u16_bytes('?',le));
         ++src;
         continue;
       }
@@ -284,30 +277,60 @@ xs_utf8_utf16(SV* sv_str)
       { /* noop */
       }else
       {
-        SV_Buf_append_ch2(&result,htons('?'));
+        SV_Buf_append_ch2(result,uj_u16_bytes('?',le));
         ++src;
         continue;
       }
-      
+
       /* compute code point */
       src += utf8_len;
-      SV_Buf_append_ch2(&result,htons('?'));
+      SV_Buf_append_ch2(result,uj_u16_bytes('?',le));
       continue;
     }else
     { /* invalid */
-      SV_Buf_append_ch2(&result,htons(*src));
+      SV_Buf_append_ch2(result,uj_u16_bytes(*src,le));
       ++src;
       continue;
     }
 
     if( ucs & ~0xFFFF )
     { /* utf16ϰϳ (ucs4ϰ) */
-      SV_Buf_append_ch2(&result,htons('?'));
+      SV_Buf_append_ch2(result,uj_u16_bytes('?',le));
       continue;
     }
-    SV_Buf_append_ch2(&result,htons(ucs));
+    SV_Buf_append_ch2(result,uj_u16_bytes(ucs,le));
     /*bin_dump("now",dst_begin,dst-dst_begin); */
   }
+}
+
+/* ----------------------------------------------------------------------------
+ * convert utf-16 into utf-8
+ * ------------------------------------------------------------------------- */
+EXTERN_C
+SV*
+xs_utf16_utf8(SV* sv_str)
+{
+  UJ_UINT8* src;
+  int len;
+  SV_Buf result;
+
+  if( sv_str==&PL_sv_undef )
+  {
+    return newSVpvn("",0);
+  }
+
+  src = (UJ_UINT8*)SvPV(sv_str,PL_na);
+  len = sv_len(sv_str);
+  /*fprintf(stderr,"Unicode::Japanese::(xs)utf16_utf8\n",len);*/
+  /*bin_dump("in ",src,len);*/
+  SV_Buf_init(&result,len*3/2+4);
+
+  if( len&1 )
+  {
+    Perl_croak(aTHX_ "Unicode::Japanese::utf16_utf8, invalid length (not 2*n)");
+  }
+
+  utf16_utf8_conv(&result, src, src+len, 0);
 
   /*bin_dump("out",result.getBegin(),result.getLength()); */
   SV_Buf_setLength(&result);
@@ -315,6 +338,95 @@ xs_utf8_utf16(SV* sv_str)
   return SV_Buf_getSv(&result);
 }
 
+/* ----------------------------------------------------------------------------
+ * convert utf-16le into utf-8
+ * ------------------------------------------------------------------------- */
+EXTERN_C
+SV*
+xs_utf16le_utf8(SV* sv_str)
+{
+  UJ_UINT8* src;
+  int len;
+  SV_Buf result;
+
+  if( sv_str==&PL_sv_undef )
+  {
+    return newSVpvn("",0);
+  }
+
+  src = (UJ_UINT8*)SvPV(sv_str,PL_na);
+  len = sv_len(sv_str);
+  SV_Buf_init(&result,len*3/2+4);
+
+  if( len&1 )
+  {
+    Perl_croak(aTHX_ "Unicode::Japanese::utf16le_utf8, invalid length (not 2*n)");
+  }
+
+  utf16_utf8_conv(&result, src, src+len, 1);
+
+  SV_Buf_setLength(&result);
+
+  return SV_Buf_getSv(&result);
+}
+
+/* ----------------------------------------------------------------------------
+ * convert utf-8 into utf-16
+ * ------------------------------------------------------------------------- */
+EXTERN_C
+SV*
+xs_utf8_utf16(SV* sv_str)
+{
+  UJ_UINT8* src;
+  int len;
+  SV_Buf result;
+
+  if( sv_str==&PL_sv_undef )
+  {
+    return newSVpvn("",0);
+  }
+
+  src = (UJ_UINT8*)SvPV(sv_str,PL_na);
+  len = sv_len(sv_str);
+  /*fprintf(stderr,"Unicode::Japanese::(xs)utf8_utf16\n",len); */
+  /*bin_dump("in ",src,len); */
+  SV_Buf_init(&result,len*2);
+
+  utf8_utf16_conv(&result, src, src+len, 0);
+
+  /*bin_dump("out",result.getBegin(),result.getLength()); */
+  SV_Buf_setLength(&result);
+
+  return SV_Buf_getSv(&result);
+}
+
+/* ----------------------------------------------------------------------------
+ * convert utf-8 into utf-16le
+ * ------------------------------------------------------------------------- */
+EXTERN_C
+SV*
+xs_utf8_utf16le(SV* sv_str)
+{
+  UJ_UINT8* src;
+  int len;
+  SV_Buf result;
+
+  if( sv_str==&PL_sv_undef )
+  {
+    return newSVpvn("",0);
+  }
+
+  src = (UJ_UINT8*)SvPV(sv_str,PL_na);
+  len = sv_len(sv_str);
+  SV_Buf_init(&result,len*2);
+
+  utf8_utf16_conv(&result, src, src+len, 1);
+
+  SV_Buf_setLength(&result);
+
+  return SV_Buf_getSv(&result);
+}
+
 /* ----------------------------------------------------------------------------
  * End Of File.
  * ------------------------------------------------------------------------- */
@@ -1,129 +1,143 @@
 /* ----------------------------------------------------------------------------
- * utf16_utf8.c
+ * utf8.c
  * ----------------------------------------------------------------------------
  * $Id$
  * ------------------------------------------------------------------------- */
 
 #include "Japanese.h"
+#include "simd.h"
+
+/* ----------------------------------------------------------------------------
+ * forms replaced with '?', indexed by (lead byte - 0xC0).
+ * len is the length of the form (0: lead byte never starts one), lo..hi
+ * is the range of the 2nd byte.  rest bytes are always 0x80..0xBF.
+ * ------------------------------------------------------------------------- */
+typedef struct utf8_form_s
+{
+  UJ_UINT8 len;
+  UJ_UINT8 lo;
+  UJ_UINT8 hi;
+} utf8_form_t;
+
+static const utf8_form_t utf8_forms[0x40] = {
+  /* 0xC0-0xC1: 2 bytes char which is restricted 1 byte. */
+  {2,0x80,0xBF}, {2,0x80,0xBF}, {0,0,0}, {0,0,0},
+  {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0},
+  {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0},
+  /* 0xD0-0xDF */
+  {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0},
+  {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0},
+  /* 0xE0: 3 bytes char which is restricted <= 2 bytes. */
+  {3,0x80,0x9F}, {0,0,0}, {0,0,0}, {0,0,0},
+  {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0},
+  {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0},
+  /* 0xF0: 4 bytes char which is restricted <= 3 bytes. */
+  {4,0x80,0x8F}, {0,0,0}, {0,0,0}, {0,0,0},
+  /* 0xF4-0xF7: > U+10FFFF (4byte) */
+  {4,0x90,0xBF}, {4,0x80,0xBF}, {4,0x80,0xBF}, {4,0x80,0xBF},
+  /* 0xF8-0xFB: > U+10FFFF (5byte) */
+  {5,0x80,0xBF}, {5,0x80,0xBF}, {5,0x80,0xBF}, {5,0x80,0xBF},
+  /* 0xFC-0xFD: > U+10FFFF (6byte) */
+  {6,0x80,0xBF}, {6,0x80,0xBF}, {0,0,0}, {0,0,0},
+};
+
+/* ----------------------------------------------------------------------------
+ * find the first form to be replaced in src..src_end.
+ * returns NULL when there is none, or the head of it and its length
+ * in *p_len.
+ * ------------------------------------------------------------------------- */
+static const UJ_UINT8*
+utf8_find_invalid(const UJ_UINT8* src, const UJ_UINT8* src_end, int simd, int* p_len)
+{
+  while( src<src_end )
+  {
+    const UJ_UINT8* stop;
+    if( simd )
+    {
+      src += uj_simd_utf8_clean(simd, src, src_end-src);
+      if( src>=src_end )
+      {
+        break;
+      }
+    }
+    /* walk through one block with scalar code. */
+    stop = src_end-src>16 ? src+16 : src_end;
+    for( ; src<stop; ++src )
+    {
+      const utf8_form_t* form;
+      int i;
+      if( *src<0xC0 )
+      {
+        continue;
+      }
+      form = &utf8_forms[*src-0xC0];
+      if( form->len==0 || src_end-src<form->len )
+      {
+        continue;
+      }
+      if( src[1]<form->lo || src[1]>form->hi )
+      {
+        continue;
+      }
+      for( i=2; i<form->len; ++i )
+      {
+        if( src[i]<0x80 || src[i]>0xBF )
+        {
+          break;
+        }
+      }
+      if( i==form->len )
+      {
+        *p_len = form->len;
+        return src;
+      }
+    }
+  }
+  return NULL;
+}
 
 /* ----------------------------------------------------------------------------
  * replace invalid UTF-8 chars with '?'
+ * returns sv_str itself when there is nothing to replace.
  * ------------------------------------------------------------------------- */
 EXTERN_C
 SV*
 xs_validate_utf8(SV* sv_str) {
-	  unsigned char* src;
-	  int len;
-	  SV_Buf result;
-	  const unsigned char* src_end;
-
-	  if (sv_str == &PL_sv_undef) {
-		  return newSVpvn("", 0);
-	  }
-  
-	  src = (unsigned char*)SvPV(sv_str, PL_na);
-	  len = sv_len(sv_str);
-	  src_end = src + len;
-	  SV_Buf_init(&result, len);
-
-	  while (src < src_end) {
-		  if (*src >= 0xC0 && *src < 0xC1) {
-			  /* 2 bytes char which is restricted 1 byte. */
-			  if (src + 1 <= src_end) {
-				  if (src[1] >= 0x80 && src[1] <= 0xBF) {
-					  SV_Buf_append_ch(&result, '?');
-					  src += 2;
-					  continue;
-				  }
-			  }
-		  }
-		  else if (*src == 0xE0) {
-			  /* 3 bytes char which is restricted <= 2 bytes. */
-			  if (src + 2 <= src_end) {
-				  if (src[1] >= 0x80 && src[1] <= 0x9F &&
-					  src[2] >= 0x80 && src[2] <= 0xBF) {
-
-					  SV_Buf_append_ch(&result, '?');
-					  src += 3;
-					  continue;
-				  }
-			  }
-		  }
-		  else if (*src == 0xF0) {
-			  /* 4 bytes char which is restricted <= 3 bytes. */
-			  if (src + 3 <= src_end) {
-				  if (src[1] >= 0x80 && src[1] <= 0x8F &&
-					  src[2] >= 0x80 && src[2] <= 0xBF &&
-					  src[3] >= 0x80 && src[3] <= 0xBF) {
-
-					  SV_Buf_append_ch(&result, '?');
-					  src += 4;
-					  continue;
-				  }
-			  }
-		  }
-		  else if (*src == 0xF4) {
-			  /* > U+10FFFF (4byte) */
-			  if (src + 3 <= src_end) {
-				  if (src[1] >= 0x90 && src[1] <= 0xBF &&
-					  src[2] >= 0x80 && src[2] <= 0xBF &&
-					  src[3] >= 0x80 && src[3] <= 0xBF) {
-
-					  SV_Buf_append_ch(&result, '?');
-					  src += 4;
-					  continue;
-				  }
-			  }
-		  }
-		  else if (*src >= 0xF5 && *src <= 0xF7) {
-			  /* ditto */
-			  if (src + 3 <= src_end) {
-				  if (src[1] >= 0x80 && src[1] <= 0xBF &&
-					  src[2] >= 0x80 && src[2] <= 0xBF &&
-					  src[3] >= 0x80 && src[3] <= 0xBF) {
+  const UJ_UINT8* src;
+  const UJ_UINT8* src_end;
+  const UJ_UINT8* bad;
+  STRLEN len;
+  int bad_len;
+  int simd;
+  SV_Buf result;
 
-					  SV_Buf_append_ch(&result, '?');
-					  src += 4;
-					  continue;
-				  }
-			  }
-		  }
-		  else if (*src >= 0xF8 && *src <= 0xFB) {
-			  /* > U+10FFFF (5byte) */
-			  if (src + 4 <= src_end) {
-				  if (src[1] >= 0x80 && src[1] <= 0xBF &&
-					  src[2] >= 0x80 && src[2] <= 0xBF &&
-					  src[3] >= 0x80 && src[3] <= 0xBF &&
-					  src[4] >= 0x80 && src[4] <= 0xBF) {
+  if( sv_str == &PL_sv_undef )
+  {
+    return newSVpvn("", 0);
+  }
 
-					  SV_Buf_append_ch(&result, '?');
-					  src += 5;
-					  continue;
-				  }
-			  }
-		  }
-		  else if (*src >= 0xFC && *src <= 0xFD) {
-			  /* > U+10FFFF (6byte) */
-			  if (src + 5 <= src_end) {
-				  if (src[1] >= 0x80 && src[1] <= 0xBF &&
-					  src[2] >= 0x80 && src[2] <= 0xBF &&
-					  src[3] >= 0x80 && src[3] <= 0xBF &&
-					  src[4] >= 0x80 && src[4] <= 0xBF &&
-					  src[5] >= 0x80 && src[5] <= 0xBF) {
+  src = (const UJ_UINT8*)SvPV(sv_str, len);
+  src_end = src + len;
+  simd = uj_simd_level();
 
-					  SV_Buf_append_ch(&result, '?');
-					  src += 6;
-					  continue;
-				  }
-			  }
-		  }
+  bad = utf8_find_invalid(src, src_end, simd, &bad_len);
+  if( bad==NULL )
+  {
+    return SvREFCNT_inc(sv_str);
+  }
 
-		  SV_Buf_append_ch(&result, *src);
-		  src++;
-	  }
+  SV_Buf_init(&result, len);
+  do
+  {
+    SV_Buf_append_mem(&result, src, bad-src);
+    SV_Buf_append_ch(&result, '?');
+    src = bad + bad_len;
+    bad = utf8_find_invalid(src, src_end, simd, &bad_len);
+  }while( bad!=NULL );
+  SV_Buf_append_mem(&result, src, src_end-src);
 
-	  SV_Buf_setLength(&result);
-	  return SV_Buf_getSv(&result);
+  SV_Buf_setLength(&result);
+  return SV_Buf_getSv(&result);
 }
 
 /* ----------------------------------------------------------------------------
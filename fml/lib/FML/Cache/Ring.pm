@@ -343,7 +343,7 @@ sub get_latest_value
     opendir($dh, $dir);
 
     my @dh = ();
-    for my $entry (readdir($dh)) { push(@dh, $entry) if $entry =~ /^\d+/o;}
+    for my $entry (readdir($dh)) { push(@dh, $entry) if $entry =~ /^\d+$/o;}
     @dh = sort { $b <=> $a } @dh;
 
   DIR_ENTRY:
@@ -366,44 +366,34 @@ sub get_latest_value
 
 
 # Descriptions: search value for $key in the $file.
+#               The last value is returned.
+#               Tie::JournaledFile looks up the offset index of $file.
 #    Arguments: OBJ($self) STR($file) STR($key)
-# Side Effects: none
+# Side Effects: create or update the index of $file if needed.
 # Return Value: STR
 sub _search
 {
     my ($self, $file, $key) = @_;
     my $hash = $self->{ _cache_data };
-    my $pkey = quotemeta( substr($key, 0, 1) );
-    my $buf  = '';
 
     # simple check
     return '' unless defined $file;
     return '' unless $file;
+    return '' unless -f $file;
 
     # XXX-TODO: negative cache is needed ?
     # XXX-TODO: when negative cache is expired ? this code is correct ?
     return '' if defined $hash->{ $file };
     $hash->{ $file } = 1;
 
-    my $fh = $self->open($file, "r");
-
-    if (defined $fh) {
-	my $x;
+    use Tie::JournaledFile;
+    my $db = new Tie::JournaledFile {
+	match_condition => 'last',
+	file            => $file,
+    };
+    my $buf = $db->FETCH($key);
 
-      ENTRY:
-	while ($x = $fh->getline) {
-	    next ENTRY unless $x =~ /^$pkey/;
-
-	    if ($x =~ /^$key\s+/ || $x =~ /^$key$/) {
-		chomp $x;
-		my ($k, $v) = split(/\s+/, $x, 2);
-		$buf = $v;
-	    }
-	}
-	$self->close;
-    }
-
-    return $buf;
+    return( defined $buf ? $buf : '' );
 }
 
 
@@ -39,6 +39,8 @@ html format one.
 =head2 convert($optargs)
 
 convert articles from text to html style.
+Articles are converted by C<$html_archive_rebuild_workers> processes
+in parallel if it is greater than 0.
 
 =cut
 
@@ -67,6 +69,13 @@ sub convert
     my $htmlifier_args = $curproc->article_thread_init();
     $htmlifier_args->{ output_dir } = $dst_dir;
 
+    # rebuild mode: convert articles by several processes in parallel.
+    my $config  = $curproc->config();
+    my $workers = $config->{ html_archive_rebuild_workers } || 0;
+    if ($workers =~ /^\d+$/o && $workers > 0) {
+	$htmlifier_args->{ rebuild_workers } = $workers;
+    }
+
     my ($is_subdir_exists, $subdirs) = _check_subdir_exists($src_dir);
     if ($is_subdir_exists) { $curproc->logdebug("looks subdir exists");}
 
@@ -22,6 +22,14 @@ use vars qw($need_expansion_variables
 
 my $debug = 0;
 
+# compiled configuration files on memory, and the directory to save them.
+# See COMPILED CONFIGURATION FILES section below.
+my $compiled_cache     = {};
+my $compiled_cache_dir = '';
+
+# hooks already evaluated in FML::Config::Hook name space.
+my $evaluated_hooks = '';
+
 # XXX context switching must be needed for listserv style emulator,
 # XXX not fml4 emulation nor fml8 itself.
 # XXX we set $current_context as $ml_name@$ml_domain for lisetserv.
@@ -86,6 +94,22 @@ C<get(key)> returns the value for a key in C<%fml_config_result>,
 which is value expanded from C<%fml_config>.
 The expansion is done when C<get()> is called not when C<set()> is
 called.
+Only the value for the key and the variables referred from it are
+expanded, and the result is kept until C<set()> is called again.
+
+=head2 COMPILED CONFIGURATION FILES
+
+C<load_file()> compiles a configuration file to the list of the
+assignments and the hooks in it at the first time, and replays the
+list to C<%fml_config> after that.
+
+The compiled file is cached on memory, and also saved in the directory
+specified by C<set_compiled_cache_dir()> to share it among processes.
+It is identified by the device, inode, size and mtime of the file, so
+it is discarded when the file is modified.
+
+The expanded values are not cached since they depend on the variables
+in each process e.g. C<$ml_name>.
 
 =head1 METHODS
 
@@ -233,6 +257,9 @@ alias of C<load_file( filename )>.
 read the configuration file, split keys and the values in it and set
 them to %$_fml_config.
 
+The file is compiled to the list of assignments at the first time.
+The compiled one is reused while the file is not modified.
+
 =cut
 
 
@@ -257,10 +284,10 @@ sub load_file
 
     if (-f $file) {
 	# read configuration file
-	$self->_read_file({
-	    file   => $file,
-	    config => $_fml_config,
-	});
+	my $compiled = $self->_compiled_file_get($file);
+	if (defined $compiled) {
+	    $self->_compiled_file_apply($compiled, $_fml_config);
+	}
 
 	# At the first time, save $_fml_config to another hash, which is used
 	# as a default value at variable comparison.
@@ -283,19 +310,21 @@ sub load_file
 #    Arguments: OBJ($self) HASH_REF($cfargs)
 #                     $file = configuration file
 #                   $config = area to store {key => value } hash
+#                 $compiled = area to store assignments and hooks
 # Side Effects: $config changes
-# Return Value: none
+# Return Value: NUM(1 or 0)
 sub _read_file
 {
     my ($self, $cfargs) = @_;
-    my $file    = $cfargs->{ 'file' }    || '';
-    my $config  = $cfargs->{ 'config' }  || {};
-    my $comment = $cfargs->{ 'comment' } || {};
-    my $order   = $cfargs->{ 'order' }   || [];
-    my $mode    = $cfargs->{ 'mode' }    || 'default';
+    my $file     = $cfargs->{ 'file' }     || '';
+    my $config   = $cfargs->{ 'config' }   || {};
+    my $comment  = $cfargs->{ 'comment' }  || {};
+    my $order    = $cfargs->{ 'order' }    || [];
+    my $mode     = $cfargs->{ 'mode' }     || 'default';
+    my $compiled = $cfargs->{ 'compiled' } || undef;
 
     # sanity
-    return unless $file;
+    return 0 unless $file;
 
     # open the $file by using FileHandle.pm
     use FileHandle;
@@ -359,6 +388,10 @@ sub _read_file
 
 		# rewrite/update $config
 		__update_config($config, $key, $op, $value, $name_space);
+		if (defined $compiled) {
+		    push(@{ $compiled->{ ops } },
+			 [ $name_space, $key, $op, $value ]);
+		}
 
 		# save variable order for re-construction e.g. used in write()
 		if ($mode eq 'raw') {
@@ -379,16 +412,28 @@ sub _read_file
 	    elsif ($buf =~ /^\s+(.*)/o && defined($curkey)) {
 		my $value = $1;
 		__append_config($config, $curkey, $value, $name_space);
+		if (defined $compiled) {
+		    push(@{ $compiled->{ ops } },
+			 [ $name_space, $curkey, 'append', $value ]);
+		}
 	    }
 	}
 	$fh->close;
 
 	# save hook configuration in FML::Config name space (global).
 	# XXX Each hook continues to grow when new codes are given.
-	$_fml_user_hooks .= $hook if defined $hook;
+	if (defined $compiled) {
+	    $compiled->{ hook } = $hook if defined $hook;
+	}
+	else {
+	    $_fml_user_hooks .= $hook if defined $hook;
+	}
+
+	return 1;
     }
     else {
 	$self->error_set("Error: cannot open $file");
+	return 0;
     }
 }
 
@@ -503,6 +548,166 @@ sub _evaluate
 }
 
 
+=head2 set_compiled_cache_dir($dir)
+
+save compiled configuration files in C<$dir>.
+They are cached only on memory if C<$dir> is not specified.
+
+=cut
+
+
+# Descriptions: set the directory to save compiled configuration files.
+#    Arguments: OBJ($self) STR($dir)
+# Side Effects: update $compiled_cache_dir
+# Return Value: none
+sub set_compiled_cache_dir
+{
+    my ($self, $dir) = @_;
+
+    $compiled_cache_dir = defined $dir ? $dir : '';
+}
+
+
+# Descriptions: return the compiled $file. compile it if not yet.
+#    Arguments: OBJ($self) STR($file)
+# Side Effects: update $compiled_cache and create the cache file.
+# Return Value: HASH_REF or UNDEF
+sub _compiled_file_get
+{
+    my ($self, $file) = @_;
+    my (@stat) = stat($file);
+
+    return undef unless @stat;
+
+    # dev ino size mtime
+    my $signature = join(" ", @stat[0, 1, 7, 9]);
+    my $compiled  = $compiled_cache->{ $file };
+    if (defined $compiled && $compiled->{ signature } eq $signature) {
+	return $compiled;
+    }
+
+    # XXX the file modified in this second may be modified again
+    # XXX without the change of the signature. Do not cache it.
+    my $cacheable = (time - $stat[9] > 1) ? 1 : 0;
+
+    $compiled = undef;
+    if ($cacheable) {
+	$compiled = $self->_compiled_file_read($file, $signature);
+    }
+    unless (defined $compiled) {
+	$compiled = {
+	    file      => $file,
+	    signature => $signature,
+	    ops       => [],
+	    hook      => '',
+	};
+	$self->_read_file({
+	    file     => $file,
+	    config   => {},
+	    compiled => $compiled,
+	}) || return undef;
+	$self->_compiled_file_write($file, $compiled) if $cacheable;
+    }
+
+    $compiled_cache->{ $file } = $compiled if $cacheable;
+    return $compiled;
+}
+
+
+# Descriptions: replay the assignments and hooks in $compiled.
+#    Arguments: OBJ($self) HASH_REF($compiled) HASH_REF($config)
+# Side Effects: update $config and $_fml_user_hooks.
+# Return Value: none
+sub _compiled_file_apply
+{
+    my ($self, $compiled, $config) = @_;
+
+    for my $op (@{ $compiled->{ ops } }) {
+	my ($name_space, $key, $mode, $value) = @$op;
+
+	if ($mode eq 'append') {
+	    __append_config($config, $key, $value, $name_space);
+	}
+	else {
+	    __update_config($config, $key, $mode, $value, $name_space);
+	}
+    }
+
+    $_fml_user_hooks .= $compiled->{ hook } if $compiled->{ hook };
+}
+
+
+# Descriptions: return the cache file path for $file.
+#    Arguments: OBJ($self) STR($file)
+# Side Effects: none
+# Return Value: STR
+sub _compiled_file_path
+{
+    my ($self, $file) = @_;
+
+    return '' unless $compiled_cache_dir;
+
+    use Digest::MD5 qw(md5_hex);
+    use File::Spec;
+    return File::Spec->catfile($compiled_cache_dir, md5_hex($file));
+}
+
+
+# Descriptions: read the compiled $file from the cache file.
+#    Arguments: OBJ($self) STR($file) STR($signature)
+# Side Effects: none
+# Return Value: HASH_REF or UNDEF
+sub _compiled_file_read
+{
+    my ($self, $file, $signature) = @_;
+    my $cache_file = $self->_compiled_file_path($file);
+
+    return undef unless $cache_file;
+    return undef unless -f $cache_file;
+
+    use Storable qw(retrieve);
+    my $compiled = eval { retrieve($cache_file);};
+    if (defined $compiled && ref($compiled) eq 'HASH' &&
+	defined $compiled->{ file } && $compiled->{ file } eq $file &&
+	defined $compiled->{ signature } &&
+	$compiled->{ signature } eq $signature) {
+	return $compiled;
+    }
+
+    return undef;
+}
+
+
+# Descriptions: save the compiled $file into the cache file.
+#               The failure is ignored since the cache is not mandatory.
+#    Arguments: OBJ($self) STR($file) HASH_REF($compiled)
+# Side Effects: create the cache file.
+# Return Value: none
+sub _compiled_file_write
+{
+    my ($self, $file, $compiled) = @_;
+    my $cache_file = $self->_compiled_file_path($file);
+
+    return unless $cache_file;
+
+    use File::Path;
+    use Storable qw(nstore);
+    my $tmp_file = sprintf("%s.%d", $cache_file, $$);
+    my $umask    = umask(077);
+    eval {
+	mkpath([ $compiled_cache_dir ], 0, 0700) unless -d $compiled_cache_dir;
+	nstore($compiled, $tmp_file);
+	rename($tmp_file, $cache_file) || croak("cannot rename $tmp_file");
+    };
+    umask($umask);
+
+    if ($@) {
+	unlink($tmp_file) if -f $tmp_file;
+	carp($@) if $debug;
+    }
+}
+
+
 =head2 read(file)
 
 read configuration from the specified file.
@@ -827,22 +1032,137 @@ sub __expand_special_macros
     return unless defined $x;
     return unless defined $config->{ $x };
 
-    if ($config->{ $x } =~ /READ_ONLY\((.*)\)/) {
+    $config->{ $x } = __expand_special_macros_in_value($config->{ $x },
+						       $config);
+}
+
+
+# Descriptions: expand READ_ONLY(a b c) and ${var:-default} in $value.
+#               $lookup is HASH_REF or CODE_REF to return the value
+#               of the variable.
+#    Arguments: STR($value) HASH_REF_or_CODE_REF($lookup)
+# Side Effects: none
+# Return Value: STR
+sub __expand_special_macros_in_value
+{
+    my ($value, $lookup) = @_;
+
+    # XXX the value may include the expanded READ_ONLY(x) READ_ONLY(y).
+    if ($value =~ /READ_ONLY\(([^()]*\s[^()]*)\)/) {
 	my (@x) = split(/\s+/, $1);
 	my $v   = '';
 	for my $key (@x) { $v .= " READ_ONLY($key)";}
 
-	$config->{ $x } =~ s/READ_ONLY\((.*)\)/$v/;
+	$value =~ s/READ_ONLY\(([^()]*\s[^()]*)\)/$v/;
     }
 
-    if ($config->{ $x } =~ /\$\{([a-z0-9_]+):-([a-z0-9_]+)\}/) {
-	my ($var, $default) = ($1, $2);
+    if ($value =~ /\$\{([a-z0-9_]+):-([a-z0-9_]+)\}/) {
+	my $get = ref($lookup) eq 'CODE' ? $lookup : sub { $lookup->{$_[0]} };
+	my $x;
+
+	$value =~
+	    s/\$\{([a-z0-9_]+):-([a-z0-9_]+)\}/(defined($x = $get->($1)) ?
+						$x :
+						$2)/ge;
+    }
+
+    return $value;
+}
+
+
+# Descriptions: expand the value for $key on demand.
+#               It is same as _expand_variables() but expands only
+#               $key and variables referred from it.
+#    Arguments: STR($key) HASH_REF($visiting)
+# Side Effects: save the result in $_fml_config_result
+# Return Value: STR or HASH_REF or UNDEF
+sub _expand_value
+{
+    my ($key, $visiting) = @_;
+
+    return $_fml_config_result->{ $key } if
+	exists $_fml_config_result->{ $key };
+    return undef unless defined $_fml_config->{ $key };
+
+    my $value = $_fml_config->{ $key };
+
+    # HASH_REF such as [mysql:fml] => { ... }
+    if (ref($value) eq 'HASH') {
+	$value = _expand_name_space($key, $value, $visiting);
+    }
+    elsif ($value =~ /\$/o) {
+	# check whether the variable definition is recursive.
+	if ($value =~ /\$\Q$key\E/ || $visiting->{ $key }) {
+	    croak("loop1: definition of $key is recursive\n");
+	}
+	$visiting->{ $key } = 1;
+
+	my $lookup = sub { _expand_value($_[0], $visiting);};
+	my $x;
+	my $org = '';
+	my $max = 0;
+      EXPANSION_LOOP:
+	while ($max++ < 16) {
+	    $org = $value;
+
+	    # expand $prefix and ${prefix} -> something
+	    $value =~ s/\$([a-z_]+[a-z0-9])/(defined($x = $lookup->($1)) ?
+					     $x : '')/ge;
+	    $value =~ s/\$\{([a-z_]+[a-z0-9])\}/(defined($x = $lookup->($1)) ?
+						 $x : '')/ge;
+
+	    $value = __expand_special_macros_in_value($value, $lookup);
 
-	$config->{$x} =~
-	    s/\$\{([a-z0-9_]+):-([a-z0-9_]+)\}/(defined $config->{$1} ?
-						$config->{$1} :
-						$default)/ge;
+	    last EXPANSION_LOOP if $value !~ /\$/o;
+	    last EXPANSION_LOOP if $org eq $value;
+
+	    if ($value =~ /\$\Q$key\E/) {
+		croak("loop2: definition of $key is recursive\n");
+	    }
+	}
+
+	if ($max >= 16) {
+	    croak("variable expansion of $key causes infinite loop\n");
+	}
+
+	delete $visiting->{ $key };
+    }
+
+    $_fml_config_result->{ $key } = $value;
+    return $value;
+}
+
+
+# Descriptions: expand variables in the next level name space
+#               e.g. [mysql:xxx] as _expand_nextlevel() does.
+#    Arguments: STR($name_space) HASH_REF($hash) HASH_REF($visiting)
+# Side Effects: none
+# Return Value: HASH_REF
+sub _expand_name_space
+{
+    my ($name_space, $hash, $visiting) = @_;
+    my $copy  = {};
+    my $hints = {};
+    my ($k, $v);
+
+    while (($k, $v) = each %$hash) { $copy->{ $k } = $v;}
+    return $copy unless $name_space =~ /^\[/o;
+
+    # variables in the upper level are given as hints.
+    for $v (values %$copy) {
+	next unless defined $v;
+
+	while ($v =~ /\$\{?([a-z_]+[a-z0-9])/g) {
+	    next if exists $hints->{ $1 };
+	    next if exists $copy->{ $1 };
+	    my $name = $1;
+	    my $x    = _expand_value($name, $visiting);
+	    $hints->{ $name } = $x if defined $x;
+	}
     }
+
+    _expand_variables( $copy, $hints );
+    return $copy;
 }
 
 
@@ -908,8 +1228,8 @@ sub yes
 {
     my ($self, $key) = @_;
 
-    if (defined $_fml_config_result->{$key}) {
-	my $val = $_fml_config_result->{$key};
+    if (defined $self->{ $key }) {
+	my $val = $self->{ $key };
 	$val =~ s/^\s*//o;
 	$val =~ s/\s*$//o;
 
@@ -933,8 +1253,8 @@ sub no
 {
     my ($self, $key) = @_;
 
-    if (defined $_fml_config_result->{$key}) {
-	my $val = $_fml_config_result->{$key};
+    if (defined $self->{ $key }) {
+	my $val = $self->{ $key };
 	$val =~ s/^\s*//o;
 	$val =~ s/\s*$//o;
 
@@ -958,8 +1278,8 @@ sub has_attribute
     # sanity
     return 0 unless defined $attribute;
 
-    if (defined $_fml_config_result->{$key}) {
-	my (@attribute) = split(/\s+/, $_fml_config_result->{$key});
+    if (defined $self->{ $key }) {
+	my (@attribute) = split(/\s+/, $self->{ $key });
 
       ATTR:
 	for my $k (@attribute) {
@@ -1140,16 +1460,7 @@ sub is_hook_defined
 {
     my ($self, $hook_name) = @_;
 
-    return 0 unless defined $_fml_user_hooks;
-    return 0 unless $_fml_user_hooks;
-
-    eval qq{
-	package FML::Config::Hook;
-	no strict;
-	$FML::Config::_fml_user_hooks;
-	package FML::Config;
-    };
-    carp($@) if $@;
+    return 0 unless _hook_evaluate();
 
     my $is_defined = 0;
     my $hook = sprintf("%s::%s::%s::%s", 'FML', 'Config', 'Hook', $hook_name);
@@ -1174,17 +1485,7 @@ sub get_hook
 {
     my ($self, $hook_name) = @_;
 
-    return undef unless defined $_fml_user_hooks;
-    return undef unless $_fml_user_hooks;
-
-    my $eval = qq{
-	package FML::Config::Hook;
-	no strict;
-	$FML::Config::_fml_user_hooks;
-	package FML::Config;
-    };
-    eval $eval;
-    carp($@) if $@;
+    return undef unless _hook_evaluate();
 
     my $r    = ''; # return value;
     my $namel = $hook_name; $namel =~ tr/A-Z/a-z/; # lowercase
@@ -1212,6 +1513,31 @@ sub get_hook
 }
 
 
+# Descriptions: evaluate hooks in FML::Config::Hook name space.
+#               evaluate them again only when new hooks are loaded.
+#    Arguments: none
+# Side Effects: update FML::Config::Hook name space.
+# Return Value: NUM(1 or 0)
+sub _hook_evaluate
+{
+    return 0 unless defined $_fml_user_hooks;
+    return 0 unless $_fml_user_hooks;
+    return 1 if $evaluated_hooks eq $_fml_user_hooks;
+
+    my $eval = qq{
+	package FML::Config::Hook;
+	no strict;
+	$FML::Config::_fml_user_hooks;
+	package FML::Config;
+    };
+    eval $eval;
+    carp($@) if $@;
+
+    $evaluated_hooks = $_fml_user_hooks;
+    return 1;
+}
+
+
 =head1 CONTEXT SWITCHING
 
 =head2 set_context($context)
@@ -1296,13 +1622,14 @@ sub FETCH
 
     # XXX-TODO: how to handle the next level ?
 
+    # forget the results expanded before.
     if ($need_expansion_variables) {
-	$self->expand_variables();
+	%$_fml_config_result      = ();
 	$need_expansion_variables = 0;
     }
 
-    if (defined($_fml_config_result->{$key})) {
-	my $x = $_fml_config_result->{$key};
+    my $x = _expand_value($key, {});
+    if (defined $x) {
 
 	# HASH_REF such as [mysql:fml] => { ... }
 	if (ref($x)) {
@@ -1332,10 +1659,8 @@ sub STORE
     # XXX-TODO: how to handle the next level ?
 
     # inform fml we need to expand variable again when FETCH() is
-    # called.
-    if (defined $value && $value =~ /\$/) {
-	$need_expansion_variables = 1;
-    }
+    # called. Other variables may refer this $key.
+    $need_expansion_variables = 1;
 
     if (defined $key && defined $value) {
 	$_fml_config->{$key} = $value;
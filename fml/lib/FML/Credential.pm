@@ -549,8 +549,16 @@ sub has_address_in_map
 
     # $curproc->lock($lock_channel);   # READER LOCK
     my $_user = quotemeta($user);
-    my $addrs = $obj->find($_user ,
-			   { want => 'key', all => 1, hints => [ $address ] });
+    my $query = { want => 'key', all => 1, hints => [ $address ] };
+
+    # is_same_address() needs the same user part, so the map can look
+    # up it by the index. Without the compare function, any address
+    # including $user matches as before.
+    $self->_reconfigure();
+    if ($self->{ _use_address_compare_function }) {
+	$query->{ user } = $user;
+    }
+    my $addrs = $obj->find($_user, $query);
     # $curproc->unlock($lock_channel); # READER LOCK
 
     if (ref($addrs) && $debug) {
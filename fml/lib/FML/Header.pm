@@ -120,6 +120,119 @@ sub set
 }
 
 
+=head2 extract($array_ref)
+
+same as C<Mail::Header::extract()> but faster.
+It builds the field table in one pass over the header lines.
+Each field is kept as it is since the header is not modified.
+If C<Modify> or C<MailFrom> other than C<KEEP> is specified,
+C<Mail::Header::extract()> is used.
+
+=head2 dup()
+
+same as C<Mail::Header::dup()> but faster.
+
+=cut
+
+
+# the normalized field names e.g. "Message-ID" for "message-id:".
+my %tag_case     = ();
+my $tag_case_max = 1024;
+
+
+# Descriptions: build the field table from the header lines.
+#               remove the header lines and the following blank line
+#               from @$array.
+#    Arguments: OBJ($self) ARRAY_REF($array)
+# Side Effects: update $self
+# Return Value: OBJ
+sub extract
+{
+    my ($self, $array) = @_;
+
+    if ($self->{ mail_hdr_modify } ||
+	$self->{ mail_hdr_mail_from } ne 'KEEP') {
+	return $self->SUPER::extract($array);
+    }
+
+    $self->empty;
+
+    my $list = $self->{ mail_hdr_list };
+    my $hash = $self->{ mail_hdr_hash };
+    my $name = $Mail::Header::FIELD_NAME;
+    my $max  = scalar(@$array);
+    my $i    = 0;
+    my ($line, $tag);
+
+  FIELD:
+    while ($i < $max) {
+	last FIELD unless $array->[ $i ] =~ /\A($name|From )/o;
+	$tag  = $1;
+	$line = $array->[ $i++ ];
+
+	# unfold continuation lines.
+	while ($i < $max && $array->[ $i ] =~ /\A[ \t]/o) {
+	    $line .= $array->[ $i++ ];
+	}
+
+	# end with one "\n".
+	unless (substr($line, -1) eq "\n" && substr($line, -2, 1) ne "\n") {
+	    $line =~ s/\n*\Z/\n/so;
+	}
+
+	push(@$list, $line);
+	push(@{ $hash->{ _tag_case($tag) } }, \$list->[ $#$list ]);
+    }
+
+    splice(@$array, 0, $i);
+    shift @$array if @$array && $array->[ 0 ] =~ /\A\s*\Z/o;
+
+    return $self;
+}
+
+
+# Descriptions: duplicate the header object.
+#    Arguments: OBJ($self)
+# Side Effects: none
+# Return Value: OBJ
+sub dup
+{
+    my ($self) = @_;
+    my $type   = ref($self) || croak("Cannot dup without an object");
+    my $dup    = new $type;
+    my $name   = $Mail::Header::FIELD_NAME;
+
+    %$dup = %$self;
+    $dup->empty;
+
+    my $list = $dup->{ mail_hdr_list } = [ @{ $self->{ mail_hdr_list } } ];
+    my $hash = $dup->{ mail_hdr_hash };
+    for my $ln (@$list) {
+	my ($tag) = $ln =~ /\A($name|From )/oi;
+	push(@{ $hash->{ _tag_case($tag) } }, \$ln);
+    }
+
+    return $dup;
+}
+
+
+# Descriptions: Mail::Header::_tag_case() with cache.
+#    Arguments: STR($tag)
+# Side Effects: update %tag_case
+# Return Value: STR
+sub _tag_case
+{
+    my ($tag) = @_;
+
+    unless (defined $tag_case{ $tag }) {
+	%tag_case = () if scalar(keys %tag_case) > $tag_case_max;
+	$tag_case{ $tag } = Mail::Header::_tag_case($tag);
+    }
+
+    return $tag_case{ $tag };
+}
+
+
 =head2 address_cleanup(address)
 
 clean up given C<address>. This method parses the given address by
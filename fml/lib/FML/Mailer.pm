@@ -203,6 +203,8 @@ sub send
 	'smtp_sender'     => $sender,
 	'recipient_maps'  => $maps,
 	'recipient_limit' => $config->{smtp_recipient_limit},
+	'pipelining_window' => $config->{smtp_pipelining_window},
+	'max_concurrency' => $config->{smtp_max_concurrency},
 
 	'message'         => $message,
 	map_params        => $config,
@@ -701,6 +701,8 @@ sub _deliver_article
 			  'smtp_sender'     => $config->{'smtp_sender'},
 			  'recipient_maps'  => $recipient_maps,
 			  'recipient_limit' => $config->{smtp_recipient_limit},
+			  'pipelining_window' => $config->{smtp_pipelining_window},
+			  'max_concurrency' => $config->{smtp_max_concurrency},
 
 			  'message'         => $message,
 
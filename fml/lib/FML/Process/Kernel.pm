@@ -162,6 +162,10 @@ sub new
     # 3.3 bind FML::Config object to $curproc
     use FML::Config;
     $curproc->{ config } = new FML::Config $cfargs;
+    if (defined $args->{ main_cf }->{ config_cache_dir }) {
+	my $dir = $args->{ main_cf }->{ config_cache_dir };
+	$curproc->{ config }->set_compiled_cache_dir($dir);
+    }
 
     # 3.4 initialize PCB (Process Control Block)
     use FML::PCB;
@@ -0,0 +1,884 @@
+#-*- perl -*-
+#
+#  Copyright (C) 2012 Ken'ichi Fukamachi
+#   All rights reserved. This program is free software; you can
+#   redistribute it and/or modify it under the same terms as Perl itself.
+#
+# $FML$
+#
+
+package FML::Process::LMTPD;
+
+use strict;
+use Carp;
+use vars qw($debug @ISA @EXPORT @EXPORT_OK);
+
+use FML::Config;
+use FML::Process::Kernel;
+@ISA = qw(FML::Process::Kernel);
+
+
+# map between the address suffix of the recipient and the program.
+#    elena@fml.org       => distribute
+#    elena-ctl@fml.org   => command
+#    elena-error@fml.org => error
+my $lmtpd_suffix_program = {
+    ''      => 'distribute',
+    'ctl'   => 'command',
+    'error' => 'error',
+};
+
+# set by signal handlers to stop the daemon and workers.
+my $lmtpd_shutdown = 0;
+
+
+=head1 NAME
+
+FML::Process::LMTPD -- persistent LMTP front end for fml8 processes.
+
+=head1 SYNOPSIS
+
+    use FML::Process::LMTPD;
+    $curproc = new FML::Process::LMTPD;
+    $curproc->run();
+
+=head1 DESCRIPTION
+
+FML::Process::LMTPD provides the main function for C<libexec/fmllmtpd>.
+
+C<libexec/fmllmtpd> is a daemon which accepts messages over LMTP on a
+UNIX domain socket. It loads modules and conversion tables once, and
+forks C<$lmtpd_max_workers> workers which accept LMTP sessions.
+
+For each recipient of a message, the worker forks a child which runs
+the same flow as C<libexec/distribute> (or C<command>, C<error> for
+C<-ctl> and C<-error> addresses), so the child starts with modules
+already compiled. The ML's config.cf is read in the child. The
+exit status of the child is returned to the MTA as the LMTP reply for
+the recipient. EX_TEMPFAIL and death by a signal become a 4xx reply so
+that the MTA retries later, other errors become a 5xx reply.
+
+See C<FML::Process::Flow> for the flow detail.
+
+=head2 MTA CONFIGURATION
+
+For example, in the case of postfix,
+
+   [/etc/postfix/transport]
+   elena@fml.org	lmtp:unix:/var/spool/ml/@lmtpd@/socket
+   elena-ctl@fml.org	lmtp:unix:/var/spool/ml/@lmtpd@/socket
+
+The socket is created with C<$lmtpd_socket_mode> (0660 by default) and
+C<$lmtpd_socket_group>, so only fml and the MTA, which belongs to
+C<$lmtpd_socket_group>, can connect to it. C<$lmtpd_dir> is private
+except that C<$lmtpd_socket_group> can search it.
+
+=head1 METHODS
+
+=head2 new($args)
+
+constructor.
+It make a C<FML::Process::Kernel> object and return it.
+
+=head2 prepare($args)
+
+load default config files and set up the working directory.
+
+=cut
+
+
+# Descriptions: constructor.
+#    Arguments: OBJ($self) HASH_REF($args)
+# Side Effects: none
+# Return Value: OBJ
+sub new
+{
+    my ($self, $args) = @_;
+    my $type    = ref($self) || $self;
+    my $curproc = new FML::Process::Kernel $args;
+    return bless $curproc, $type;
+}
+
+
+# Descriptions: preparation.
+#    Arguments: OBJ($curproc) HASH_REF($args)
+# Side Effects: none
+# Return Value: none
+sub prepare
+{
+    my ($curproc, $args) = @_;
+    my $config = $curproc->config();
+
+    my $eval = $config->get_hook( 'lmtpd_prepare_start_hook' );
+    if ($eval) { eval qq{ $eval; }; $curproc->logwarn($@) if $@; }
+
+    $curproc->_lmtpd_init($args);
+
+    $eval = $config->get_hook( 'lmtpd_prepare_end_hook' );
+    if ($eval) { eval qq{ $eval; }; $curproc->logwarn($@) if $@; }
+}
+
+
+=head2 verify_request($args)
+
+dummy.
+
+=cut
+
+
+# Descriptions: dummy.
+#    Arguments: OBJ($curproc) HASH_REF($args)
+# Side Effects: none
+# Return Value: none
+sub verify_request
+{
+    my ($curproc, $args) = @_;
+    my $config = $curproc->config();
+
+    my $eval = $config->get_hook( 'lmtpd_verify_request_start_hook' );
+    if ($eval) { eval qq{ $eval; }; $curproc->logwarn($@) if $@; }
+
+    $eval = $config->get_hook( 'lmtpd_verify_request_end_hook' );
+    if ($eval) { eval qq{ $eval; }; $curproc->logwarn($@) if $@; }
+}
+
+
+=head2 run($args)
+
+the top level dispatcher for C<fmllmtpd>.
+It runs until SIGTERM or SIGINT.
+
+=cut
+
+
+# Descriptions: just a switch, call _lmtpd_main().
+#    Arguments: OBJ($curproc) HASH_REF($args)
+# Side Effects: none
+# Return Value: none
+sub run
+{
+    my ($curproc, $args) = @_;
+    my $config = $curproc->config();
+
+    my $eval = $config->get_hook( 'lmtpd_run_start_hook' );
+    if ($eval) { eval qq{ $eval; }; $curproc->logwarn($@) if $@; }
+
+    unless ($curproc->is_refused()) {
+	$curproc->_lmtpd_main();
+    }
+    else {
+	$curproc->log("request ignored.");
+    }
+
+    $eval = $config->get_hook( 'lmtpd_run_end_hook' );
+    if ($eval) { eval qq{ $eval; }; $curproc->logwarn($@) if $@; }
+}
+
+
+=head2 finish($args)
+
+dummy.
+
+=cut
+
+
+# Descriptions: dummy.
+#    Arguments: OBJ($curproc) HASH_REF($args)
+# Side Effects: none
+# Return Value: none
+sub finish
+{
+    my ($curproc, $args) = @_;
+    my $config = $curproc->config();
+
+    my $eval = $config->get_hook( 'lmtpd_finish_start_hook' );
+    if ($eval) { eval qq{ $eval; }; $curproc->logwarn($@) if $@; }
+
+    $eval = $config->get_hook( 'lmtpd_finish_end_hook' );
+    if ($eval) { eval qq{ $eval; }; $curproc->logwarn($@) if $@; }
+}
+
+
+=head2 help()
+
+show help.
+
+=cut
+
+
+# Descriptions: show help.
+#    Arguments: none
+# Side Effects: none
+# Return Value: none
+sub help
+{
+    my $name = $0;
+    eval {
+	use File::Basename;
+	$name = basename($0);
+    };
+
+print <<"_EOF_";
+
+Usage: $name [--foreground] [-o key=value]
+
+--foreground     do not detach from the terminal.
+
+-o lmtpd_max_workers=NUM    the number of workers.
+
+To stop $name, send SIGTERM to the pid in \$lmtpd_pid_file.
+
+_EOF_
+}
+
+
+=head1 INTERNAL DAEMON FUNCTIONS
+
+=cut
+
+
+# Descriptions: initialize a lmtpd process.
+#    Arguments: OBJ($curproc) HASH_REF($args)
+# Side Effects: update $config, chdir $lmtpd_dir.
+# Return Value: none
+sub _lmtpd_init
+{
+    my ($curproc, $args) = @_;
+    my $config           = $curproc->config();
+    my $work_dir         = $config->{ fml_default_ml_home_prefix };
+
+    # 1. set up the default domain.
+    $config->set('ml_domain',      $curproc->default_domain());
+    $config->set('ml_home_prefix', $work_dir);
+
+    # 2. initialize lmtpd process environment.
+    $curproc->config_cf_files_load();
+    $curproc->env_fix_perl_include_path();
+
+    # 3. socket, pid and log files are placed in $lmtpd_dir.
+    #    only $lmtpd_socket_group can search it to reach the socket.
+    my $lmtpd_dir = $config->{ lmtpd_dir };
+    $config->set('ml_home_dir', $lmtpd_dir);
+    unless (-d $lmtpd_dir) {
+	$curproc->mkdir($lmtpd_dir, "mode=private");
+    }
+    my $gid = $curproc->_lmtpd_socket_gid();
+    if (defined $gid) {
+	chown(-1, $gid, $lmtpd_dir);
+	chmod(0710, $lmtpd_dir);
+    }
+    chdir($lmtpd_dir) || croak("cannot chdir $lmtpd_dir");
+
+    $curproc->log_message_init();
+}
+
+
+# Descriptions: main routine of libexec/fmllmtpd process.
+#               keep $lmtpd_max_workers workers running.
+#    Arguments: OBJ($curproc)
+# Side Effects: fork(2) workers.
+#               create and remove $lmtpd_socket_path and $lmtpd_pid_file.
+# Return Value: none
+sub _lmtpd_main
+{
+    my ($curproc) = @_;
+    my $config    = $curproc->config();
+    my $option    = $curproc->command_line_options();
+    my $max       = $config->{ lmtpd_max_workers } || 1;
+    my $worker    = {};
+
+    # 1. prepare the socket before workers and modules.
+    my $socket = $curproc->_lmtpd_listen();
+    return unless defined $socket;
+
+    $curproc->_lmtpd_preload();
+
+    unless ($option->{ foreground }) {
+	$curproc->_lmtpd_daemonize();
+    }
+    $curproc->_lmtpd_pid_file_write();
+
+    # 2. signal handlers: stop workers after their current session.
+    $lmtpd_shutdown = 0;
+    my $stop = sub {
+	$lmtpd_shutdown = 1;
+	kill('TERM', keys %$worker);
+    };
+    local($SIG{ 'TERM' }) = $stop;
+    local($SIG{ 'INT' })  = $stop;
+    local($SIG{ 'CHLD' }) = 'DEFAULT';
+
+    $curproc->log("lmtpd started: workers=$max");
+
+    while (! $lmtpd_shutdown) {
+	# 3. fork workers up to $max.
+	while (! $lmtpd_shutdown && scalar(keys %$worker) < $max) {
+	    my $pid = fork();
+	    if (! defined $pid) {
+		$curproc->logerror("cannot fork: $!");
+		last;
+	    }
+	    elsif ($pid == 0) {
+		%$worker = ();
+		$curproc->_lmtpd_worker($socket);
+		exit(0);
+	    }
+	    else {
+		$worker->{ $pid } = time;
+	    }
+	}
+
+	# 4. wait for a worker to exit and restart it.
+	my $pid = waitpid(-1, 0);
+	if ($pid > 0) {
+	    if ($?) {
+		$curproc->logwarn("worker pid=$pid exit status=$?");
+	    }
+	    delete $worker->{ $pid };
+	}
+	else {
+	    sleep 1;
+	}
+    }
+
+    # 5. wait for workers, which may be forked after the signal.
+    kill('TERM', keys %$worker);
+    for my $pid (keys %$worker) {
+	waitpid($pid, 0);
+    }
+
+    $socket->close();
+    unlink($config->{ lmtpd_socket_path });
+    unlink($config->{ lmtpd_pid_file });
+
+    $curproc->log("lmtpd stopped");
+}
+
+
+# Descriptions: open the UNIX domain socket.
+#    Arguments: OBJ($curproc)
+# Side Effects: create $lmtpd_socket_path.
+#               remove the stale socket file.
+# Return Value: HANDLE
+sub _lmtpd_listen
+{
+    my ($curproc) = @_;
+    my $config    = $curproc->config();
+    my $path      = $config->{ lmtpd_socket_path };
+    my $mode      = $config->{ lmtpd_socket_mode } || '0660';
+    my $gid       = $curproc->_lmtpd_socket_gid();
+
+    use IO::Socket;
+
+    # 1. another daemon is running or the socket file is stale.
+    if (-S $path) {
+	my $peer = new IO::Socket::UNIX(Type => SOCK_STREAM, Peer => $path);
+	if (defined $peer) {
+	    $peer->close();
+	    $curproc->logerror("lmtpd already running on $path");
+	    return undef;
+	}
+	unlink($path);
+    }
+
+    # 2. listen.
+    my $socket = new IO::Socket::UNIX(Type   => SOCK_STREAM,
+				      Local  => $path,
+				      Listen => SOMAXCONN);
+    unless (defined $socket) {
+	$curproc->logerror("cannot listen $path: $!");
+	return undef;
+    }
+    chown(-1, $gid, $path) if defined $gid;
+    chmod(oct("$mode"), $path);
+
+    return $socket;
+}
+
+
+# Descriptions: return the gid of $lmtpd_socket_group.
+#    Arguments: OBJ($curproc)
+# Side Effects: none
+# Return Value: NUM or UNDEF
+sub _lmtpd_socket_gid
+{
+    my ($curproc) = @_;
+    my $config    = $curproc->config();
+    my $group     = $config->{ lmtpd_socket_group } || '';
+
+    return undef unless $group;
+
+    my $gid = $group =~ /^\d+$/o ? $group : getgrnam($group);
+    unless (defined $gid) {
+	$curproc->logwarn("lmtpd_socket_group: no such group $group");
+    }
+
+    return $gid;
+}
+
+
+# Descriptions: load modules and conversion tables before fork(2).
+#    Arguments: OBJ($curproc)
+# Side Effects: load modules.
+# Return Value: none
+sub _lmtpd_preload
+{
+    my ($curproc) = @_;
+    my $config    = $curproc->config();
+    my $modules   = $config->get_as_array_ref('lmtpd_preload_modules') || [];
+
+    for my $module (@$modules) {
+	eval qq{ require $module; };
+	if ($@) {
+	    $curproc->logerror("cannot load $module");
+	    $curproc->logerror($@);
+	}
+	else {
+	    $curproc->logdebug("load $module");
+	}
+    }
+
+    # Unicode::Japanese loads conversion tables at the first use.
+    eval q{
+	use Unicode::Japanese;
+	my $obj = new Unicode::Japanese("\xe3\x81\x82", 'utf8');
+	my $str = $obj->euc();
+    };
+    $curproc->logwarn($@) if $@;
+}
+
+
+# Descriptions: detach from the terminal.
+#    Arguments: OBJ($curproc)
+# Side Effects: fork(2), setsid(2) and reopen STDIN and STDOUT.
+# Return Value: none
+sub _lmtpd_daemonize
+{
+    my ($curproc) = @_;
+
+    my $pid = fork();
+    unless (defined $pid) {
+	croak("cannot fork: $!");
+    }
+    elsif ($pid) {
+	exit(0);
+    }
+
+    use POSIX qw(setsid);
+    setsid();
+
+    open(STDIN,  "< /dev/null");
+    open(STDOUT, "> /dev/null");
+}
+
+
+# Descriptions: save the pid of this process.
+#    Arguments: OBJ($curproc)
+# Side Effects: create $lmtpd_pid_file.
+# Return Value: none
+sub _lmtpd_pid_file_write
+{
+    my ($curproc) = @_;
+    my $config    = $curproc->config();
+    my $pid_file  = $config->{ lmtpd_pid_file };
+
+    use FileHandle;
+    my $wh = new FileHandle "> $pid_file";
+    if (defined $wh) {
+	print $wh $$, "\n";
+	$wh->close();
+    }
+    else {
+	$curproc->logerror("cannot open $pid_file");
+    }
+}
+
+
+=head1 INTERNAL WORKER FUNCTIONS
+
+=cut
+
+
+# Descriptions: accept and serve LMTP sessions.
+#               exit after $lmtpd_max_requests_per_worker sessions.
+#    Arguments: OBJ($curproc) HANDLE($socket)
+# Side Effects: none
+# Return Value: none
+sub _lmtpd_worker
+{
+    my ($curproc, $socket) = @_;
+    my $config = $curproc->config();
+    my $max    = $config->{ lmtpd_max_requests_per_worker } || 100;
+    my $count  = 0;
+
+    $lmtpd_shutdown = 0;
+    my $stop = sub { $lmtpd_shutdown = 1;};
+    local($SIG{ 'TERM' }) = $stop;
+    local($SIG{ 'INT' })  = $stop;
+
+    $curproc->set_process_title("fmllmtpd: worker");
+
+    while (! $lmtpd_shutdown && $count < $max) {
+	my $client = $socket->accept();
+	unless (defined $client) {
+	    unless ($!{ EINTR }) {
+		$curproc->logerror("accept: $!");
+		sleep 1;
+	    }
+	    next;
+	}
+
+	$count++;
+	$curproc->_lmtpd_session($client, $client);
+	$client->close();
+    }
+}
+
+
+# Descriptions: speak LMTP (RFC2033) over $rh and $wh.
+#    Arguments: OBJ($curproc) HANDLE($rh) HANDLE($wh)
+# Side Effects: deliver messages.
+# Return Value: none
+sub _lmtpd_session
+{
+    my ($curproc, $rh, $wh) = @_;
+    my $config  = $curproc->config();
+    my $timeout = $config->{ lmtpd_timeout } || 300;
+    my $limit   = $config->{ lmtpd_message_size_limit } || 10485760;
+    my $myname  = $curproc->_lmtpd_hostname();
+    my $lhlo    = 0;
+    my $sender  = undef;
+    my (@rcpt)  = ();
+
+    $wh->autoflush(1);
+
+    eval {
+	local($SIG{ 'ALRM' }) = sub { die("timeout\n");};
+
+	$curproc->_lmtpd_reply($wh, "220 $myname LMTP fml8 ready");
+
+      LINE:
+	while (1) {
+	    alarm($timeout);
+	    my $buf = <$rh>;
+	    last LINE unless defined $buf;
+
+	    $buf =~ s/\r?\n$//o;
+	    my ($command, $arg) = split(/\s+/, $buf, 2);
+	    $command = defined $command ? uc($command) : '';
+	    $arg     = defined $arg     ? $arg         : '';
+
+	    if ($command eq 'LHLO') {
+		($lhlo, $sender, @rcpt) = (1, undef);
+		$curproc->_lmtpd_reply($wh,
+				       "250-$myname",
+				       "250-PIPELINING",
+				       "250-SIZE $limit",
+				       "250-ENHANCEDSTATUSCODES",
+				       "250 8BITMIME");
+	    }
+	    elsif ($command eq 'MAIL') {
+		if (! $lhlo) {
+		    $curproc->_lmtpd_reply($wh,
+				   "503 5.5.1 Error: send LHLO first");
+		}
+		elsif (defined $sender) {
+		    $curproc->_lmtpd_reply($wh,
+				   "503 5.5.1 Error: nested MAIL command");
+		}
+		elsif ($arg =~ /^FROM:\s*<([^>]*)>/io) {
+		    my $from = $1;
+		    # the sender is written into the Return-Path: header.
+		    if ($from =~ /[\x00-\x1f\x7f]/o) {
+			$curproc->_lmtpd_reply($wh,
+			       "501 5.1.7 Error: bad sender address syntax");
+		    }
+		    elsif ($arg =~ /\sSIZE=(\d+)/io && $1 > $limit) {
+			$curproc->_lmtpd_reply($wh,
+			       "552 5.3.4 Error: message size exceeds limit");
+		    }
+		    else {
+			$sender = $from;
+			$curproc->_lmtpd_reply($wh, "250 2.1.0 Ok");
+		    }
+		}
+		else {
+		    $curproc->_lmtpd_reply($wh,
+				   "501 5.5.4 Syntax: MAIL FROM:<address>");
+		}
+	    }
+	    elsif ($command eq 'RCPT') {
+		if (! defined $sender) {
+		    $curproc->_lmtpd_reply($wh,
+				   "503 5.5.1 Error: need MAIL command");
+		}
+		elsif ($arg =~ /^TO:\s*<([^>]+)>/io) {
+		    my $address = $1;
+		    my $rcpt    = $curproc->_lmtpd_recipient_lookup($address);
+		    if (defined $rcpt) {
+			push(@rcpt, $rcpt);
+			$curproc->_lmtpd_reply($wh, "250 2.1.5 Ok");
+		    }
+		    else {
+			$curproc->_lmtpd_reply($wh,
+			   "550 5.1.1 <$address>: no such mailing list");
+		    }
+		}
+		else {
+		    $curproc->_lmtpd_reply($wh,
+				   "501 5.5.4 Syntax: RCPT TO:<address>");
+		}
+	    }
+	    elsif ($command eq 'DATA') {
+		unless (@rcpt) {
+		    $curproc->_lmtpd_reply($wh,
+				   "503 5.5.1 Error: need RCPT command");
+		    next LINE;
+		}
+
+		$curproc->_lmtpd_reply($wh,
+			       "354 End data with <CR><LF>.<CR><LF>");
+		my ($message, $exceeded) =
+		    $curproc->_lmtpd_read_data($rh, $limit);
+		last LINE unless defined $message;
+
+		# LMTP returns one reply for each recipient.
+		alarm(0);
+		for my $rcpt (@rcpt) {
+		    my $reply = $exceeded ?
+			"552 5.3.4 Error: message size exceeds limit" :
+			$curproc->_lmtpd_deliver($rcpt, $sender, \$message);
+		    $curproc->_lmtpd_reply($wh, $reply);
+		}
+		($sender, @rcpt) = (undef);
+	    }
+	    elsif ($command eq 'RSET') {
+		($sender, @rcpt) = (undef);
+		$curproc->_lmtpd_reply($wh, "250 2.0.0 Ok");
+	    }
+	    elsif ($command eq 'NOOP') {
+		$curproc->_lmtpd_reply($wh, "250 2.0.0 Ok");
+	    }
+	    elsif ($command eq 'QUIT') {
+		$curproc->_lmtpd_reply($wh, "221 2.0.0 Bye");
+		last LINE;
+	    }
+	    else {
+		$curproc->_lmtpd_reply($wh,
+			       "500 5.5.2 Error: command not recognized");
+	    }
+	}
+	alarm(0);
+    };
+    alarm(0);
+    $curproc->logerror("lmtp session: $@") if $@;
+}
+
+
+# Descriptions: read the message after DATA command.
+#               the message over $limit bytes is read but discarded.
+#    Arguments: OBJ($curproc) HANDLE($rh) NUM($limit)
+# Side Effects: none
+# Return Value: ARRAY( STR or UNDEF (connection lost), NUM(exceeded) )
+sub _lmtpd_read_data
+{
+    my ($curproc, $rh, $limit) = @_;
+    my $message  = '';
+    my $exceeded = 0;
+
+    while (defined(my $buf = <$rh>)) {
+	$buf =~ s/\r\n$/\n/o;
+	return( $message, $exceeded ) if $buf eq ".\n";
+	next if $exceeded;
+
+	$buf =~ s/^\.//o;
+	$message .= $buf;
+	if ($limit && length($message) > $limit) {
+	    ($message, $exceeded) = ('', 1);
+	}
+    }
+
+    return( undef, $exceeded );
+}
+
+
+# Descriptions: send LMTP reply lines.
+#    Arguments: OBJ($curproc) HANDLE($wh) ARRAY(@reply)
+# Side Effects: none
+# Return Value: none
+sub _lmtpd_reply
+{
+    my ($curproc, $wh, @reply) = @_;
+
+    print $wh join("", map { "$_\r\n" } @reply);
+}
+
+
+# Descriptions: return the host name for LMTP greeting.
+#    Arguments: OBJ($curproc)
+# Side Effects: none
+# Return Value: STR
+sub _lmtpd_hostname
+{
+    my ($curproc) = @_;
+    my $hostname  = 'localhost';
+
+    eval q{
+	use Sys::Hostname;
+	$hostname = hostname();
+    };
+
+    return $hostname;
+}
+
+
+# Descriptions: find the ML and the program for the recipient.
+#    Arguments: OBJ($curproc) STR($address)
+# Side Effects: none
+# Return Value: HASH_REF or UNDEF
+sub _lmtpd_recipient_lookup
+{
+    my ($curproc, $address) = @_;
+    my ($user, $domain) = split(/\@/, $address, 2);
+
+    return undef unless $user && $domain;
+    $user   =~ tr/A-Z/a-z/;
+    $domain =~ tr/A-Z/a-z/;
+
+    use FML::Restriction::Base;
+    my $safe = new FML::Restriction::Base;
+    return undef unless $safe->regexp_match("domain", $domain);
+
+    # 1. $ml_name@$ml_domain, 2. $ml_name-$suffix@$ml_domain
+    my (@candidate) = ([ $user, '' ]);
+    if ($user =~ /^(.+)-([^-]+)$/o) {
+	push(@candidate, [ $1, $2 ]);
+    }
+
+    for my $c (@candidate) {
+	my ($ml_name, $suffix) = @$c;
+	my $program = $lmtpd_suffix_program->{ $suffix };
+	next unless defined $program;
+	next unless $safe->regexp_match("ml_name", $ml_name);
+
+	if ($curproc->is_config_cf_exist($ml_name, $domain)) {
+	    return {
+		address   => $address,
+		ml_name   => $ml_name,
+		ml_domain => $domain,
+		program   => $program,
+	    };
+	}
+    }
+
+    return undef;
+}
+
+
+# Descriptions: deliver the message to the program for $rcpt.
+#    Arguments: OBJ($curproc) HASH_REF($rcpt) STR($sender) STR_REF($message)
+# Side Effects: fork(2) a process to run the program.
+# Return Value: STR(LMTP reply)
+sub _lmtpd_deliver
+{
+    my ($curproc, $rcpt, $sender, $message) = @_;
+    my $address = $rcpt->{ address };
+    my $program = $rcpt->{ program };
+
+    use FileHandle;
+    my $rh = new FileHandle;
+    my $wh = new FileHandle;
+    unless (pipe($rh, $wh)) {
+	$curproc->logerror("cannot pipe: $!");
+	return "451 4.3.0 <$address> Error: cannot pipe";
+    }
+
+    my $pid = fork();
+    unless (defined $pid) {
+	$curproc->logerror("cannot fork: $!");
+	$rh->close();
+	$wh->close();
+	return "451 4.3.0 <$address> Error: cannot fork";
+    }
+    elsif ($pid == 0) {
+	# the child reads the message from STDIN as the program does.
+	$wh->close();
+	open(STDIN, "<&" . fileno($rh)) || exit(75);
+	$rh->close();
+	$curproc->_lmtpd_run_program($rcpt);
+	exit(0);
+    }
+
+    # the header fields local delivery agents prepend.
+    $rh->close();
+    {
+	local($SIG{ 'PIPE' }) = 'IGNORE';
+	print $wh "Return-Path: <$sender>\n";
+	print $wh "Delivered-To: $address\n";
+	print $wh $$message;
+	$wh->close();
+    }
+
+    waitpid($pid, 0);
+    my $status = $?;
+    if ($status == 0) {
+	$curproc->log("$program <$address> from <$sender> ok");
+	return "250 2.0.0 <$address> Ok";
+    }
+    else {
+	my $code   = $status >> 8;
+	my $signal = $status & 127;
+	$curproc->logerror("$program <$address> from <$sender> " .
+			   "exit=$code signal=$signal");
+
+	# EX_TEMPFAIL or killed: let the MTA retry later.
+	if ($signal || $code == 75) {
+	    return "451 4.3.0 <$address> Error: temporary failure";
+	}
+	else {
+	    return "550 5.3.0 <$address> Error: permanent failure";
+	}
+    }
+}
+
+
+# Descriptions: run the program for $rcpt in this process.
+#    Arguments: OBJ($curproc) HASH_REF($rcpt)
+# Side Effects: same as the program.
+# Return Value: none
+sub _lmtpd_run_program
+{
+    my ($curproc, $rcpt) = @_;
+
+    use FML::Process::Switch;
+    &FML::Process::Switch::NewProcess($curproc,
+				      $rcpt->{ program },
+				      $rcpt->{ ml_name },
+				      $rcpt->{ ml_domain });
+}
+
+
+=head1 CODING STYLE
+
+See C<http://www.fml.org/software/FNF/> on fml coding style guide.
+
+=head1 AUTHOR
+
+Ken'ichi Fukamachi
+
+=head1 COPYRIGHT
+
+Copyright (C) 2012 Ken'ichi Fukamachi
+
+All rights reserved. This program is free software; you can
+redistribute it and/or modify it under the same terms as Perl itself.
+
+=head1 HISTORY
+
+FML::Process::LMTPD first appeared in fml8 mailing list driver package.
+See C<http://www.fml.org/> for more details.
+
+=cut
+
+
+1;
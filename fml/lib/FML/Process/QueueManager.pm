@@ -67,6 +67,11 @@ sub new
 try to send all messages in the queue. If the queue id C<$id> is
 specified, send only the queue corresponding to C<$id>.
 
+The queues to send are popped from the schedule of
+C<Mail::Delivery::Queue> in the order of time to deliver, without
+scanning queue directories. The schedule is created at the first time
+and rebuilt from queue directories periodically.
+
 =cut
 
 
@@ -99,6 +104,10 @@ sub send
     if (defined $id) {
 	$ra = [ $id ];
     }
+    elsif ($queue->schedule_is_available() || $queue->schedule_rebuild()) {
+	# pop queues in the order of time to deliver.
+	$ra = $queue->schedule_due_list($max_count);
+    }
     else {
 	# XXX-TODO: customizable
 	$queue->set_policy("fair-queue");
@@ -169,7 +178,13 @@ sub send
     if ($curproc->is_event_timeout($channel)) {
 	if (defined $queue) {
 	    $curproc->logdebug("qmgr: re-schedule");
-	    $queue->reschedule();
+	    if ($queue->schedule_is_available()) {
+		# sync the schedule with queue directories.
+		$queue->schedule_rebuild();
+	    }
+	    else {
+		$queue->reschedule();
+	    }
 	}
 	# XXX-TODO: customizable
 	$curproc->event_set_timeout($channel, time + 300);
@@ -459,6 +459,19 @@ For example, to search mail addresses matching $regexp in recipient list,
         do_somethig() if ($addr =~ /$regexp/);
     }
 
+To look up an address, you can give the user part of it as a hint.
+
+    my $a = $self->find(quotemeta($user), {
+	want => 'key',
+	all  => 1,
+	user => $user,
+    });
+
+A map with an index (see L<IO::Adapter::File/INDEX>) returns only keys
+whose user part is C<$user> case-insensitively without reading the
+whole map. Other maps ignore the hint and return all keys matching
+C<$regexp>, so the caller should check each result as usual.
+
 =cut
 
 
@@ -470,9 +483,6 @@ For example, to search mail addresses matching $regexp in recipient list,
 sub find
 {
     my ($self, $regexp, $args) = @_;
-    my $case_sensitive = $args->{ case_sensitive } ? 1 : 0;
-    my $show_all       = $args->{ all } ? 1 : 0;
-    my $want           = 'key,value';
 
     $self->_resume_context();
 
@@ -481,6 +491,22 @@ sub find
 	return $self->md_find($regexp, $args);
     }
 
+    return $self->_find_by_scan($regexp, $args);
+}
+
+
+# Descriptions: search method by reading the whole map.
+#               md_find() may fall back to this.
+#    Arguments: OBJ($self) STR($regexp) HASH_REF($args)
+# Side Effects: none
+# Return Value: STR or ARRAY_REF
+sub _find_by_scan
+{
+    my ($self, $regexp, $args) = @_;
+    my $case_sensitive = $args->{ case_sensitive } ? 1 : 0;
+    my $show_all       = $args->{ all } ? 1 : 0;
+    my $want           = 'key,value';
+
     # XXX NO, NOT USE quotemeta $regexp before call find() method HERE.
     # XXX PLEASE CARE REGEXP BEFORE CALL IO::Adapter.
     # we may need quote for special address e.g. a+b@domain.
@@ -385,6 +385,9 @@ sub add
 {
     my ($self, $addr, $argv) = @_;
 
+    # hold the index lock until the index follows this change.
+    my ($lock, $valid) = $self->_index_update_lock();
+
     # XXX-TODO: open only if not opened ?
     $self->open("w");
 
@@ -419,7 +422,9 @@ sub add
 	    print $wh $addr, "\n";
 	}
 
-	$wh->close;
+	my $r = $wh->close;
+	$self->_index_update($lock, $valid, [ $addr ], []);
+	return $r;
     }
     else {
 	$self->error_set("cannot open file=$self->{ _file }");
@@ -443,6 +448,10 @@ sub delete
 {
     my ($self, $key) = @_;
     my $found = 0;
+    my (@key) = ();
+
+    # hold the index lock until the index follows this change.
+    my ($lock, $valid) = $self->_index_update_lock();
 
     # XXX-TODO: open only if not opened ?
     $self->open("w");
@@ -459,6 +468,7 @@ sub delete
 	while ($buf = <$fh>) {
 	    if ($buf =~ /^$key\s+\S+|^$key\s*$/) {
 		$found++;
+		push(@key, (split(/\s+/, $buf))[0]);
 		next FILE_IO;
 	    }
 	    print $wh $buf;
@@ -466,6 +476,8 @@ sub delete
 	$wh->close;
 	$fh->close;
 
+	$self->_index_update($lock, $valid, [], \@key);
+
 	unless ($found) {
 	    $self->error_set("not match");
 	}
@@ -477,6 +489,243 @@ sub delete
 }
 
 
+=head1 INDEX
+
+A file map has an index to look up keys by the user part without
+reading the whole file.
+It is a DBM file named C<$file.index> next to the map,
+see L<IO::Adapter::FileIndex>,
+which holds the keys of the map by the lower-cased user part,
+e.g. C<fukachan> for C<fukachan@fml.org>.
+
+The index is created when find() is called with the C<user> hint for
+the first time, and rebuilt when the map is changed by other than
+add() and delete(), which update the index if it exists.
+add() and delete() hold the lock of the index during the change,
+so the index always follows the latest one.
+We compare the inode, size and mtime of the map saved in the index
+with the current ones to know it.
+If the index cannot be used, e.g. the directory is not writable,
+find() reads the whole map as usual.
+
+=head2 md_find($regexp, $args)
+
+map specific find().
+use the index if the C<user> hint is given with C<want =E<gt> 'key'>
+and C<all =E<gt> 1>, otherwise read the whole map.
+
+=cut
+
+
+# the value for users who have too many keys for one DBM entry.
+my $index_overflow = "\0overflow";
+my $index_max_len  = 900;
+
+
+# Descriptions: search, md = map dependent.
+#               look up the index by the user part if possible.
+#    Arguments: OBJ($self) STR($regexp) HASH_REF($args)
+# Side Effects: create or rebuild the index if needed.
+# Return Value: STR or ARRAY_REF
+sub md_find
+{
+    my ($self, $regexp, $args) = @_;
+    my $user = $args->{ user };
+    my $want = $args->{ want } || 'key,value';
+
+    if (defined $user && $user ne '' && $want eq 'key' && $args->{ all }) {
+	my $keys = $self->_index_lookup($user);
+	return $keys if defined $keys;
+	print STDERR "md_find: no index, scan $self->{ _file }\n" if $debug;
+    }
+
+    return $self->_find_by_scan($regexp, $args);
+}
+
+
+# Descriptions: return the index of the map.
+#    Arguments: OBJ($self)
+# Side Effects: none
+# Return Value: OBJ
+sub _index
+{
+    my ($self) = @_;
+
+    use IO::Adapter::FileIndex;
+    return new IO::Adapter::FileIndex { file => $self->{ _file } };
+}
+
+
+# Descriptions: return keys of $user in the index.
+#    Arguments: OBJ($self) STR($user)
+# Side Effects: create or rebuild the index if needed.
+# Return Value: ARRAY_REF or undef if the index is not available.
+sub _index_lookup
+{
+    my ($self, $user) = @_;
+    my $file  = $self->{ _file } || return undef;
+    my $index = $self->_index();
+    my %index = ();
+
+    use FileHandle;
+    my $fh = new FileHandle $file;
+    return undef unless defined $fh;
+
+    # the map is not changed by add() or delete() while locked.
+    my ($lock, $state) = $index->read_open(\%index, $fh, sub {
+	return $self->_index_rebuild();
+    });
+    return undef unless defined $lock;
+    unless ($state eq 'ok') {
+	untie %index;
+	return undef;
+    }
+
+    my $keys = $index{ "\L$user\E" };
+    untie %index;
+
+    return []    unless defined $keys;
+    return undef if $keys eq $index_overflow;
+    return [ split(/\n/, $keys) ];
+}
+
+
+# Descriptions: create the index from the whole map.
+#    Arguments: OBJ($self)
+# Side Effects: create or overwrite the index.
+# Return Value: NUM(1 or 0)
+sub _index_rebuild
+{
+    my ($self) = @_;
+    my $file   = $self->{ _file };
+    my $index  = $self->_index();
+
+    return $index->write_open(sub {
+	my ($xindex) = @_;
+	my %keys = ();
+
+	use FileHandle;
+	my $fh = new FileHandle $file;
+	return 0 unless defined $fh;
+
+	# the same keys as get_next_key() returns.
+	my $buf;
+      LINE:
+	while ($buf = <$fh>) {
+	    next LINE if $buf =~ /^\s*$/o;
+	    next LINE if $buf =~ /^\#/o;
+	    $buf =~ s/[\r\n]*$//o;
+
+	    my ($key) = split(/\s+/, $buf, 2);
+	    next LINE unless defined $key && $key ne '';
+
+	    my ($user) = split(/\@/, $key);
+	    push(@{ $keys{ "\L$user\E" } }, $key);
+	}
+
+	%$xindex = ();
+	for my $user (keys %keys) {
+	    my $keys = join("\n", @{ $keys{ $user } });
+	    $xindex->{ $user } =
+		length($keys) > $index_max_len ? $index_overflow : $keys;
+	}
+
+	# the stat of the map we read, which may be newer than the caller's.
+	$index->set_stat($xindex, $fh);
+	$fh->close;
+
+	print STDERR "index: rebuild $file\n" if $debug;
+	return 1;
+    });
+}
+
+
+# Descriptions: lock the index exclusively before add() or delete()
+#               changes the map, and check whether the index is for
+#               the map before the change.
+#    Arguments: OBJ($self)
+# Side Effects: none
+# Return Value: ARRAY(HANDLE, NUM) or empty ARRAY if no index.
+sub _index_update_lock
+{
+    my ($self) = @_;
+    my $index  = $self->_index();
+    my %index  = ();
+
+    # no index has been created for this map.
+    return () unless $index->is_created();
+
+    use Fcntl qw(:DEFAULT :flock);
+    my $lock = $index->lock(LOCK_EX) || return ();
+
+    use FileHandle;
+    my $fh    = new FileHandle $self->{ _file };
+    my $valid = 0;
+    if (defined $fh && $index->tie(\%index, O_RDONLY)) {
+	$valid = $index->state(\%index, $fh) eq 'ok' ? 1 : 0;
+	untie %index;
+    }
+
+    return ($lock, $valid);
+}
+
+
+# Descriptions: update the index after add() or delete().
+#               The caller holds $lock from before checking the index
+#               ($valid) until this update ends, so that no other
+#               change gets in between.
+#               If the index was not for the map before the change,
+#               leave it to be rebuilt later.
+#    Arguments: OBJ($self) HANDLE($lock) NUM($valid)
+#               ARRAY_REF($added) ARRAY_REF($deleted)
+# Side Effects: update the index.
+# Return Value: none
+sub _index_update
+{
+    my ($self, $lock, $valid, $added, $deleted) = @_;
+    my $index = $self->_index();
+    my %index = ();
+
+    return unless defined $lock && $valid;
+
+    use FileHandle;
+    my $fh = new FileHandle $self->{ _file };
+    return unless defined $fh;
+
+    use Fcntl qw(:DEFAULT :flock);
+    $index->tie(\%index, O_RDWR) || return;
+
+    for my $key (@$added) {
+	my ($user) = split(/\@/, $key);
+	my $keys   = $index{ "\L$user\E" };
+	next if defined $keys && $keys eq $index_overflow;
+
+	$keys = defined $keys ? "$keys\n$key" : $key;
+	$keys = $index_overflow if length($keys) > $index_max_len;
+	$index{ "\L$user\E" } = $keys;
+    }
+
+    for my $key (@$deleted) {
+	my ($user) = split(/\@/, $key);
+	my $keys   = $index{ "\L$user\E" };
+	next unless defined $keys;
+	next if $keys eq $index_overflow;
+
+	my (@keys) = grep { $_ ne $key } split(/\n/, $keys);
+	if (@keys) {
+	    $index{ "\L$user\E" } = join("\n", @keys);
+	}
+	else {
+	    delete $index{ "\L$user\E" };
+	}
+    }
+
+    $index->set_stat(\%index, $fh);
+
+    untie %index;
+}
+
+
 =head1 LOCK
 
 =head2 lock($args)
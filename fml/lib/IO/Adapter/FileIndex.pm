@@ -0,0 +1,370 @@
+#-*- perl -*-
+#
+#  Copyright (C) 2012 Ken'ichi Fukamachi
+#   All rights reserved. This program is free software; you can
+#   redistribute it and/or modify it under the same terms as Perl itself.
+#
+# $FML$
+#
+
+package IO::Adapter::FileIndex;
+use strict;
+use vars qw(@ISA @EXPORT @EXPORT_OK);
+use Carp;
+use Fcntl qw(:DEFAULT :flock);
+
+=head1 NAME
+
+IO::Adapter::FileIndex - DBM index kept next to a line based file.
+
+=head1 SYNOPSIS
+
+    use IO::Adapter::FileIndex;
+    my $index = new IO::Adapter::FileIndex { file => $file };
+
+    # look up: lock and tie the index, (re)build it if it is stale.
+    my %index = ();
+    my $fh    = new FileHandle $file;
+    my ($lock, $state) = $index->read_open(\%index, $fh, sub {
+	$index->write_open(sub {
+	    my ($index) = @_;
+	    %$index = ();
+	    ... scan $file and fill %$index ...
+	    $index->set_stat($index, $fh);
+	});
+    });
+    if ($lock) {
+	my $value = $index{ $key };
+	untie %index;
+    }
+
+=head1 DESCRIPTION
+
+This module handles a DBM file (AnyDBM_File) named C<$file.index>
+which helps to look up C<$file> without reading the whole file.
+The index is locked by flock(2) of C<$file.index.lock>.
+
+The index holds the stat of C<$file> when it is built.
+We compare the device, inode, size and mtime with the current ones
+to know whether the index is still for the file.
+The index also holds the checksum of the head and the tail of the
+indexed part, since a file truncated and rewritten in place, e.g. by
+C<open(file, "w+")> or cp(1), keeps the inode and may be as large.
+The contents of the index are up to the caller.
+
+=head1 METHODS
+
+=head2 new($args)
+
+constructor. C<$args-E<gt>{ file }> is the file to index.
+
+=cut
+
+
+# the key to hold the stat of the file in the index.
+my $index_stat_key = "\0stat";
+
+# the key to hold the checksum of the head and the tail of the indexed
+# part, and the length of them.
+my $index_check_key = "\0check";
+my $index_check_len = 512;
+
+
+# Descriptions: constructor.
+#    Arguments: OBJ($self) HASH_REF($args)
+# Side Effects: none
+# Return Value: OBJ
+sub new
+{
+    my ($self, $args) = @_;
+    my ($type) = ref($self) || $self;
+    my $me     = { _file => $args->{ file } };
+
+    return bless $me, $type;
+}
+
+
+=head2 is_created()
+
+return 1 if the index has been created for the file.
+
+=head2 lock($mode)
+
+flock(2) the lock file of the index by C<$mode>.
+The lock is released when the returned handle is freed.
+
+=head2 tie($hash, $flag)
+
+tie the hash C<%$hash> to the index opened with C<$flag>.
+
+=cut
+
+
+# Descriptions: check whether the index has been created.
+#    Arguments: OBJ($self)
+# Side Effects: none
+# Return Value: NUM(1 or 0)
+sub is_created
+{
+    my ($self) = @_;
+
+    return( -f $self->{ _file }.".index.lock" ? 1 : 0 );
+}
+
+
+# Descriptions: flock(2) the lock file of the index.
+#               the lock is released when the returned handle is freed.
+#    Arguments: OBJ($self) NUM($mode)
+# Side Effects: create the lock file if needed.
+# Return Value: HANDLE or undef
+sub lock
+{
+    my ($self, $mode) = @_;
+    my $file = $self->{ _file }.".index.lock";
+
+    use FileHandle;
+    my $fh = new FileHandle ">> $file";
+    return undef unless defined $fh;
+    return flock($fh, $mode) ? $fh : undef;
+}
+
+
+# Descriptions: tie %$index to the index.
+#    Arguments: OBJ($self) HASH_REF($index) NUM($flag)
+# Side Effects: create the index if O_CREAT in $flag.
+# Return Value: NUM(1 or 0)
+sub tie
+{
+    my ($self, $index, $flag) = @_;
+    my $file = $self->{ _file }.".index";
+
+    use AnyDBM_File;
+    my $r = eval { CORE::tie(%$index, 'AnyDBM_File', $file, $flag, 0644);};
+    return $r ? 1 : 0;
+}
+
+
+=head2 read_open($hash, $fh, $build)
+
+lock the index shared and tie C<%$hash> to it for read.
+If the index is not for the file opened as C<$fh>,
+call C<$build> to create or update it and try again.
+
+It returns the lock handle and the state of the index,
+see C<state()>, or an empty list if the index is not available.
+The caller should untie C<%$hash> before freeing the lock handle.
+
+=head2 write_open($proc)
+
+lock the index exclusively without waiting, tie it for write and
+call C<$proc> with the tied hash.
+
+=cut
+
+
+# Descriptions: lock and tie the index for look up.
+#               (re)build the index by $build if it is not for $fh.
+#    Arguments: OBJ($self) HASH_REF($index) HANDLE($fh) CODE_REF($build)
+# Side Effects: create or update the index if needed.
+# Return Value: ARRAY(HANDLE, STR) or empty ARRAY
+sub read_open
+{
+    my ($self, $index, $fh, $build) = @_;
+
+    my $lock  = $self->lock(LOCK_SH|LOCK_NB) || return ();
+    my $state = $self->tie($index, O_RDONLY) ? $self->state($index, $fh) : '';
+    return ($lock, $state) if $state eq 'ok';
+
+    untie %$index;
+    undef $lock;
+
+    &$build() || return ();
+
+    # the file may be appended after $build().
+    $lock  = $self->lock(LOCK_SH|LOCK_NB) || return ();
+    $self->tie($index, O_RDONLY)         || return ();
+    $state = $self->state($index, $fh);
+    unless ($state) {
+	untie %$index;
+	return ();
+    }
+
+    return ($lock, $state);
+}
+
+
+# Descriptions: lock and tie the index for write, then call $proc.
+#    Arguments: OBJ($self) CODE_REF($proc)
+# Side Effects: create or update the index.
+# Return Value: NUM(1 or 0)
+sub write_open
+{
+    my ($self, $proc) = @_;
+    my %index = ();
+
+    my $lock = $self->lock(LOCK_EX|LOCK_NB)   || return 0;
+    $self->tie(\%index, O_RDWR|O_CREAT) || return 0;
+    my $r = &$proc(\%index);
+    untie %index;
+
+    return $r ? 1 : 0;
+}
+
+
+=head2 stat($fh)
+
+return the stat of C<$fh>, a handle or a file name, as a string.
+
+=head2 set_stat($hash, $fh [, $size])
+
+save the stat of the file opened as C<$fh> and the checksum of it
+into the index tied to C<%$hash>.
+C<$size> overrides the size if only the first C<$size> bytes of the
+file are indexed.
+
+=head2 indexed_size($hash)
+
+return the size of the file saved in the index.
+
+=head2 state($hash, $fh)
+
+compare the stat and the checksum saved in the index with the file
+opened as C<$fh>.
+It returns C<ok> if the index is for the current file,
+C<grown> if lines are appended to the indexed part of the file,
+or an empty string if the index should be rebuilt.
+
+=cut
+
+
+# Descriptions: return the stat of $fh to check the index.
+#    Arguments: OBJ($self) HANDLE($fh)
+# Side Effects: none
+# Return Value: STR
+sub stat
+{
+    my ($self, $fh) = @_;
+
+    my (@stat) = CORE::stat($fh);
+    return @stat ? join(" ", @stat[0, 1, 7, 9]) : '';
+}
+
+
+# Descriptions: save the stat and the checksum of $fh into the index.
+#    Arguments: OBJ($self) HASH_REF($index) HANDLE($fh) NUM($size)
+# Side Effects: update the index.
+#               seek $fh
+# Return Value: none
+sub set_stat
+{
+    my ($self, $index, $fh, $size) = @_;
+
+    my ($dev, $ino, $xsize, $mtime) = split(/\s+/, $self->stat($fh));
+    $size = $xsize unless defined $size;
+    $index->{ $index_stat_key }  = join(" ", $dev, $ino, $size, $mtime);
+    $index->{ $index_check_key } = $self->_checksum($fh, $size);
+}
+
+
+# Descriptions: return the stat saved in the index.
+#    Arguments: OBJ($self) HASH_REF($index)
+# Side Effects: none
+# Return Value: STR
+sub get_stat
+{
+    my ($self, $index) = @_;
+
+    return( $index->{ $index_stat_key } || '' );
+}
+
+
+# Descriptions: return the size of the file saved in the index.
+#    Arguments: OBJ($self) HASH_REF($index)
+# Side Effects: none
+# Return Value: NUM
+sub indexed_size
+{
+    my ($self, $index) = @_;
+
+    return( (split(/\s+/, $self->get_stat($index)))[2] || 0 );
+}
+
+
+# Descriptions: check the index for the file opened as $fh.
+#    Arguments: OBJ($self) HASH_REF($index) HANDLE($fh)
+# Side Effects: seek $fh
+# Return Value: STR(ok, grown or "" if the index should be rebuilt)
+sub state
+{
+    my ($self, $index, $fh) = @_;
+    my ($dev, $ino, $size, $mtime) = split(/\s+/, $self->get_stat($index));
+    my (@stat) = CORE::stat($fh);
+
+    return '' unless defined $mtime && @stat;
+    return '' unless $dev eq $stat[0] && $ino eq $stat[1];
+    return '' unless $size <= $stat[7];
+
+    # the indexed part may be rewritten in place.
+    my $checksum = $index->{ $index_check_key } || '';
+    return '' unless $checksum eq $self->_checksum($fh, $size);
+
+    return 'ok' if $size == $stat[7] && $mtime eq $stat[9];
+    return ''   unless $size < $stat[7];
+
+    # the indexed part should end with a complete line.
+    if ($size > 0) {
+	my $c = '';
+	seek($fh, $size - 1, 0);
+	read($fh, $c, 1);
+	return '' unless $c eq "\n";
+    }
+
+    return 'grown';
+}
+
+
+# Descriptions: return the checksum of the head and the tail of the
+#               first $size bytes of the file opened as $fh.
+#    Arguments: OBJ($self) HANDLE($fh) NUM($size)
+# Side Effects: seek $fh
+# Return Value: STR
+sub _checksum
+{
+    my ($self, $fh, $size) = @_;
+    my $len  = $size < $index_check_len ? $size : $index_check_len;
+    my $head = '';
+    my $tail = '';
+
+    seek($fh, 0, 0);
+    read($fh, $head, $len);
+    seek($fh, $size - $len, 0);
+    read($fh, $tail, $len);
+
+    use Digest::MD5 qw(md5_hex);
+    return md5_hex($size, ' ', $head, $tail);
+}
+
+
+=head1 CODING STYLE
+
+See C<http://www.fml.org/software/FNF/> on fml coding style guide.
+
+=head1 AUTHOR
+
+Ken'ichi Fukamachi
+
+=head1 COPYRIGHT
+
+Copyright (C) 2012 Ken'ichi Fukamachi
+
+All rights reserved. This program is free software; you can
+redistribute it and/or modify it under the same terms as Perl itself.
+
+=head1 HISTORY
+
+IO::Adapter::FileIndex first appeared in fml8 mailing list driver package.
+See C<http://www.fml.org/> for more details.
+
+=cut
+
+1;
@@ -630,6 +630,63 @@ sub get_smtp_recipient_limit
 }
 
 
+# Descriptions: set smtp_pipelining_window.
+#    Arguments: OBJ($self) NUM($window)
+# Side Effects: update $self
+# Return Value: none
+sub set_smtp_pipelining_window
+{
+    my ($self, $window) = @_;
+
+    # 0 is valid (disables pipelining).
+    $self->{ _smtp_pipelining_window } = defined $window ? $window : 100;
+
+    if (defined $window && $window != 100) {
+	$self->logdebug("smtp_pipelining_window = $window");
+    }
+}
+
+
+# Descriptions: get smtp_pipelining_window.
+#    Arguments: OBJ($self)
+# Side Effects: none
+# Return Value: NUM
+sub get_smtp_pipelining_window
+{
+    my ($self) = @_;
+
+    return( $self->{ _smtp_pipelining_window } || 0 );
+}
+
+
+# Descriptions: set smtp_max_concurrency.
+#    Arguments: OBJ($self) NUM($concurrency)
+# Side Effects: update $self
+# Return Value: none
+sub set_smtp_max_concurrency
+{
+    my ($self, $concurrency) = @_;
+
+    $self->{ _smtp_max_concurrency } = $concurrency || 1;
+
+    if (defined $concurrency && $concurrency > 1) {
+	$self->logdebug("smtp_max_concurrency = $concurrency");
+    }
+}
+
+
+# Descriptions: get smtp_max_concurrency.
+#    Arguments: OBJ($self)
+# Side Effects: none
+# Return Value: NUM
+sub get_smtp_max_concurrency
+{
+    my ($self) = @_;
+
+    return( $self->{ _smtp_max_concurrency } || 1 );
+}
+
+
 # Descriptions: set smtp_default_timeout.
 #    Arguments: OBJ($self) NUM($timeout)
 # Side Effects: update $self
@@ -530,7 +530,7 @@ update scheduling for this queue (id = $id).
 # Descriptions: update queue info for queue management policy.
 #    Arguments: OBJ($self) STR($id)
 # Side Effects: update queue file.
-# Return Value: none
+# Return Value: NUM(time to retry)
 sub update_schedule
 {
     my ($self, $id) = @_;
@@ -545,6 +545,8 @@ sub update_schedule
     # set expired time.
     my $qf_deferred = $self->deferred_file_path($id);
     utime $time, $time, $qf_deferred;
+
+    return $time;
 }
 
 
@@ -597,12 +599,14 @@ sub sleep_queue
 
 # Descriptions: change mode.
 #               move active queue to deferred one, vice versa.
-#    Arguments: OBJ($self) STR($id) STR($to_mode)
+#               $time is the time to deliver in the schedule when
+#               the queue is activated, now by default.
+#    Arguments: OBJ($self) STR($id) STR($to_mode) NUM($time)
 # Side Effects: update queue.
 # Return Value: none
 sub _change_queue_mode
 {
-    my ($self, $id, $to_mode) = @_;
+    my ($self, $id, $to_mode, $time) = @_;
 
     $id ||= $self->id();
 
@@ -616,6 +620,7 @@ sub _change_queue_mode
 		$self->touch($qf_active);
 		if (-f $qf_active) {
 		    $self->_logdebug("qid=$id activated.");
+		    $self->_schedule_update($id, "active", $time || time);
 		}
 		else {
 		    $self->_logerror("qid=$id operation failed.");
@@ -629,10 +634,11 @@ sub _change_queue_mode
 	    if (-f $qf_active) {
 		rename($qf_active, $qf_deferred);
 		$self->touch($qf_deferred);
-		$self->update_schedule($id);
+		my $retry = $self->update_schedule($id);
 
 		if (-f $qf_deferred) {
 		    $self->_logdebug("qid=$id deferred");
+		    $self->_schedule_update($id, "deferred", $retry);
 		}
 		else {
 		    $self->_logerror("qid=$id operation failed.");
@@ -702,6 +708,305 @@ sub reschedule
 }
 
 
+=head1 SCHEDULE INDEX
+
+To avoid scanning queue directories on each queue run, we keep the
+schedule of active and deferred queues in a DBM file (AnyDBM_File)
+C<$queue_dir/schedule>. Queues are put into slots of
+C<$schedule_slot> seconds by the time when the queue should be
+delivered (or retried). The index holds
+
+    T<SLOT>.<SEQ>  => QUEUE_ID
+    S<SLOT>        => "FIRST NEXT", range of SEQ in the slot
+    Q<QUEUE_ID>    => "SLOT SEQ STATE"
+    \0head         => the earliest slot which may hold queues
+
+where SLOT is the zero-padded start time of the slot, SEQ numbers the
+queues in the slot in the order they are put, and STATE is C<active>
+or C<deferred>. A queue is found from the earliest slot without
+reading the whole index, and it is updated or deleted by the Q key.
+
+setrunnable(), sleep_queue() and wakeup_queue() update the queue's
+entry if the schedule exists, and remove() deletes it.
+schedule_rebuild() creates the schedule from queue directories.
+
+=head2 schedule_is_available()
+
+return 1 if the schedule exists.
+
+=head2 schedule_rebuild()
+
+create or rewrite the schedule from C<active/> and C<deferred/>
+directories. The time of a queue is the mtime of the queue file.
+return 1 (success) or 0 (fail).
+
+=head2 schedule_due_list($max, [ $now ])
+
+return the queue ids to deliver as ARRAY_REF, up to C<$max> ids.
+They are taken from the earliest slot, so the earliest queue comes
+first. Queues in a slot come in the order they are scheduled.
+A deferred queue whose time has come is woken up by wakeup_queue().
+
+The queues returned are leased for C<$schedule_lease> seconds, that
+is, they are moved to a later slot. If the caller neither removes nor
+defers a queue, e.g. it is locked by another process, the queue is
+due again after the lease.
+
+=cut
+
+
+# the width of a slot and the time a queue taken by
+# schedule_due_list() is leased.
+my $schedule_slot  = 60;
+my $schedule_lease = 300;
+
+# the key which marks the schedule is built and the key of the
+# earliest slot.
+my $schedule_mark_key = "\0schedule";
+my $schedule_head_key = "\0head";
+
+
+# Descriptions: check if the schedule exists.
+#    Arguments: OBJ($self)
+# Side Effects: none
+# Return Value: NUM(1 or 0)
+sub schedule_is_available
+{
+    my ($self) = @_;
+    my %db     = ();
+
+    use Fcntl qw(:DEFAULT :flock);
+    my $lock = $self->_schedule_lock(LOCK_SH) || return 0;
+    $self->_schedule_tie(\%db, O_RDONLY)       || return 0;
+    my $r = defined $db{ $schedule_mark_key } ? 1 : 0;
+    untie %db;
+
+    return $r;
+}
+
+
+# Descriptions: create the schedule from queue directories.
+#    Arguments: OBJ($self)
+# Side Effects: rewrite the schedule.
+# Return Value: NUM(1 or 0)
+sub schedule_rebuild
+{
+    my ($self) = @_;
+    my %db     = ();
+
+    use Fcntl qw(:DEFAULT :flock);
+    my $lock = $self->_schedule_lock(LOCK_EX|LOCK_NB);
+    unless (defined $lock) {
+	$self->_logdebug("schedule is locked");
+	return 0;
+    }
+
+    unless ($self->_schedule_tie(\%db, O_RDWR|O_CREAT)) {
+	$self->_logerror("cannot open schedule");
+	return 0;
+    }
+
+    # [ QUEUE_ID, STATE, TIME ]
+    my (@queue) = ();
+    for my $state (qw(active deferred)) {
+	my $list = $self->list($state, "default");
+	my $fp   = "${state}_file_path";
+
+	for my $qid (@$list) {
+	    my (@stat) = CORE::stat($self->$fp($qid));
+	    push(@queue, [ $qid, $state, $stat[9] ]) if @stat;
+	}
+    }
+
+    # put them in the order of time, so that older queues come first
+    # in a slot.
+    %db = ();
+    for my $q (sort { $a->[2] <=> $b->[2] || $a->[0] cmp $b->[0] } @queue) {
+	_schedule_put(\%db, @$q);
+    }
+    $db{ $schedule_mark_key } = time;
+    untie %db;
+
+    $self->_logdebug("schedule rebuilt: ".scalar(@queue)." queue(s)");
+    return 1;
+}
+
+
+# Descriptions: take queue ids to deliver from the schedule.
+#    Arguments: OBJ($self) NUM($max) NUM($now)
+# Side Effects: lease the queues in the schedule.
+#               wake up deferred queues.
+# Return Value: ARRAY_REF
+sub schedule_due_list
+{
+    my ($self, $max, $now) = @_;
+    my (@due) = ();
+    my (@r)   = ();
+
+    $now ||= time;
+    my $lease = $now + $schedule_lease;
+
+    use Fcntl qw(:DEFAULT :flock);
+    {
+	my $lock = $self->_schedule_lock(LOCK_EX) || return [];
+	my %db   = ();
+	$self->_schedule_tie(\%db, O_RDWR) || return [];
+
+	# take queues from the earliest slot.
+	my $slot = $db{ $schedule_head_key };
+      SLOT:
+	while (defined $slot && $slot <= $now) {
+	    my $key = sprintf("%010d", $slot);
+	    my ($first, $next) = split(/\s+/, $db{ "S$key" } || "0 0");
+
+	    while ($first < $next) {
+		last if $max && @due >= $max;
+
+		my $qid   = $db{ "T$key.$first" };
+		my $entry = defined $qid ? $db{ "Q$qid" } : undef;
+		if (defined $entry) {
+		    my ($x_slot, $x_seq, $state) = split(/\s+/, $entry);
+		    push(@due, [ $qid, $state ]);
+		}
+		$first++;
+	    }
+
+	    # $max reached.
+	    if ($first < $next) {
+		$db{ "S$key" } = join(" ", $first, $next);
+		last SLOT;
+	    }
+
+	    delete $db{ "S$key" };
+	    $slot += $schedule_slot;
+	}
+	$db{ $schedule_head_key } = $slot if defined $slot;
+
+	for my $entry (@due) {
+	    _schedule_put(\%db, $entry->[ 0 ], $entry->[ 1 ], $lease);
+	}
+	untie %db;
+    }
+
+    for my $entry (@due) {
+	my ($qid, $state) = @$entry;
+
+	if ($state eq 'deferred' && -f $self->deferred_file_path($qid)) {
+	    $self->_change_queue_mode($qid, "active", $lease);
+	}
+
+	if (-f $self->active_file_path($qid)) {
+	    push(@r, $qid);
+	}
+	elsif (! -f $self->deferred_file_path($qid)) {
+	    # removed outside this module.
+	    $self->_schedule_update($qid, "removed");
+	}
+    }
+
+    return \@r;
+}
+
+
+# Descriptions: update the entry of queue $id in the schedule
+#               if the schedule exists.
+#    Arguments: OBJ($self) STR($id) STR($mode) NUM($time)
+# Side Effects: update the schedule.
+# Return Value: none
+sub _schedule_update
+{
+    my ($self, $id, $mode, $time) = @_;
+    my %db = ();
+
+    use Fcntl qw(:DEFAULT :flock);
+    my $lock = $self->_schedule_lock(LOCK_EX) || return;
+    $self->_schedule_tie(\%db, O_RDWR)         || return;
+
+    if (defined $db{ $schedule_mark_key }) {
+	if ($mode eq 'removed') {
+	    _schedule_delete(\%db, $id);
+	}
+	else {
+	    _schedule_put(\%db, $id, $mode, $time);
+	}
+    }
+    untie %db;
+}
+
+
+# Descriptions: tie %$db to the schedule.
+#    Arguments: OBJ($self) HASH_REF($db) NUM($flag)
+# Side Effects: create the schedule if O_CREAT in $flag.
+# Return Value: NUM(1 or 0)
+sub _schedule_tie
+{
+    my ($self, $db, $flag) = @_;
+    my $file = $self->schedule_file_path();
+
+    use AnyDBM_File;
+    my $r = eval { tie(%$db, 'AnyDBM_File', $file, $flag, 0644);};
+    return $r ? 1 : 0;
+}
+
+
+# Descriptions: put queue $id into the slot of $time in %$db.
+#    Arguments: HASH_REF($db) STR($id) STR($mode) NUM($time)
+# Side Effects: update %$db
+# Return Value: none
+sub _schedule_put
+{
+    my ($db, $id, $mode, $time) = @_;
+    my $slot = $time - $time % $schedule_slot;
+    my $key  = sprintf("%010d", $slot);
+
+    _schedule_delete($db, $id);
+
+    my ($first, $next) = split(/\s+/, $db->{ "S$key" } || "0 0");
+    $db->{ "T$key.$next" } = $id;
+    $db->{ "S$key" }       = join(" ", $first, $next + 1);
+    $db->{ "Q$id" }        = join(" ", $slot, $next, $mode);
+
+    my $head = $db->{ $schedule_head_key };
+    unless (defined $head && $head <= $slot) {
+	$db->{ $schedule_head_key } = $slot;
+    }
+}
+
+
+# Descriptions: delete queue $id from %$db.
+#    Arguments: HASH_REF($db) STR($id)
+# Side Effects: update %$db
+# Return Value: none
+sub _schedule_delete
+{
+    my ($db, $id) = @_;
+    my $entry = $db->{ "Q$id" };
+
+    if (defined $entry) {
+	my ($slot, $seq) = split(/\s+/, $entry);
+	delete $db->{ sprintf("T%010d.%d", $slot, $seq) };
+	delete $db->{ "Q$id" };
+    }
+}
+
+
+# Descriptions: flock(2) the lock file of the schedule.
+#               the lock is released when the returned handle is freed.
+#    Arguments: OBJ($self) NUM($mode)
+# Side Effects: create the lock file if needed.
+# Return Value: HANDLE or undef
+sub _schedule_lock
+{
+    my ($self, $mode) = @_;
+    my $file = $self->schedule_file_path().".lock";
+
+    use FileHandle;
+    my $fh = new FileHandle ">> $file";
+    return undef unless defined $fh;
+    return flock($fh, $mode) ? $fh : undef;
+}
+
+
 =head1 LOCK
 
 =head2 lock()
@@ -994,6 +1299,7 @@ sub remove
     if ($count > 0) {
 	if ($count == $removed) {
 	    $self->_logdebug("qid=$id removed");
+	    $self->_schedule_update($id, "removed");
 	}
 	else {
 	    $self->_logerror("qid=$id remove failed");
@@ -1082,6 +1388,7 @@ sub setrunnable
 
     # move new/$id to active/$id
     if (rename($qf_new, $qf_active)) {
+	$self->_schedule_update($id, "active", time);
 	return 1;
     }
     else {
@@ -1767,6 +2074,19 @@ sub strategy_file_path
 }
 
 
+# Descriptions: return the schedule file path.
+#    Arguments: OBJ($self)
+# Side Effects: none
+# Return Value: STR
+sub schedule_file_path
+{
+    my ($self) = @_;
+    my $dir = $self->get_queue_directory() || croak("directory undefined");
+
+    return File::Spec->catfile($dir, "schedule");
+}
+
+
 # Descriptions: return local class directory path.
 #    Arguments: OBJ($self) STR($class)
 # Side Effects: none
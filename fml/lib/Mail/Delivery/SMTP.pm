@@ -13,6 +13,7 @@ use strict;
 use vars qw(@ISA @EXPORT @EXPORT_OK);
 use Carp;
 use IO::Socket;
+use POSIX ();
 
 # Mail::Delivery::SMTP IS-A Mail::Delivery::Protocol.
 use Mail::Delivery::Protocol;
@@ -35,6 +36,7 @@ my $MTA_ERR_FATAL   = 'FATAL';
 my $SMTP_OK         = 'OK';
 my $SMTP_ERR_RETRY  = 'SMTP RETRY';
 my $SMTP_ERR_FATAL  = 'SMTP FATAL ERROR';
+my $SMTP_ERR_IO     = 'SMTP IO ERROR';
 
 
 =head1 NAME
@@ -141,6 +143,8 @@ sub new
     bless $me, $type;
 
     $me->set_smtp_recipient_limit($args->{ recipient_limit }    || 1000);
+    $me->set_smtp_pipelining_window($args->{ pipelining_window });
+    $me->set_smtp_max_concurrency($args->{ max_concurrency });
     $me->set_smtp_default_timeout($args->{ default_io_timeout } || 10);
     $me->_set_queue_directory($args->{ queue_dir } || '');
 
@@ -181,6 +185,40 @@ sub _send_command
 }
 
 
+# Descriptions: send (SMTP/LMTP) commands to BSD socket at once
+#               without waiting for each reply (RFC2920 PIPELINING).
+#    Arguments: OBJ($self) ARRAY_REF($commands)
+# Side Effects: update log file by smtplog.
+#               set _last_command to the last one.
+#               set $SMTP_ERR_IO as status if we cannot write.
+# Return Value: NUM(1 or 0)
+sub _send_commands
+{
+    my ($self, $commands) = @_;
+    my $socket = $self->get_socket() || undef;
+    my $buf    = '';
+
+    for my $command (@$commands) {
+	$self->smtplog($command."\r\n");
+	$buf .= $command."\r\n";
+    }
+    $self->set_last_command($commands->[ $#$commands ]);
+    $self->set_send_command_status('');
+
+    if (defined $socket) {
+	return 1 if $socket->print($buf);
+	$self->logerror("_send_commands: cannot write: $!");
+    }
+    else {
+	$self->logerror("_send_commands: undefined socket");
+    }
+
+    $self->set_send_command_status($SMTP_ERR_IO);
+    $self->set_error("cannot send commands");
+    return 0;
+}
+
+
 # Descriptions: receive a reply for a (SMTP/LMTP) command.
 #    Arguments: OBJ($self)
 # Side Effects: update log file by smtplog.
@@ -257,10 +295,12 @@ sub _read_reply
     }
     elsif ($@ =~ /$id socket timeout/) {
 	my $command = $self->get_last_command();
+	$self->set_send_command_status($SMTP_ERR_IO);
 	$self->logerror("smtp reply for \"$command\" is timeout");
 	$self->set_error("smtp reply for \"$command\" is timeout");
     }
     elsif ($@) {
+	$self->set_send_command_status($SMTP_ERR_IO);
 	$self->logerror($@);
 	$self->set_error($@);
     }
@@ -344,6 +384,8 @@ You can specify the following parameter at C<$args> HASH REFERENCE.
     smtp_sender        sender's mail address
     recipient_maps     $recipient_maps
     recipient_limit    recipients in one SMTP transactions
+    pipelining_window  RCPT TO commands sent at once
+    max_concurrency    SMTP transactions run at once
     header             FML::Header object
     body               Mail::Message object
 
@@ -374,6 +416,25 @@ C<recipient_limit> is the max number of recipients in one SMTP
 transaction. 1000 by default,
 which corresponds to the limit by C<Postfix>.
 
+C<pipelining_window> is the number of C<RCPT TO> commands sent at
+once without waiting for each reply, when the MTA advertises
+C<PIPELINING> (RFC2920) in the EHLO reply. The replies are read
+after each window in the same order. 100 by default, and 0 disables
+pipelining.
+
+C<max_concurrency> is the number of SMTP transactions run at once.
+1 by default.
+If it is more than 1 and the recipients do not fit within one
+transaction, they are split into C<max_concurrency> partitions and
+each partition is delivered by a forked process over its own
+connection. Each process starts from a different MTA in
+C<smtp_servers> and, as usual, tries the others and falls back into
+the queue for its own recipients on errors.
+If a process dies before it finishes, the parent process queues the
+recipients which the process has neither delivered nor queued.
+Logs of the processes are written by the parent process.
+A deferred queue (retry) is delivered in one process.
+
 C<header> is an C<FML::Header> object.
 
 C<body> is a C<Mail::Message> object.
@@ -403,9 +464,21 @@ sub deliver
     # smtp_recipient_limit: maximum recipients in one smtp session.
     #      default_timeout: basic timeout parameter for smtp session
     $self->set_smtp_recipient_limit($args->{ recipient_limit }    || 1000);
+    $self->set_smtp_pipelining_window($args->{ pipelining_window });
+    $self->set_smtp_max_concurrency($args->{ max_concurrency });
     $self->set_smtp_default_timeout($args->{ default_io_timeout } || 10);
     $self->_set_queue_directory($args->{ queue_dir } || '');
 
+    # split recipients into partitions delivered by forked workers.
+    if ($self->get_smtp_max_concurrency() > 1 && ! $self->{ _is_worker }) {
+	my $partitions = $self->_get_recipient_partitions($args);
+	if ($#$partitions > 0) {
+	    $self->_deliver_concurrently($args, $partitions);
+	    $self->_log_delivery_summary($args, $self->_get_map_list($args));
+	    return;
+	}
+    }
+
     # temporary hash to check whether the map/mta is used already.
     my %used_mta   = ();
     my %used_map   = ();
@@ -543,6 +616,21 @@ sub deliver
     # CAUTION: this mapinfo tracks the delivery status.
     $self->clear_mapinfo;
 
+    # a worker reports the total to the parent, which logs it.
+    unless ($self->{ _is_worker }) {
+	$self->_log_delivery_summary($args, $maps);
+    }
+}
+
+
+# Descriptions: log the total number of recipients delivered.
+#    Arguments: OBJ($self) HASH_REF($args) ARRAY_REF($maps)
+# Side Effects: none
+# Return Value: none
+sub _log_delivery_summary
+{
+    my ($self, $args, $maps) = @_;
+
     if ( $self->{ _num_recipients } ) {
 	my $n     = $self->{ _num_recipients };
 	my $queue = $args->{ queue } || undef;
@@ -562,6 +650,299 @@ sub deliver
 }
 
 
+############################################################
+#####
+##### concurrent delivery
+#####
+
+
+# Descriptions: read recipients in all maps and split them into
+#               smtp_max_concurrency partitions.
+#               return an empty list if the delivery should be done
+#               in this process as usual: the recipients fit within
+#               one SMTP transaction, or the map is a deferred queue
+#               which should be kept as it is if the retry fails.
+#    Arguments: OBJ($self) HASH_REF($args)
+# Side Effects: none
+# Return Value: ARRAY_REF(ARRAY_REF, ARRAY_REF, ...)
+sub _get_recipient_partitions
+{
+    my ($self, $args) = @_;
+    my $concurrency = $self->get_smtp_max_concurrency();
+    my $limit       = $self->get_smtp_recipient_limit();
+    my $queue       = $args->{ queue } || undef;
+    my $retry_count = defined $queue ? ($queue->get_retry_count() || 0) : 0;
+    my $maps        = $self->_get_map_list($args);
+    my (@rcpt)      = ();
+    my %used_map    = ();
+
+  MAP:
+    for my $map (@$maps) {
+	next MAP if $used_map{ $map }; $used_map{ $map } = 1;
+
+	if ($retry_count > 0 && $self->_is_map_in_queue($map)) {
+	    $self->logdebug("deliver the deferred queue in one process");
+	    return [];
+	}
+
+	use IO::Adapter;
+	my $obj = new IO::Adapter $map, $args->{ map_params };
+	unless (defined $obj && $obj->open) {
+	    $self->logerror("cannot open and ignore $map");
+	    next MAP;
+	}
+
+	my $rcpt;
+	while (defined ($rcpt = $obj->get_next_key)) {
+	    push(@rcpt, $rcpt);
+	}
+	$obj->close;
+    }
+
+    # one transaction is enough.
+    return [] if $#rcpt < $limit;
+
+    my $size       = int(($#rcpt + $concurrency) / $concurrency);
+    my $partitions = [];
+    while (@rcpt) {
+	push(@$partitions, [ splice(@rcpt, 0, $size) ]);
+    }
+
+    $self->logdebug(sprintf("%d partitions of %d recipients",
+			    $#$partitions + 1, $size));
+    return $partitions;
+}
+
+
+# Descriptions: deliver each partition by a forked worker at once.
+#               The MTA list is rotated for each worker so that
+#               the workers are spread over MTA's (or open several
+#               connections to the only one MTA).
+#               A worker runs deliver() with its partition as
+#               recipient_array, so it retries the other MTA's and
+#               falls back into the queue for its own recipients.
+#               Logs and the result come back through a pipe and
+#               are written here to keep log files in one process.
+#    Arguments: OBJ($self) HASH_REF($args) ARRAY_REF($partitions)
+# Side Effects: fork(2)
+#               update the total number of recipients in $self.
+# Return Value: none
+sub _deliver_concurrently
+{
+    my ($self, $args, $partitions) = @_;
+    my $mta      = $self->_get_mta_list($args);
+    my $n_worker = 0;
+    my %worker   = ();
+
+    use IO::Select;
+    my $select = new IO::Select;
+
+  PARTITION:
+    for my $partition (@$partitions) {
+	my $k = $n_worker++ % ($#$mta + 1);
+	my (@mta) = (@$mta[ $k .. $#$mta ], @$mta[ 0 .. $k - 1 ]);
+	my $worker_args = {
+	    %$args,
+	    smtp_servers    => join(" ", @mta),
+	    recipient_maps  => '',
+	    recipient_array => $partition,
+	};
+
+	my ($rh, $wh);
+	my $pid = pipe($rh, $wh) ? fork() : undef;
+	unless (defined $pid) {
+	    $self->logerror("cannot fork: $!, deliver partition $n_worker here");
+	    close($rh) if defined $rh;
+	    close($wh) if defined $wh;
+
+	    my $result = $self->_deliver_partition($worker_args);
+	    $self->{ _num_recipients } += $result->{ total };
+	    $self->set_error($result->{ error }) if $result->{ error };
+	    next PARTITION;
+	}
+	elsif ($pid == 0) {
+	    close($rh);
+	    $self->_run_worker($worker_args, $wh);
+	}
+
+	close($wh);
+	$self->logdebug("worker pid=$pid for partition $n_worker");
+	$worker{ fileno($rh) } = {
+	    pid       => $pid,
+	    buf       => '',
+	    smtplog   => '',
+	    done      => 0,
+	    rcpt      => $partition,
+	    confirmed => 0,
+	};
+	$select->add($rh);
+    }
+
+    # collect logs and results until all workers close the pipe.
+    while ($select->count()) {
+      WORKER:
+	for my $rh ($select->can_read()) {
+	    my $w = $worker{ fileno($rh) };
+	    my $n = sysread($rh, $w->{ buf }, 65536, length $w->{ buf });
+	    next WORKER if (! defined $n) && $!{ EINTR };
+
+	    $self->_read_worker_records($w);
+
+	    unless ($n) {
+		$select->remove($rh);
+		close($rh);
+	    }
+	}
+    }
+
+    for my $w (values %worker) {
+	waitpid($w->{ pid }, 0);
+	my $status = $?;
+
+	# smtp transaction log of each worker in one piece.
+	$self->smtplog($w->{ smtplog }) if length $w->{ smtplog };
+
+	$self->{ _num_recipients } += $w->{ total } || 0;
+	if ($w->{ error }) {
+	    $self->set_error($w->{ error });
+	}
+	unless ($w->{ done } && $status == 0) {
+	    $self->logerror("worker pid=$w->{ pid } exited abnormally");
+	    $self->set_error("smtp worker exited abnormally");
+	    $self->_fallback_worker_recipients($args, $w);
+	}
+    }
+}
+
+
+# Descriptions: queue recipients of the failed worker $w which are
+#               neither delivered nor queued by the worker itself.
+#               The worker reports the number of recipients from the
+#               head of its partition confirmed so far.
+#    Arguments: OBJ($self) HASH_REF($args) HASH_REF($w)
+# Side Effects: add the recipients into mail queue for later delivery.
+# Return Value: none
+sub _fallback_worker_recipients
+{
+    my ($self, $args, $w) = @_;
+    my $rcpt      = $w->{ rcpt };
+    my $confirmed = $w->{ confirmed } || 0;
+
+    return if $confirmed > $#$rcpt;
+
+    my $map = [ @$rcpt[ $confirmed .. $#$rcpt ] ];
+    $self->logerror(sprintf("worker pid=%d left %d recipients",
+			    $w->{ pid }, $#$map + 1));
+    $self->_fallback_into_queue($args, $map, "worker exited abnormally");
+}
+
+
+# Descriptions: parse records from a worker in $w->{ buf }.
+#               a record is "TYPE LENGTH\n" followed by LENGTH bytes.
+#    Arguments: OBJ($self) HASH_REF($w)
+# Side Effects: log and update $w.
+# Return Value: none
+sub _read_worker_records
+{
+    my ($self, $w) = @_;
+
+  RECORD:
+    while ($w->{ buf } =~ /^(\w+) (\d+)\n/) {
+	my ($type, $len) = ($1, $2);
+	my $start = length($type) + length($len) + 2;
+	last RECORD if length($w->{ buf }) < $start + $len;
+
+	my $data = substr($w->{ buf }, $start, $len);
+	substr($w->{ buf }, 0, $start + $len) = '';
+
+	if    ($type eq 'log')      { $self->log($data);}
+	elsif ($type eq 'logerror') { $self->logerror($data);}
+	elsif ($type eq 'logdebug') { $self->logdebug($data);}
+	elsif ($type eq 'smtplog')  { $w->{ smtplog } .= $data;}
+	elsif ($type eq 'total')    { $w->{ total } = $data;}
+	elsif ($type eq 'error')    { $w->{ error } = $data;}
+	elsif ($type eq 'confirmed') { $w->{ confirmed } = $data;}
+	elsif ($type eq 'done')     { $w->{ done }  = 1;}
+    }
+}
+
+
+# Descriptions: worker process main: deliver the partition and report
+#               logs and the result to $wh.
+#               we exit by POSIX::_exit() not to run destructors of
+#               objects (e.g. queue, lock) shared with the parent.
+#    Arguments: OBJ($self) HASH_REF($args) HANDLE($wh)
+# Side Effects: exit
+# Return Value: none
+sub _run_worker
+{
+    my ($self, $args, $wh) = @_;
+
+    binmode($wh);
+    my $send = sub {
+	my ($type, $data) = @_;
+	$data = '' unless defined $data;
+	utf8::encode($data) if utf8::is_utf8($data);
+	print $wh $type, " ", length($data), "\n", $data;
+    };
+
+    $self->{ _worker_send } = $send;
+    $self->set_log_info_function(sub { &$send('log', $_[0]);});
+    $self->set_log_error_function(sub { &$send('logerror', $_[0]);});
+    $self->set_log_debug_function(sub { &$send('logdebug', $_[0]);});
+    $self->set_smtp_log_function(sub { &$send('smtplog', join('', @_));});
+    $self->set_smtp_log_handle(undef);
+
+    my $result = $self->_deliver_partition($args);
+    &$send('total', $result->{ total });
+    &$send('error', $result->{ error }) if $result->{ error };
+    &$send('done', '');
+    close($wh);
+
+    POSIX::_exit(0);
+}
+
+
+# Descriptions: tell the parent that the first $n recipients of the
+#               partition are delivered or queued.
+#               do nothing unless we are a forked worker.
+#    Arguments: OBJ($self) NUM($n)
+# Side Effects: none
+# Return Value: none
+sub _worker_confirm
+{
+    my ($self, $n) = @_;
+    my $send = $self->{ _worker_send } || undef;
+
+    &$send('confirmed', $n) if defined $send;
+}
+
+
+# Descriptions: deliver one partition by deliver() in this process.
+#    Arguments: OBJ($self) HASH_REF($args)
+# Side Effects: none
+# Return Value: HASH_REF
+sub _deliver_partition
+{
+    my ($self, $args) = @_;
+
+    local $self->{ _is_worker }      = 1;
+    local $self->{ _num_recipients } = 0;
+
+    $self->clear_error;
+    eval { $self->deliver($args);};
+    if ($@) {
+	$self->logerror("worker: $@");
+	$self->set_error($@);
+    }
+
+    return {
+	total => $self->{ _num_recipients } || 0,
+	error => $self->error || '',
+    };
+}
+
+
 # Descriptions: check if this loop should stop or not.
 #    Arguments: OBJ($self) NUM($count) NUM($limit)
 # Side Effects: none
@@ -698,6 +1079,7 @@ sub _fallback_into_queue
 	    };
 	    unless ($@) {
 		$self->log("fallback: total=$rcpt_total qid=$qid");
+		$self->_worker_confirm($pos + $rcpt_total);
 	    }
 	    else {
 		$self->logerror("fallback error: $@");
@@ -831,6 +1213,9 @@ sub _deliver
     }
 
     # o.k. succeded to deliver.
+    # recipients up to the current position of the map are done.
+    $self->_worker_confirm($self->get_map_position($self->get_target_map));
+
     my $n = $self->{ _num_recipients_in_this_transaction } || 0;
     if ($n) {
 	my $mta = $args->{ mta } || 'unknown';
@@ -851,6 +1236,9 @@ sub _init_delivery_transaction
 
     $self->set_last_command('');
     $self->set_status_code('');
+
+    # EHLO reply of this MTA sets them again.
+    delete $self->{ _attr };
 }
 
 
@@ -1000,6 +1388,13 @@ sub _send_recipient_list_by_recipient_map
     # address validate function.
     my $fp_address_validate = $self->get_address_validate_function();
 
+    # RCPT TO commands sent at once if the MTA supports PIPELINING.
+    my $window_size = 1;
+    my $window      = [];
+    if (($self->_get_attribute("use_pipelining") || '') eq 'yes') {
+	$window_size = $self->get_smtp_pipelining_window() || 1;
+    }
+
     # XXX $obj->get_recipient returns a mail address.
   RCPT_INPUT:
     while (defined ($rcpt = $obj->get_next_key)) {
@@ -1021,18 +1416,21 @@ sub _send_recipient_list_by_recipient_map
 
 	$num_recipients++;
 
-	$self->_send_command("RCPT TO:<$rcpt>");
-	$self->_read_reply;
+	push(@$window, $rcpt);
+	if (@$window >= $window_size) {
+	    my $ok = $self->_send_recipient_window($window);
+	    $window = [];
 
-	# save addresses to retry later.
-	my $action = $self->get_send_command_status();
-	if ($action eq $SMTP_ERR_RETRY) {
-	    # XXX-TODO: actual code required.
-	    $self->{ _retry_recipient_table }->{ $rcpt } = $SMTP_ERR_RETRY;
+	    # give up the pipelined window when the connection is lost.
+	    # without pipelining, try each recipient as before.
+	    last RCPT_INPUT if ! $ok && $window_size > 1;
 	}
 
 	last RCPT_INPUT if $num_recipients >= $recipient_limit;
     }
+    if (@$window) {
+	$self->_send_recipient_window($window);
+    }
 
     # save the current position in the file handle
     $self->set_map_position($map, $obj->getpos);
@@ -1056,6 +1454,49 @@ sub _send_recipient_list_by_recipient_map
 }
 
 
+# Descriptions: send "RCPT TO:<recipient>" for each recipient in
+#               $window and read the replies in the same order.
+#               If $window has more than one recipient, the commands
+#               are sent at once (RFC2920 PIPELINING).
+#    Arguments: OBJ($self) ARRAY_REF($window)
+# Side Effects: $self->{ _retry_recipient_table } has recipients which
+#               causes temporary errors.
+# Return Value: NUM(1 or 0, 0 if the connection is lost)
+sub _send_recipient_window
+{
+    my ($self, $window) = @_;
+
+    if ($#$window > 0) {
+	my (@commands) = map { "RCPT TO:<$_>" } @$window;
+	$self->_send_commands(\@commands) || return 0;
+    }
+    else {
+	$self->_send_command("RCPT TO:<$window->[0]>");
+    }
+
+  RCPT_REPLY:
+    for my $rcpt (@$window) {
+	# _read_reply() logs errors with the command replied to.
+	$self->set_last_command("RCPT TO:<$rcpt>");
+	$self->set_send_command_status('');
+	$self->_read_reply;
+
+	# save addresses to retry later.
+	my $action = $self->get_send_command_status();
+	if ($action eq $SMTP_ERR_RETRY) {
+	    # XXX-TODO: actual code required.
+	    $self->{ _retry_recipient_table }->{ $rcpt } = $SMTP_ERR_RETRY;
+	}
+	elsif ($action eq $SMTP_ERR_IO) {
+	    # the rest of replies never come.
+	    return 0;
+	}
+    }
+
+    return 1;
+}
+
+
 # Descriptions: send "RCPT TO:<recipient>" to MTA.
 #    Arguments: OBJ($self) HASH_REF($args)
 # Side Effects: none
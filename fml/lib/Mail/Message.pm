@@ -20,6 +20,13 @@ use Mail::Message::String;
 
 my $debug = 0;
 
+# print() writes the body by chunks of this size (cut at line ends).
+my $print_chunk_size = 65536;
+
+# parse() reads a pipe by chunks growing from the min to the max size.
+my $parse_chunk_min_size = 65536;
+my $parse_chunk_max_size = 4194304;
+
 # virtual content-type
 my %virtual_data_type =
     (
@@ -516,42 +523,29 @@ sub parse
 
 # Descriptions: cut off content into header and body
 #               and prepare buffer for further parsing
+#               The whole message is read into $self->{ __data } and
+#               the header is cut off from the head of it in place,
+#               so that the body is not copied.
 #    Arguments: OBJ($self) HANDLE($fd) HASH_REF($result)
 # Side Effects: fill in $inComingMessage on memory
 # Return Value: none
 sub _parse
 {
     my ($self, $fd, $result) = @_;
-    my ($header, $header_size, $p, $buf, $data);
-    my $total_buffer_size = 0;
-    my $is_header_found   = 0;
+    my ($header, $header_size, $p);
     my $data_ptr          = $self->{ __data };
+    my $total_buffer_size = $self->_read_message($fd, $data_ptr);
 
-  DATA:
-    while ($p = sysread($fd, $data, 1024)) {
-	$total_buffer_size += $p;
-	$buf               .= $data;
-
-	if (($p = index($buf, "\n\n", 0)) > 0) {
-	    $is_header_found = 1;
-	    $header          = substr($buf, 0, $p + 1);
-	    $header_size     = $p + 1;
-	    $$data_ptr       = substr($buf, $p + 2);
-	    last DATA;
-	}
-    }
-
-    if ($is_header_found) {
-	# extract mail body and put it to $$data_ptr
-      DATA:
-	while ($p = sysread($fd, $data, 1024)) {
-	    $total_buffer_size += $p;
-	    $$data_ptr         .= $data;
-	}
+    # the first "\n\n" at the head of the message is not the separator.
+    if (($p = index($$data_ptr, "\n\n", 0)) > 0) {
+	$header      = substr($$data_ptr, 0, $p + 1);
+	$header_size = $p + 1;
+	substr($$data_ptr, 0, $p + 2) = '';
     }
     else {
-	$header      = $buf;
+	$header      = $total_buffer_size ? $$data_ptr : undef;
 	$header_size = $total_buffer_size;
+	$$data_ptr   = '';
     }
 
     # read the message (mail body) from the incoming mail
@@ -573,6 +567,49 @@ sub _parse
 }
 
 
+# Descriptions: read the whole message from $fd into $$data_ptr.
+#               If $fd is a file, read the rest of it at once.
+#               Otherwise, read by chunks growing twice up to
+#               $parse_chunk_max_size.
+#    Arguments: OBJ($self) HANDLE($fd) STR_REF($data_ptr)
+# Side Effects: update $$data_ptr
+# Return Value: NUM(size read)
+sub _read_message
+{
+    my ($self, $fd, $data_ptr) = @_;
+    my $size  = 0;
+    my $chunk = $parse_chunk_min_size;
+    my $grow  = 1;
+    my $p;
+
+    # file: the size hint by fstat(2).
+    if (-f $fd) {
+	my $rest = (-s _) - (sysseek($fd, 0, 1) || 0);
+	$chunk   = $rest + 1 if $rest >= $chunk;
+	$grow    = 0;
+    }
+
+    $$data_ptr = '' unless defined $$data_ptr;
+
+  DATA:
+    while ($p = sysread($fd, $$data_ptr, $chunk, length($$data_ptr))) {
+	$size += $p;
+
+	# file: the rest is expected to be EOF.
+	unless ($grow) {
+	    $chunk = $parse_chunk_min_size;
+	    next DATA;
+	}
+
+	if ($chunk < $parse_chunk_max_size) {
+	    $chunk *= 2;
+	}
+    }
+
+    return $size;
+}
+
+
 # Descriptions: return ARRAY_REF for header for further parsing.
 #               get reverse_path if possible.
 #    Arguments: OBJ($self) HASH_REF($r)
@@ -584,8 +621,8 @@ sub _parse_header
 
     # parse the header
     if (defined $r->{ header }) {
-	my (@h) = split(/\n/, $r->{ header });
-	for my $x (@h) { $x .= "\n";}
+	my (@h) = split(/^/, $r->{ header });
+	$h[ $#h ] .= "\n" if @h && $h[ $#h ] !~ /\n$/o;
 
 	# save unix-from (mail-from) in PCB and remove it in the header
 	if ($h[0] =~ /^From\s/o) {
@@ -1340,59 +1377,46 @@ sub _print_messsage_on_memory
     return if ($type eq 'text/rfc822-headers') && $self->_is_head_message();
 
 
-    # 2. print content body: write each line in buffer
-    my ($p, $len, $buf, $pbuf);
+    # 2. print content body: write lines in buffer by chunks.
     my $maxlen = length($$data);
     if ($debug > 1) {
 	my $r = substr($$data, $pp, $p_end - $pp);
 	print STDERR "output($pp, $p_end) = {$r}\n";
     }
 
-  SMTP_IO:
-    while (1) {
-	$p = index($$data, "\n", $pp);
-	print STDERR "try to print(p=$p pp=$pp < $p_end)\n" if $debug > 1;
-
-	# handle buffer (MIME part) without trailing "\n".
-	# index("\n") can pick up both
-	#     the last "\n" of the MIME part
-	# and
-	#     "\n" of MIME delimiter string "CRLF delimiter"
-	# since index() searches the whole not a part of the mail.
-	# We need to identify these two cases restrictly.
-	last SMTP_IO if $p == $p_end && substr($$data, $p-1, 1) eq "\n";
-	last SMTP_IO if $p > $p_end;
-
-	$len = $p - $pp + 1;
-
-	# handle buffer wihtout trailing "\n"
-	if ($p == $p_end && substr($$data, $p-1, 1) ne "\n") {
-	    $len = $p_end - $pp;
-	}
-	else {
-	    $len = ($p < 0 ? ($maxlen - $pp) : $len);
-	}
-	$buf = substr($$data, $pp, $len);
+    # lines ending with "\n" within [$pp, $p_end).
+    my $p_lines = $p_end > $pp ? rindex($$data, "\n", $p_end - 1) + 1 : $pp;
+    $p_lines    = $pp if $p_lines < $pp;
 
-	if ($debug > 1) {
-	    print STDERR "	\$len = $p - $pp + 1;\n";
-	    print STDERR "	$len = ($p < 0 ? ($maxlen - $pp) : $len);\n";
-	    print STDERR "print($pp,$len){$buf}\n";
-	}
-
-	# do nothing, get away from here
-	last SMTP_IO if $len == 0;
+    # handle buffer (MIME part) without trailing "\n".
+    # "\n" just at $p_end is the one of MIME delimiter string
+    # "CRLF delimiter", so the last line ends at $p_end.
+    # If no "\n" follows, the last line ends at the end of the buffer.
+    my $p_tail = $p_lines;
+    if ($p_lines < $p_end) {
+	my $p = index($$data, "\n", $p_lines);
+	$p_tail = $p_end  if $p == $p_end;
+	$p_tail = $maxlen if $p < 0;
+    }
+    elsif (index($$data, "\n", $p_lines) < 0) {
+	$p_tail = $maxlen;
+    }
 
-	unless (defined $raw_print_mode) {
-	    # fix \n -> \r\n in the end of the line
-	    if ($buf !~ /\r\n$/) { $buf =~ s/\n$/\r\n/;}
+  SMTP_IO:
+    while ($pp < $p_tail) {
+	my $len = $p_tail - $pp;
 
-	    # ^. -> ..
-	    $buf =~ s/^\./../;
+	# cut the chunk at the end of a line.
+	if ($len > $print_chunk_size) {
+	    my $p = index($$data, "\n", $pp + $print_chunk_size - 1);
+	    $len  = $p - $pp + 1 if $p >= 0 && $p < $p_tail;
 	}
 
+	my $buf = substr($$data, $pp, $len);
+	_smtp_encode(\$buf) unless defined $raw_print_mode;
+
 	if ($debug > 1) {
-	    print STDERR "===> print($buf);\n";
+	    print STDERR "===> print($pp,$len){$buf};\n";
 	}
 
 	print $fd $buf;
@@ -1402,8 +1426,7 @@ sub _print_messsage_on_memory
 	    $write_count += length($buf);
 	}
 
-	last SMTP_IO if $p < 0;
-	$pp = $p + 1;
+	$pp += $len;
     }
 
     $self->_set_write_count($write_count);
@@ -1450,15 +1473,15 @@ sub _print_messsage_on_disk
 	my $buf;
 
       SMTP_IO:
-	while ($buf = <$fh>) {
-	    unless (defined $raw_print_mode) {
-		# fix \n -> \r\n in the end of the line
-		if ($buf !~ /\r\n$/) { $buf =~ s/\n$/\r\n/;}
-
-		# ^. -> ..
-		$buf =~ s/^\./../;
+	while (read($fh, $buf, $print_chunk_size)) {
+	    # complete the last line in the chunk.
+	    if ($buf !~ /\n$/) {
+		my $rest = <$fh>;
+		$buf .= $rest if defined $rest;
 	    }
 
+	    _smtp_encode(\$buf) unless defined $raw_print_mode;
+
 	    print $fd $buf;
 	    &$logfp($buf) if $logfp;
 
@@ -1476,6 +1499,22 @@ sub _print_messsage_on_disk
 }
 
 
+# Descriptions: convert lines in $$rbuf into SMTP wire form in place:
+#               fix "\n" -> "\r\n" in the end of each line and
+#               escape the leading "." of each line as "..".
+#               $$rbuf should begin at the head of a line.
+#    Arguments: STR_REF($rbuf)
+# Side Effects: update $$rbuf
+# Return Value: none
+sub _smtp_encode
+{
+    my ($rbuf) = @_;
+
+    $$rbuf =~ s/(?<!\r)\n/\r\n/g;
+    $$rbuf =~ s/^\./../mg;
+}
+
+
 # Descriptions: save length written.
 #    Arguments: OBJ($self) NUM($write_count)
 # Side Effects: update $self.
@@ -157,6 +157,7 @@ Please lock before use of this module.
 	db_base_dir  => '/var/spool/ml/@udb@/thread',
 	db_name      => 'elena',  # mailing list identifier
 	key          => 100,      # article sequence number
+	read_only    => 1,        # optional
     };
 
 In fml 8 case, Mail::Message::DB object is initialized for each ML
@@ -178,6 +179,10 @@ For example, this module creates/updates the following databases (e.g.
 Almost all tables use $key (article sequence number) as the primary
 key since it is unique in a mailing list articles.
 
+If C<read_only> is specified, databases are opened in read only mode
+and updates are ignored. Several processes can read databases at the
+same time in this mode.
+
     # key => filepath
     $article = {
 	100 => /var/spool/ml/elena/spool/100,
@@ -215,12 +220,14 @@ sub new
     set_db_name($me, $args->{ db_name }) if defined $args->{ db_name };
     set_key($me,     $args->{ key })     if defined $args->{ key };
 
+    # processes to read databases in parallel do not update them.
+    $me->{ _read_only } = $args->{ read_only } ? 1 : 0;
+
     # genearete @orig_header_fields based on @header_fields
-    @header_fields = sort keys %header_field_type;
-    for my $hdr (@header_fields) {
-	push(@orig_header_fields,    "orig_$hdr");
-	push(@article_header_fields, "article_$hdr");
-    }
+    # XXX not push() since new() is called for each article.
+    @header_fields         = sort keys %header_field_type;
+    @orig_header_fields    = map { "orig_$_"    } @header_fields;
+    @article_header_fields = map { "article_$_" } @header_fields;
 
     return bless $me, $type;
 }
@@ -1003,7 +1010,7 @@ sub open
 sub close
 {
     my ($self, $args) = @_;
-    $self->_db_open($args);
+    $self->_db_close($args);
 }
 
 
@@ -1041,6 +1048,7 @@ sub _db_open
     my $db_type   = $self->get_db_module_class();
     my $db_dir    = $self->get_db_base_dir();
     my $file_mode = $self->{ _file_mode } || 0644;
+    my $flags     = $self->{ _read_only } ? 'O_RDONLY' : 'O_RDWR|O_CREAT';
 
     _PRINT_DEBUG("_db_open( type = $db_type )");
 
@@ -1051,7 +1059,7 @@ sub _db_open
 	    $file = File::Spec->catfile($db_dir, $db);
 	    $str  = qq{
 		my \%$db = ();
-		tie \%$db, \$db_type, \$file, O_RDWR|O_CREAT, $file_mode;
+		tie \%$db, \$db_type, \$file, $flags, $file_mode;
 		\$self->{ _db }->{ '_$db' } = \\\%$db;
 		\$self->{ _db_opened }->{ '_$db' } = 1;
 	    };
@@ -1165,6 +1173,11 @@ sub _db_set
 {
     my ($self, $db, $table, $key, $value) = @_;
 
+    if ($self->{ _read_only }) {
+	_PRINT_DEBUG("_db_set: read only, ignore { $key => $value }");
+	return;
+    }
+
     if (defined $value && $value && defined $key && $key) {
 	unless ($self->{ _db_opened }->{ "_$table" }) {
 	    $self->_db_open( { table => $table } );
@@ -1196,17 +1209,17 @@ sub _db_get
     }
 
     unless ($v) {
-	if ($self->{ _db_opened }->{ "_$table" }) {
+	unless ($self->{ _db_opened }->{ "_$table" }) {
 	    $self->_db_open( { table => $table } );
 	}
 
-	if ($is_demand_copying) {
+	if ($is_demand_copying && ! $self->{ _read_only }) {
 	    _PRINT_DEBUG("_old_db_copyin(\$db, $table, $key)");
 	    $self->_old_db_copyin($db, $table, $key);
 	}
 	$v = $db->{ "_$table" }->{ $key } || '';
 
-	unless ($v) {
+	unless ($v || $self->{ _read_only }) {
 	    $db->{ "_$table" }->{ $key } = $NULL_VALUE;
 	}
     }
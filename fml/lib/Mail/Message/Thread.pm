@@ -78,6 +78,9 @@ sub _init_db
 
 	# old db_dir in non UDB age: ~fml/public_html/.../elena/
 	old_db_base_dir => $args->{ output_dir },
+
+	# worker processes of Mail::Message::ToHTML only read databases.
+	read_only       => $args->{ db_read_only },
     };
 
     # Firstly, prepare db object.
@@ -1360,9 +1360,64 @@ sub evaluate_safe_footer
 
 update index.html.
 
+Each index is rewritten when an article arrives, but the C<< <LI> >>
+entries already in the old index are copied as they are. Only the
+entries for new articles are created from the database. The old
+entries are reused only if the index is created in the same charset
+and address mask style. Remove the index to create it from scratch.
+The entries are kept on memory only while the index is rewritten.
+
 =cut
 
 
+# Descriptions: return the comment to identify the style of <LI> entries.
+#    Arguments: OBJ($self)
+# Side Effects: none
+# Return Value: STR
+sub _index_fragment_signature
+{
+    my ($self) = @_;
+    my $charset = $self->{ _charset };
+    my $mask    = $self->{ _use_address_mask };
+    my $type    = $self->{ _address_mask_type };
+
+    return "<!-- LI style=$versionid/$charset/$mask/$type -->\n";
+}
+
+
+# Descriptions: save <LI> entries in the $file on memory to reuse them
+#               while $file is rewritten.
+#    Arguments: OBJ($self) STR($file)
+# Side Effects: update $self->{ _index_fragment }
+# Return Value: none
+sub _index_fragment_load
+{
+    my ($self, $file) = @_;
+    my $fragment  = $self->{ _index_fragment }->{ $file } = {};
+    my $signature = $self->_index_fragment_signature();
+
+    $self->{ _index_fragment_file } = $file;
+
+    use FileHandle;
+    my $rh = new FileHandle $file;
+    return unless defined $rh;
+
+    my $buf = '';
+    {
+	local($/) = undef;
+	$buf = <$rh>;
+	$rh->close;
+    }
+
+    return unless defined $buf;
+    return unless index($buf, $signature) >= 0;
+
+    while ($buf =~ /(<!-- LI id=(\d+) -->\n.*?\n<\/A>\n)/gs) {
+	$fragment->{ $2 } = $1 unless defined $fragment->{ $2 };
+    }
+}
+
+
 # Descriptions: print navigation bar et.al. at upper half of indexes
 #    Arguments: OBJ($self) HASH_REF($args)
 # Side Effects: create $new html
@@ -1377,6 +1432,9 @@ sub _print_index_begin
 
     my $mask = umask();
 
+    # <LI> entries in the old index are reused.
+    $self->_index_fragment_load($old);
+
     umask(022);
 
     use FileHandle;
@@ -1384,6 +1442,7 @@ sub _print_index_begin
     $args->{ wh } = $wh;
 
     $self->html_start($wh, { title => $title });
+    print $wh $self->_index_fragment_signature();
 
     _print_raw_str($wh, _format_index_navigator(), $code);
     $self->mhl_separator($wh);
@@ -1413,6 +1472,10 @@ sub _print_index_end
 
     $self->html_end($wh);
 
+    # <LI> entries of $old are no longer used.
+    delete $self->{ _index_fragment }->{ $old };
+    delete $self->{ _index_fragment_file };
+
     unless (rename($new, $old)) {
 	croak("rename($new, $old) fail\n");
     }
@@ -1994,6 +2057,23 @@ sub _print_raw_str
 }
 
 
+# Descriptions: return $str converted to $code
+#    Arguments: STR($str) STR($code)
+# Side Effects: none
+# Return Value: STR
+sub _sprintf_raw_str
+{
+    my ($str, $code) = @_;
+
+    # XXX-TODO: euc-jp is hard-coded.
+    if (defined($str) && $str) {
+	$str = __nc_convert($str, $code || 'euc');
+    }
+
+    return $str;
+}
+
+
 # Descriptions: print safe $str to $wh channel
 #               XXX text2html($str, urls => 1, pre => 0)
 #    Arguments: HANDLE($wh) STR($str) STR($code)
@@ -2042,7 +2122,7 @@ sub _sprintf_safe_str
 }
 
 
-# Descriptions: return safe $str modified by text2html().
+# Descriptions: return safe $str modified by __text2html().
 #               $str language code is modified by Mail::Message::Encode.
 #    Arguments: NUM($attr_pre) HANDLE($wh) STR($str) STR($code)
 # Side Effects: none
@@ -2059,19 +2139,15 @@ sub __sprintf_safe_str
     }
 
     if (defined $str) {
-	# $url$trailor => $url $trailor for text2html() incomplete regexp
-	$str =~ s#(http://[^\s\<\>\'\"]+[\w\d/])#_separete_url($1)#ge;
-
-	use HTML::FromText;
 	# NOT CONVERT subject tag (see fml-devel:726).
-	if ($str =~ /^\s*($regexp)(.*)/) {
+	if ($regexp && $str =~ /^\s*($regexp)(.*)/s) {
 	    my ($tag, $post) = ($1, $2);
-	    my $tag_s  = text2html($tag,  urls => 0, pre => $attr_pre);
-	    my $post_s = text2html($post, urls => 1, pre => $attr_pre);
+	    my $tag_s  = __text2html($tag,  0, $attr_pre);
+	    my $post_s = __text2html($post, 1, $attr_pre);
 	    return sprintf("%s%s", $tag_s, $post_s);
 	}
 	else {
-	    return text2html($str, urls => 1, pre => $attr_pre);
+	    return __text2html($str, 1, $attr_pre);
 	}
     }
     else {
@@ -2080,38 +2156,63 @@ sub __sprintf_safe_str
 }
 
 
-# Descriptions: extract URL syntax in $url string.
-#               $url$trailor => $url $trailor for text2html()
-#               XXX incomplete regexp, we should correct it.
-#    Arguments: STR($url)
+# HTML entities for ASCII characters, which text2html() escapes.
+my %html_entity = ();
+
+
+# Descriptions: escape HTML metacharacters and make URLs links in $str.
+#               This is same as text2html($str, urls => $urls, pre => $pre)
+#               of HTML::FromText for ASCII, but scans $str only once and
+#               keeps multibyte characters in ISO-2022-JP, EUC-JP and
+#               UTF-8 as they are. Also, "http://..." is followed by
+#               a space as fml 4.0 did (_separete_url() before).
+#    Arguments: STR($str) NUM($urls) NUM($pre)
 # Side Effects: none
-#      History: based on fml 4.0-current (2001/10/28)
 # Return Value: STR
-sub _separete_url
+sub __text2html
 {
-    my ($url) = @_;
-    my ($re_euc_c) = '[\241-\376][\241-\376]';
-    my ($re_euc_s)  = "($re_euc_c)+";
-    my $trailor = '';
+    my ($str, $urls, $pre) = @_;
 
-    # remove prepended/appended EUC strings
-    if ($url =~ /($re_euc_s)+$/) {
-        $trailor = $1;
-        $url     =~ s/$trailor//;
+    unless (%html_entity) {
+	use HTML::EntitiesLite;
+	for my $c (map { chr($_) } (0 .. 127)) {
+	    next unless $c =~ /[^\n\r\t !\#\$%\(-;=?-~]/;
+	    $html_entity{ $c } = encode_entities($c);
+	}
     }
 
-    # incomplete but may be effective ?
-    # RFC2068 says these special char's are not used.
-    # we should not include these char's in URL.
-    # reserved       = ";" | "/" | "?" | ":" | "@" | "&" | "=" | "+"
-    # unsafe         = CTL | SP | <"> | "#" | "%" | "<" | ">"
-    if ($url =~ /(\&\w{2}\;|\;|\?|\:|\@|\&|\=|\+|\#|\%|\<|\>|\")+$/) {
-        my $pat  = $1;
-        $trailor = $pat . $trailor;
-        $url     =~ s/${pat}$//;
-    }
+    # text2html() expands tabs and removes trailing newlines.
+    $str =~ s/\n+\z//;
+    if ($str =~ /\t/) {
+	use Text::Tabs;
+	$str = join("\n", expand(split(/\n/, $str)));
+    }
+
+    use HTML::FromText;
+    my $protocols = $HTML::FromText::PROTOCOLS;
+    my ($link, $x);
+    $str =~ s{
+	(\e(?:\$[\@B][^\e\n]*(?:\e\([BJ])?|\([BJ]))  # ISO-2022-JP
+      | ([\x80-\xff]+)                                # EUC-JP, UTF-8
+      | (\bhttp://[^\s<>'"\x80-\xff\e]+[\w/])          # http:// link
+      | (http://[^\s<>'"\x80-\xff\e]+[\w/])            # not link
+      | \b((?:$protocols):[^\s\x80-\xff\e]+[\w/])       # other links
+      | ([^\n\r\t !\#\$%\(-;=?-~\x80-\xff])            # metachars
+    }{
+	if    (defined $1) { $1;}
+	elsif (defined $2) { $2;}
+	elsif (defined $6) { $html_entity{ $6 };}
+	else {
+	    # http:// is followed by a space.
+	    ($link, $x) = defined $3 ? ($urls, "$3 ") :
+			  defined $4 ? (0,     "$4 ") : ($urls, $5);
+	    $x =~ s/([^\n\r\t !\#\$%\(-;=?-~])/$html_entity{ $1 }/g;
+	    $x =~ s/^(\S+)/<a href="$1" class="hft-urls">$1<\/a>/ if $link;
+	    $x;
+	}
+    }gex;
 
-    return "$url $trailor";
+    return $pre ? "<pre class=\"hft-pre\">$str</pre>" : $str;
 }
 
 
@@ -2184,12 +2285,32 @@ sub _print_end_of_ul
 
 
 # Descriptions: print <LI> filename ... with proper indentation
+#               reuse the fragment in the old index if found.
 #    Arguments: OBJ($self) HANDLE($wh) HASH_REF($db) NUM($id) STR($code)
 # Side Effects: none
 # Return Value: none
 sub _print_li_filename
 {
     my ($self, $wh, $db, $id, $code) = @_;
+    my $file     = $self->{ _index_fragment_file };
+    my $fragment = defined $file ? $self->{ _index_fragment }->{ $file } : {};
+
+    if (defined $fragment->{ $id }) {
+	print $wh $fragment->{ $id };
+    }
+    else {
+	print $wh $self->_sprintf_li_filename($db, $id, $code);
+    }
+}
+
+
+# Descriptions: return <LI> filename ... string
+#    Arguments: OBJ($self) HASH_REF($db) NUM($id) STR($code)
+# Side Effects: none
+# Return Value: STR
+sub _sprintf_li_filename
+{
+    my ($self, $db, $id, $code) = @_;
     my $filename = $db->get('html_filename', $id);
     my $subject  = $db->get('article_subject', $id) ||
 			$db->get('subject', $id) || "no subject";
@@ -2207,17 +2328,19 @@ sub _print_li_filename
     $main::opt_mimedecodequoted = $mimeopt;
 
     _PRINT_DEBUG("-- print_li_filename id=$id file=$filename");
-    
-    if (defined $filename && $filename) {
-	_print_raw_str($wh, "<!-- LI id=$id -->\n", $code);
 
-	_print_raw_str($wh, "<LI>\n", $code);
-	_print_raw_str($wh, "<A HREF=\"$filename\">\n", $code);
-	_print_safe_str($wh, $subject, $code);
-	_print_raw_str($wh, ",\n", $code);
-	_print_safe_str($wh, "$who\n", $code);
-	_print_raw_str($wh, "</A>\n", $code);
+    my $buf = '';
+    if (defined $filename && $filename) {
+	$buf .= _sprintf_raw_str("<!-- LI id=$id -->\n", $code);
+	$buf .= _sprintf_raw_str("<LI>\n", $code);
+	$buf .= _sprintf_raw_str("<A HREF=\"$filename\">\n", $code);
+	$buf .= _sprintf_safe_str($subject, $code) . "\n";
+	$buf .= _sprintf_raw_str(",\n", $code);
+	$buf .= _sprintf_safe_str("$who\n", $code) . "\n";
+	$buf .= _sprintf_raw_str("</A>\n", $code);
     }
+
+    return $buf;
 }
 
 
@@ -2300,7 +2423,10 @@ sub _convert
 sub __nc_convert
 {
     my ($str, $out_code, $in_code) = @_;
-    
+
+    # ASCII is same in all japanese codes. return it as it is.
+    return $str unless $str =~ /[\x80-\xff\e]/;
+
     use Mail::Message::Encode;
     my $encode = new Mail::Message::Encode;
     return $encode->convert($str, $out_code, $in_code);
@@ -2336,7 +2462,6 @@ sub htmlify_file
 {
     my ($self, $file, $args) = @_;
     my $dst_dir = $args->{ output_dir };
-    my $indexs = \@indexs;
 
     unless (-f $file) {
 	print STDERR "no such file: $file\n" if $debug;
@@ -2373,32 +2498,7 @@ sub htmlify_file
     _PRINT_DEBUG("-- msg_html_links");
     $html->update_msg_html_links( $id );
 
-    for my $index (@$indexs) {
-	if ($index eq "month") {
-	    _PRINT_DEBUG("-- monthly id index");
-	    $html->update_monthly_id_index({ id => $id });
-	}
-
-	if ($index eq "all") {
-	    _PRINT_DEBUG("-- id index");
-	    $html->update_id_index({ id => $id });
-	}
-
-	if ($index eq "thread") {
-	    _PRINT_DEBUG("-- thread index");
-	    $html->update_thread_index({ id => $id });
-	}
-
-	if ($index eq "month_thread") {
-	    _PRINT_DEBUG("-- month thread index");
-	    $html->update_monthly_thread_index({ id => $id });
-	}
-
-	if ($index eq "top") {
-	    _PRINT_DEBUG("-- top index");
-	    $html->create_top_index();
-	}
-    }
+    $html->_update_indexes( $id );
 
     # no more action for old files
     if ($html->is_ignore($id)) {
@@ -2423,6 +2523,7 @@ sub htmlify_dir
     my $min      = 0;
     my $max      = 0;
     my $has_fork = 1; # ok on unix and perl>5.6 on wine32.
+    my $workers  = 0;
 
     print STDERR "src = $src_dir\ndst = $dst_dir\n" if $debug;
 
@@ -2444,6 +2545,13 @@ sub htmlify_dir
     # overwride
     $has_fork = $args->{ has_fork } if defined $args->{ has_fork };
     $max      = $args->{ max }      if defined $args->{ max };
+    $workers  = $args->{ rebuild_workers } || 0;
+
+    if ($workers > 0) {
+	$workers = 1 unless $has_fork;
+	$self->_htmlify_dir_rebuild($src_dir, $min, $max, $workers, $args);
+	return;
+    }
 
     print STDERR "   scan ( $min .. $max ) for $src_dir\n" if $debug;
     for my $id ( $min .. $max ) {
@@ -2473,6 +2581,199 @@ sub htmlify_dir
 }
 
 
+=head2 rebuild mode of htmlify_dir($dir, $args)
+
+htmlify_dir() converts articles in the rebuild mode if
+C<rebuild_workers> is specified.
+
+    $args = {
+	directory       => "destination directory",
+	rebuild_workers => 4,
+    };
+
+The rebuild mode runs in three phases.
+
+1. the parent process analyzes all articles in order of the article
+id and saves their thread relation et.al. into the database.
+
+2. C<rebuild_workers> child processes convert the articles to HTML in
+parallel. Each child reads the database in read only mode. After all
+articles are converted, children write links to the previous and next
+articles into them in the same way. The links are written only once
+since the database is complete here.
+
+3. the parent process updates indexes once.
+
+Articles are converted one by one without fork() if C<has_fork> is 0.
+
+=cut
+
+
+# Descriptions: convert articles from $min to $max in $src_dir directory
+#               by $workers child processes and update indexes once.
+#    Arguments: OBJ($self) STR($src_dir) NUM($min) NUM($max)
+#               NUM($workers) HASH_REF($args)
+# Side Effects: update database, create html files and update indexes.
+# Return Value: none
+sub _htmlify_dir_rebuild
+{
+    my ($self, $src_dir, $min, $max, $workers, $args) = @_;
+    my (@idlist) = ();
+
+    # 1. analyze articles in order of id to build thread relation.
+    print STDERR "   analyze ( $min .. $max ) for $src_dir\n" if $debug;
+    for my $id ( $min .. $max ) {
+	use File::Spec;
+	my $file = File::Spec->catfile($src_dir, $id);
+	next unless -f $file && -s $file;
+
+	if ($self->_htmlify_dir_analyze($id, $file)) {
+	    push(@idlist, $id);
+	}
+    }
+    return unless @idlist;
+
+    # close databases to flush them before children open them.
+    $self->ndb()->close();
+
+    # 2. convert articles and then write links in parallel.
+    #    the links to the next articles need their html files.
+    print STDERR "   convert ( @idlist ) by $workers process(es)\n" if $debug;
+    my $_args = { %$args, db_read_only => 1 };
+    $self->_htmlify_dir_run_workers($workers, \@idlist, sub {
+	my ($list) = @_;
+	for my $id (@$list) {
+	    use File::Spec;
+	    my $file = File::Spec->catfile($src_dir, $id);
+	    my $html = new Mail::Message::ToHTML $_args;
+	    $html->htmlify_rfc822_message({ id => $id, src => $file });
+	}
+    });
+    $self->_htmlify_dir_run_workers($workers, \@idlist, sub {
+	my ($list) = @_;
+	my $html = new Mail::Message::ToHTML $_args;
+	for my $id (@$list) {
+	    $html->{ _debug_id } = $id;
+	    $html->_msg_file_rewrite_links($id);
+	}
+    });
+
+    # 3. update indexes once for all converted articles.
+    $self->{ _affected_idlist } = \@idlist;
+    $self->_update_indexes( $idlist[ $#idlist ] );
+}
+
+
+# Descriptions: save information of article $id into database.
+#    Arguments: OBJ($self) NUM($id) STR($file)
+# Side Effects: update database
+# Return Value: NUM(1 if $id should be converted, 0 if not)
+sub _htmlify_dir_analyze
+{
+    my ($self, $id, $file) = @_;
+
+    use Mail::Message;
+    use FileHandle;
+    my $rh  = new FileHandle $file;
+    return 0 unless defined $rh;
+
+    my $msg = Mail::Message->parse( { fd => $rh } );
+    $rh->close;
+
+    # html_filepath() needs the header to determine the subdirectory.
+    $self->{ _current_hdr } = $msg->whole_message_header;
+    my $dst = $self->html_filepath($id);
+    $self->cache_message_info($msg, { id  => $id,
+				      src => $file,
+				      dst => $dst,
+				  } );
+
+    return( (defined $dst && $dst && ! -f $dst) ? 1 : 0 );
+}
+
+
+# Descriptions: split $idlist into $workers lists and run $proc for
+#               each list in child processes in parallel.
+#               $proc runs in this process if $workers is 1.
+#    Arguments: OBJ($self) NUM($workers) ARRAY_REF($idlist) CODE_REF($proc)
+# Side Effects: fork(2) and wait(2) children.
+# Return Value: none
+sub _htmlify_dir_run_workers
+{
+    my ($self, $workers, $idlist, $proc) = @_;
+    my %pids = ();
+
+    if ($workers < 2) {
+	&$proc($idlist);
+	return;
+    }
+
+    for my $n ( 0 .. $workers - 1 ) {
+	my (@list) = @$idlist[ grep { $_ % $workers == $n } 0 .. $#$idlist ];
+	next unless @list;
+
+	my $pid = fork();
+	if (! defined($pid) || $pid < 0) {
+	    croak("cannot fork");
+	}
+	elsif ($pid == 0) {
+	    # the child must not return to the caller even if it fails.
+	    eval { &$proc(\@list);};
+	    if ($@) { warn($@); exit 1;}
+	    exit 0;
+	}
+
+	$pids{ $pid } = 1;
+    }
+
+    # parent
+    my $failed = 0;
+    for my $pid (keys %pids) {
+	waitpid($pid, 0);
+	$failed++ if $?;
+    }
+    croak("$failed htmlify worker(s) failed") if $failed;
+}
+
+
+# Descriptions: update indexes around $id.
+#    Arguments: OBJ($self) NUM($id)
+# Side Effects: update indexes
+# Return Value: none
+sub _update_indexes
+{
+    my ($self, $id) = @_;
+    my $indexs = \@indexs;
+
+    for my $index (@$indexs) {
+	if ($index eq "month") {
+	    _PRINT_DEBUG("-- monthly id index");
+	    $self->update_monthly_id_index({ id => $id });
+	}
+
+	if ($index eq "all") {
+	    _PRINT_DEBUG("-- id index");
+	    $self->update_id_index({ id => $id });
+	}
+
+	if ($index eq "thread") {
+	    _PRINT_DEBUG("-- thread index");
+	    $self->update_thread_index({ id => $id });
+	}
+
+	if ($index eq "month_thread") {
+	    _PRINT_DEBUG("-- month thread index");
+	    $self->update_monthly_thread_index({ id => $id });
+	}
+
+	if ($index eq "top") {
+	    _PRINT_DEBUG("-- top index");
+	    $self->create_top_index();
+	}
+    }
+}
+
+
 #
 # debug
 #
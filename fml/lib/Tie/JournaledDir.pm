@@ -190,18 +190,51 @@ sub expire
 	while ($e = $dh->read()) {
 	    next ENTRY if $e =~ /^\./o;
 
+	    # the index of a file is removed with the file.
+	    next ENTRY if $e =~ /\.index(\.\w+)?$/o;
+
 	    $f  = File::Spec->catfile($dir, $e);
 	    $st = stat($f);
 	    $mt = $st->mtime;
 
 	    if ($mt < $when) {
 		unlink($f) if -f $f;
+		_expire_index($f);
 	    }
 	}
     }
 }
 
 
+# Descriptions: remove the index of $file, see Tie::JournaledFile.
+#    Arguments: STR($file)
+# Side Effects: remove files.
+# Return Value: none
+sub _expire_index
+{
+    my ($file) = @_;
+
+    use File::Basename;
+    my $dir  = dirname($file);
+    my $base = basename($file);
+
+    use DirHandle;
+    my $dh = new DirHandle $dir;
+    if (defined $dh) {
+	my $e;
+
+      ENTRY:
+	while (defined($e = $dh->read())) {
+	    next ENTRY unless index($e, "$base.index") == 0;
+	    next ENTRY unless $e =~ /\.index(\.\w+)?$/o;
+
+	    my $f = File::Spec->catfile($dir, $e);
+	    unlink($f) if -f $f;
+	}
+    }
+}
+
+
 # Descriptions: call new().
 #    Arguments: OBJ($self) HASH_REF($args)
 # Side Effects: same as new()
@@ -83,6 +83,12 @@ standard hash functions.
 
 my $debug = 0;
 
+# the key prefix to chain the offsets of lines with the same key.
+my $index_prev_key = "\0p";
+
+# too long keys are not indexed but searched by reading the file.
+my $index_max_len  = 900;
+
 
 # Descriptions: constructor.
 #    Arguments: OBJ($self) HASH_REF($args)
@@ -305,11 +311,45 @@ sub find
 #    Arguments: OBJ($self) STR($key) STR($mode)
 #               $key is the string to search.
 #               $mode selects the return value style, scalar or array.
-# Side Effects: none
+# Side Effects: create or update the index if needed.
 # Return Value: STR or ARRAY_REF
 sub _fetch
 {
     my ($self, $key, $mode) = @_;
+
+    # look up the index firstly, read the whole file if not available.
+    my $values = $self->_index_fetch($key, $mode);
+    unless (defined $values) {
+	$values = $self->_scan($key, $mode, 0);
+    }
+
+    # error (we fail to open cache file).
+    unless (defined $values) { return undef;}
+
+    if ($mode eq 'scalar') {
+	my $value = $self->{ '_match_condition' } eq 'first' ?
+	    $values->[ 0 ] : $values->[ $#$values ];
+	return( $value || undef );
+    }
+    elsif ($mode eq 'array') {
+	return @$values;
+    }
+    elsif ($mode eq 'array_ref') {
+	return $values;
+    }
+    else {
+	croak("Tie::JournaledFile: invalid mode");
+    }
+}
+
+
+# Descriptions: read the file from $offset and search $key.
+#    Arguments: OBJ($self) STR($key) STR($mode) NUM($offset)
+# Side Effects: none
+# Return Value: ARRAY_REF or undef if the file cannot be opened.
+sub _scan
+{
+    my ($self, $key, $mode, $offset) = @_;
     my $prekey  = $key;
     my $keytrap = quotemeta($key);
 
@@ -322,9 +362,10 @@ sub _fetch
 
     # error (we fail to open cache file).
     unless (defined $fh) { return undef;}
+    seek($fh, $offset, 0) if $offset;
 
     # o.k. we open cache file, here we go for searching
-    my ($xkey, $xvalue, $value, @values) = ();
+    my ($xkey, $xvalue, @values) = ();
     my $buf;
 
   LINE:
@@ -339,34 +380,19 @@ sub _fetch
 	($xkey, $xvalue) = split(/\s+/, $buf, 2);
 	if (defined $xkey && defined $xvalue) {
 	    if ($xkey eq $key) {
-		$value = $xvalue; # save the value for $key
+		push(@values, $xvalue);
 
-		if ($mode eq 'array' || $mode eq 'array_ref') {
-		    push(@values, $value);
-		}
-		if ($mode eq 'scalar') {
-		    # firstmatch: exit loop ASAP if the $key is found.
-		    if ($self->{ '_match_condition' } eq 'first') {
-			last LINE;
-		    }
+		# firstmatch: exit loop ASAP if the $key is found.
+		if ($mode eq 'scalar' &&
+		    $self->{ '_match_condition' } eq 'first') {
+		    last LINE;
 		}
 	    }
 	}
     }
     close($fh);
 
-    if ($mode eq 'scalar') {
-	return( $value || undef );
-    }
-    elsif ($mode eq 'array') {
-	return @values;
-    }
-    elsif ($mode eq 'array_ref') {
-	return \@values;
-    }
-    else {
-	croak("Tie::JournaledFile: invalid mode");
-    }
+    return \@values;
 }
 
 
@@ -404,6 +430,9 @@ sub _puts
 	}
 
 	$fh->close;
+
+	# add the appended line into the index if it exists.
+	$self->_index_sync() if $self->_index()->is_created();
     }
     else {
 	croak "cannot open cache file $file\n";
@@ -411,6 +440,186 @@ sub _puts
 }
 
 
+=head1 INDEX
+
+To avoid reading the whole file for each FETCH() and find(), we keep
+an index next to the file.
+It is a DBM file named C<$file.index>, see L<IO::Adapter::FileIndex>,
+which holds the offsets of the first and last lines for each key and chains the
+offsets of the other lines with the same key.
+
+The index is created by the first look up and follows the file
+incrementally since the file is append only.
+_puts() adds the appended line into an existing index.
+Lines appended by other programs are read from the indexed size of
+the file at the next look up.
+We compare the inode, size and mtime of the file saved in the index
+with the current ones to know whether the file is only appended or
+rewritten. The index is rebuilt in the latter case.
+If the index cannot be used, e.g. the directory is not writable,
+we read the whole file as usual.
+
+=cut
+
+
+# Descriptions: return the index of the file.
+#    Arguments: OBJ($self)
+# Side Effects: none
+# Return Value: OBJ
+sub _index
+{
+    my ($self) = @_;
+
+    use IO::Adapter::FileIndex;
+    return new IO::Adapter::FileIndex { file => $self->{ '_file' } };
+}
+
+
+# Descriptions: search $key by the index.
+#               lines not indexed yet are searched by _scan().
+#    Arguments: OBJ($self) STR($key) STR($mode)
+# Side Effects: create or update the index if needed.
+# Return Value: ARRAY_REF or undef if the index is not available.
+sub _index_fetch
+{
+    my ($self, $key, $mode) = @_;
+    my $first = $self->{ '_match_condition' } eq 'first';
+    my $index = $self->_index();
+    my %index = ();
+
+    return undef unless defined $key;
+    return undef if $key eq '' || $key =~ /\0/o;
+    return undef if length($key) > $index_max_len;
+
+    use IO::File;
+    my $fh = new IO::File $self->{ '_file' }, "r";
+    return undef unless defined $fh;
+
+    my ($lock, $state) = $index->read_open(\%index, $fh, sub {
+	return $self->_index_sync();
+    });
+    return undef unless defined $lock;
+
+    # offsets of the lines to read.
+    my (@offset) = ();
+    my $size     = $index->indexed_size(\%index);
+    my $entry    = $index{ $key };
+    if (defined $entry) {
+	my ($first_offset, $last_offset) = split(/\s+/, $entry);
+
+	if ($mode eq 'scalar') {
+	    push(@offset, $first ? $first_offset : $last_offset);
+	}
+	else {
+	    my $offset = $last_offset;
+	    while (defined $offset) {
+		unshift(@offset, $offset);
+		$offset = $index{ $index_prev_key.$offset };
+	    }
+	}
+    }
+    untie %index;
+    undef $lock;
+
+    my (@values) = ();
+    my ($buf, $xkey, $xvalue);
+    for my $offset (@offset) {
+	seek($fh, $offset, 0);
+	$buf = <$fh>;
+	return undef unless defined $buf;
+
+	chomp $buf;
+	($xkey, $xvalue) = split(/\s+/, $buf, 2);
+
+	# the index is broken.
+	return undef unless defined $xkey && $xkey eq $key;
+	return undef unless defined $xvalue;
+
+	push(@values, $xvalue);
+    }
+    $fh->close();
+
+    # lines appended after the index is updated.
+    unless ($mode eq 'scalar' && $first && @values) {
+	if ($state ne 'ok') {
+	    my $tail = $self->_scan($key, $mode, $size) || [];
+	    push(@values, @$tail);
+	}
+    }
+
+    print STDERR "index: $key => @offset\n" if $debug;
+    return \@values;
+}
+
+
+# Descriptions: add lines not indexed yet into the index.
+#               rebuild the index if the file is rewritten.
+#    Arguments: OBJ($self)
+# Side Effects: create or update the index.
+# Return Value: NUM(1 or 0)
+sub _index_sync
+{
+    my ($self) = @_;
+    my $file   = $self->{ '_file' };
+    my $index  = $self->_index();
+
+    return $index->write_open(sub {
+	my ($xindex) = @_;
+
+	use IO::File;
+	my $fh = new IO::File $file, "r";
+	return 0 unless defined $fh;
+
+	my $state  = $index->state($xindex, $fh);
+	my $offset = 0;
+	if ($state eq 'ok') {
+	    return 1;
+	}
+	elsif ($state eq 'grown') {
+	    $offset = $index->indexed_size($xindex);
+	}
+	else {
+	    %$xindex = ();
+	    print STDERR "index: rebuild $file\n" if $debug;
+	}
+
+	# the same key and value as _scan() finds.
+	# incomplete last line is left to be indexed later.
+	seek($fh, $offset, 0);
+	my ($buf, $pos, $k, $v, $entry);
+      LINE:
+	while ($buf = <$fh>) {
+	    last LINE unless $buf =~ /\n$/o;
+
+	    $pos     = $offset;
+	    $offset += length($buf);
+
+	    chomp $buf;
+	    ($k, $v) = split(/\s+/, $buf, 2);
+	    next LINE unless defined $k && defined $v;
+	    next LINE if $k eq '' || $k =~ /\0/o;
+	    next LINE if length($k) > $index_max_len;
+
+	    $entry = $xindex->{ $k };
+	    if (defined $entry) {
+		my ($first_offset, $last_offset) = split(/\s+/, $entry);
+		$xindex->{ $index_prev_key.$pos } = $last_offset;
+		$xindex->{ $k } = "$first_offset $pos";
+	    }
+	    else {
+		$xindex->{ $k } = "$pos $pos";
+	    }
+	}
+
+	# save the indexed size, which may be less than the file size.
+	$index->set_stat($xindex, $fh, $offset);
+	$fh->close();
+
+	return 1;
+    });
+}
+
+
 =head1 CODING STYLE
 
 See C<http://www.fml.org/software/FNF/> on fml coding style guide.
@@ -0,0 +1,164 @@
+#!/usr/bin/env perl
+#-*- perl -*-
+#
+#  Copyright (C) 2012 Ken'ichi Fukamachi
+#   All rights reserved. This program is free software; you can
+#   redistribute it and/or modify it under the same terms as Perl itself.
+#
+# $FML$
+#
+
+#
+# look up by the offset index of Tie::JournaledFile should return the
+# same values as reading the whole file, before and after STORE(),
+# appends and a rewrite by other programs.
+#
+
+use strict;
+use Carp;
+use Tie::JournaledFile;
+use Tie::JournaledDir;
+use FML::Cache::Ring;
+use FML::Test::Utils;
+
+my $tool  = new FML::Test::Utils;
+my $debug = defined $ENV{'debug'} ? 1 : 0;
+my $dir   = "/tmp/journal_index.$$";
+my $file  = "$dir/cache.txt";
+
+mkdir($dir, 0755) || croak("cannot mkdir $dir");
+
+{
+    use FileHandle;
+    my $wh = new FileHandle "> $file";
+    print $wh "# comment\n\n";
+    for my $i (1 .. 3000) { printf $wh "%-20s   %s\n", "key". $i % 500, $i;}
+    print $wh "rudo\tteddy bear\n";
+    print $wh "Rudo\tRudo\n";
+    print $wh "kenken  north fox\n";
+    print $wh "rudo\n";
+    print $wh "zero 0\n";
+    $wh->close;
+}
+
+check("initial", 'rudo', 'Rudo', 'kenken', 'key0', 'key499', 'zero', 'none');
+
+{
+    $tool->set_title("journal index created");
+    my (@index) = glob("$file.index*");
+    $tool->diff(scalar(@index) > 1 ? 1 : 0, 1);
+}
+
+{
+    my %db = ();
+    tie %db, 'Tie::JournaledFile', { file => $file };
+    $db{ rudo }   = 'polar bear';
+    $db{ newkey } = 'new value';
+    untie %db;
+}
+check("store", 'rudo', 'newkey');
+
+# appended by others: read from the indexed size.
+{
+    my $wh = new FileHandle ">> $file";
+    print $wh "rudo    brown bear\n";
+    print $wh "outsider   value\n";
+    $wh->close;
+}
+check("appended by others", 'rudo', 'outsider', 'kenken');
+
+# rewritten by others: the index should be rebuilt.
+{
+    sleep 1;
+    my $wh = new FileHandle "> $file";
+    print $wh "kenken  south fox\n";
+    print $wh "rudo    white bear\n";
+    $wh->close;
+}
+check("rewritten by others", 'rudo', 'kenken', 'key0', 'newkey');
+
+# FML::Cache::Ring looks up the same index.
+{
+    my $ring = new FML::Cache::Ring { directory => $dir };
+    $ring->{ _file } = $file;
+
+    $tool->set_title("cache ring get");
+    $tool->diff($ring->get('rudo'), 'white bear');
+}
+
+# rewritten in place (the same inode) and grown: a key in the rewritten
+# part should be found.
+{
+    my $wh = new FileHandle "+< $file";
+    truncate($wh, 0);
+    print $wh "zzzzzz  north fox\n";
+    print $wh "rudo    black bear\n";
+    print $wh "tail    value\n";
+    $wh->close;
+}
+check("rewritten in place", 'zzzzzz', 'rudo', 'kenken', 'tail');
+
+# Tie::JournaledDir expires the index with the file, and keeps the
+# index of a file in use even if the index itself is old.
+{
+    my $jd_dir = "$dir/jd";
+    mkdir($jd_dir, 0755) || croak("cannot mkdir $jd_dir");
+    for my $f ("100", "100.index.dir", "100.index.pag", "100.index.lock",
+	       "200", "200.index.lock") {
+	my $wh = new FileHandle "> $jd_dir/$f";
+	$wh->close;
+	utime(1, 1, "$jd_dir/$f") unless $f eq '200';
+    }
+
+    my $jd = new Tie::JournaledDir { dir => $jd_dir };
+    my (@left) = map { s@.*/@@; $_ } glob("$jd_dir/*");
+
+    $tool->set_title("journaled dir expires the index");
+    $tool->diff(join(" ", sort @left), "200 200.index.lock");
+
+    unlink(glob("$jd_dir/*"));
+    rmdir($jd_dir);
+}
+
+unlink(glob("$dir/* $dir/.seq"));
+rmdir($dir);
+
+exit 0;
+
+
+# Descriptions: compare look up by the index and the whole scan.
+#    Arguments: STR($title) ARRAY(@key)
+# Side Effects: none
+# Return Value: none
+sub check
+{
+    my ($title, @key) = @_;
+
+    for my $condition (qw(first last)) {
+	my $db = new Tie::JournaledFile {
+	    match_condition => $condition,
+	    file            => $file,
+	};
+
+	for my $key (@key) {
+	    for my $mode (qw(scalar array_ref)) {
+		my $scan  = $db->_scan($key, $mode, 0);
+		my $found = $db->_fetch($key, $mode);
+
+		if ($mode eq 'scalar') {
+		    my $v = $condition eq 'first' ?
+			$scan->[ 0 ] : $scan->[ $#$scan ];
+		    $scan  = defined $v && $v ? $v : '(undef)';
+		    $found = defined $found ? $found : '(undef)';
+		}
+		else {
+		    $scan  = join("|", @$scan);
+		    $found = join("|", @$found);
+		}
+
+		$tool->set_title("journal index: $title $condition $mode $key");
+		$tool->diff($found, $scan);
+	    }
+	}
+    }
+}
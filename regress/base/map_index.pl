@@ -0,0 +1,123 @@
+#!/usr/bin/env perl
+#-*- perl -*-
+#
+#  Copyright (C) 2012 Ken'ichi Fukamachi
+#   All rights reserved. This program is free software; you can
+#   redistribute it and/or modify it under the same terms as Perl itself.
+#
+# $FML$
+#
+
+#
+# find() with the user hint on a file map should return the keys of
+# the user in the whole scan result, before and after add(), delete()
+# and a change by other programs.
+#
+
+use strict;
+use Carp;
+use IO::Adapter;
+use FML::Test::Utils;
+
+my $tool  = new FML::Test::Utils;
+my $debug = defined $ENV{'debug'} ? 1 : 0;
+my $dir   = "/tmp/map_index.$$";
+my $file  = "$dir/members";
+my $map   = "file:$file";
+
+mkdir($dir, 0755) || croak("cannot mkdir $dir");
+
+# members, comments and an user with too many addresses for one entry.
+{
+    use FileHandle;
+    my $wh = new FileHandle "> $file";
+    print $wh "# members\n\n";
+    for my $i (1 .. 5000) { print $wh "user$i\@dom", $i % 7, ".example.org\n";}
+    print $wh "Rudo\@Nuinui.NET\trudo's address\n";
+    print $wh "rudo\@sapporo.nuinui.net\n";
+    for my $i (1 .. 100) { print $wh "info\@domain$i.example.org\n";}
+    $wh->close;
+}
+
+check("initial", 'rudo', 'user42', 'user4999', 'info', 'nobody');
+
+{
+    $tool->set_title("index created");
+    my (@index) = glob("$file.index*");
+    $tool->diff(scalar(@index) > 1 ? 1 : 0, 1);
+}
+
+{
+    my $obj = new IO::Adapter $map;
+    $obj->add('newcomer@example.org');
+    $obj->add('RUDO@example.org');
+}
+check("add", 'newcomer', 'rudo');
+
+{
+    my $obj = new IO::Adapter $map;
+    $obj->delete(quotemeta('user42@dom0.example.org'));
+    $obj->delete(quotemeta('rudo@sapporo.nuinui.net'));
+}
+check("delete", 'user42', 'rudo');
+
+# changed by others: the index should be rebuilt.
+{
+    sleep 1;
+    my $wh = new FileHandle ">> $file";
+    print $wh "outsider\@example.org\n";
+    $wh->close;
+}
+check("changed by others", 'outsider');
+
+# concurrent add(): the index should have keys added by both writers.
+{
+    check("before concurrent add", 'racer');
+
+    my (@pid) = ();
+    for my $writer ('a', 'b') {
+	my $pid = fork();
+	croak("cannot fork") unless defined $pid;
+	if ($pid == 0) {
+	    my $obj = new IO::Adapter $map;
+	    for my $i (1 .. 20) { $obj->add("racer\@$writer$i.example.org");}
+	    exit 0;
+	}
+	push(@pid, $pid);
+    }
+    for my $pid (@pid) { waitpid($pid, 0);}
+
+    my $obj   = new IO::Adapter $map;
+    my $found = $obj->find('racer', { want => 'key', all => 1, user => 'racer' });
+    $tool->set_title("map index: concurrent add racer");
+    $tool->diff(scalar(@{ $found || [] }), 40);
+}
+
+unlink(glob("$dir/*"));
+rmdir($dir);
+
+exit 0;
+
+
+# Descriptions: compare find() with the user hint and the whole scan.
+#    Arguments: STR($title) ARRAY(@user)
+# Side Effects: none
+# Return Value: none
+sub check
+{
+    my ($title, @user) = @_;
+
+    for my $user (@user) {
+	my $obj   = new IO::Adapter $map;
+	my $query = { want => 'key', all => 1 };
+	my $scan  = $obj->find(quotemeta($user), $query) || [];
+	my (@expected) = grep { /^([^\@]*)/ && "\L$1\E" eq "\L$user\E" } @$scan;
+
+	$query->{ user } = $user;
+	my $found = $obj->find(quotemeta($user), $query) || [];
+
+	# the index returns only keys of the user.
+	$tool->set_title("map index: $title $user");
+	$tool->diff(join(" ", sort @$found), join(" ", sort @expected));
+    }
+}
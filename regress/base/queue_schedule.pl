@@ -0,0 +1,146 @@
+#!/usr/bin/env perl
+#-*- perl -*-
+#
+#  Copyright (C) 2012 Ken'ichi Fukamachi
+#   All rights reserved. This program is free software; you can
+#   redistribute it and/or modify it under the same terms as Perl itself.
+#
+# $FML$
+#
+
+#
+# schedule_due_list() of Mail::Delivery::Queue should return active
+# queues and deferred queues to retry in the order of time, following
+# setrunnable(), sleep_queue() and remove().
+#
+
+use strict;
+use Carp;
+use Mail::Message;
+use Mail::Delivery::Queue;
+use FML::Test::Utils;
+
+my $tool  = new FML::Test::Utils;
+my $debug = defined $ENV{'debug'} ? 1 : 0;
+my $dir   = "/tmp/queue_schedule.$$";
+my $text  = "From: rudo\@example.org\nSubject: test\n\nhello\n";
+
+# 1. queues before the schedule is created.
+my (@qid) = map { queue_in() } (1 .. 3);
+my $queue = new Mail::Delivery::Queue { directory => $dir };
+
+$tool->set_title("schedule not available");
+$tool->diff($queue->schedule_is_available(), 0);
+
+$tool->set_title("schedule rebuild");
+$tool->diff($queue->schedule_rebuild(), 1);
+
+$tool->set_title("schedule due list after rebuild");
+$tool->diff(join(" ", @{ $queue->schedule_due_list(0) }),
+	    join(" ", sort @qid));
+
+# queues taken are leased, and the lease is written back.
+$queue = new Mail::Delivery::Queue { directory => $dir };
+$tool->set_title("schedule due list leased");
+$tool->diff(join(" ", @{ $queue->schedule_due_list(0) }), "");
+
+$tool->set_title("schedule due list after lease");
+$tool->diff(join(" ", @{ $queue->schedule_due_list(0, time + 301) }),
+	    join(" ", sort @qid));
+
+# 2. a new queue, a deferred queue and a removed one.
+my $new = queue_in();
+{
+    my $q = new Mail::Delivery::Queue { id => $qid[0], directory => $dir };
+    $q->sleep_queue();
+    $q = new Mail::Delivery::Queue { id => $qid[1], directory => $dir };
+    $q->remove();
+}
+
+$queue = new Mail::Delivery::Queue { directory => $dir };
+$tool->set_title("schedule due list now");
+$tool->diff(join(" ", @{ $queue->schedule_due_list(0) }), $new);
+
+$queue = new Mail::Delivery::Queue { directory => $dir };
+$tool->set_title("schedule due list with max");
+$tool->diff(scalar(@{ $queue->schedule_due_list(1, time + 1000) }), 1);
+
+# 3. the deferred queue is woken up when it should be retried.
+$queue = new Mail::Delivery::Queue { directory => $dir };
+$tool->set_title("schedule due list later");
+$tool->diff(join(" ", sort @{ $queue->schedule_due_list(0, time + 5000) }),
+	    join(" ", sort $qid[0], $qid[2], $new));
+
+$tool->set_title("deferred queue activated");
+$tool->diff(-f $queue->active_file_path($qid[0]) ? 1 : 0, 1);
+
+# 4. the schedule holds the queues in directories.
+$tool->set_title("schedule entries");
+$tool->diff(join(" ", schedule_entries()),
+	    join(" ", sort $qid[0], $qid[2], $new));
+
+$queue->schedule_rebuild();
+$tool->set_title("schedule entries after rebuild");
+$tool->diff(join(" ", schedule_entries()),
+	    join(" ", sort $qid[0], $qid[2], $new));
+
+# 5. rebuild keeps the time to retry deferred queues.
+{
+    my $q = new Mail::Delivery::Queue { id => $qid[0], directory => $dir };
+    $q->sleep_queue();
+}
+$queue->schedule_rebuild();
+$tool->set_title("schedule rebuild keeps retry time");
+$tool->diff(join(" ", sort @{ $queue->schedule_due_list(0) }),
+	    join(" ", sort $qid[2], $new));
+
+system("rm -fr $dir");
+
+exit 0;
+
+
+# Descriptions: return queue ids in the schedule.
+#    Arguments: none
+# Side Effects: none
+# Return Value: ARRAY
+sub schedule_entries
+{
+    my $q = new Mail::Delivery::Queue { directory => $dir };
+    my %db = ();
+
+    use Fcntl;
+    use AnyDBM_File;
+    tie(%db, 'AnyDBM_File', $q->schedule_file_path(), O_RDONLY, 0644)
+	|| croak("cannot open schedule");
+    my (@r) = map { /^T\d+\.\d+$/ ? ($db{ $_ }) : () } keys %db;
+    untie %db;
+
+    return sort @r;
+}
+
+
+# Descriptions: queue in a message and make it runnable.
+#    Arguments: none
+# Side Effects: create a queue in $dir
+# Return Value: STR(queue id)
+sub queue_in
+{
+    my $q   = new Mail::Delivery::Queue { directory => $dir };
+    my $qid = $q->id();
+
+    use FileHandle;
+    my $wh = new FileHandle "> $dir/message";
+    print $wh $text;
+    $wh->close;
+    my $msg = Mail::Message->parse( { file => "$dir/message" } );
+
+    $q->set_sender($qid, 'rudo@example.org');
+    $q->set_recipient_as_array_ref($qid, [ 'kenken@example.org' ]);
+    $q->in($msg);
+    $q->setrunnable() || croak("cannot setrunnable");
+
+    # queue ids differ in time.
+    sleep 1;
+
+    return $qid;
+}
@@ -0,0 +1,153 @@
+#!/usr/bin/env perl
+#
+#  Copyright (C) 2012 Ken'ichi Fukamachi
+#   All rights reserved. This program is free software; you can
+#   redistribute it and/or modify it under the same terms as Perl itself.
+#
+# $FML$
+#
+
+#
+# load_file() should give the same configuration from the compiled
+# file as from the original file, and the values expanded on demand
+# should be same as the ones expand_variables() gives.
+#
+
+use strict;
+use Carp;
+use lib qw(../../fml/lib ../../cpan/lib);
+use FileHandle;
+use FML::Config;
+
+use FML::Test::Utils;
+my $tool  = new FML::Test::Utils;
+my $debug = defined $ENV{'debug'} ? 1 : 0;
+my $dir   = "/tmp/compiled.$$";
+my $file  = "$dir/config.cf";
+
+mkdir($dir, 0755) || croak("cannot mkdir $dir");
+write_file($file, join("\n",
+		       'xx = deny_xxx deny_yyy',
+		       'xx += deny_zzz',
+		       'xx -= deny_yyy',
+		       'yy = $xx',
+		       '    $zz',
+		       'zz = ${undefined:-default} READ_ONLY($map)',
+		       'map = a b',
+		       '',
+		       '[mysql:fml]',
+		       'sql_server = $zz',
+		       'sql_user = $sql_server/$undefined',
+		       '',
+		       '=cut',
+		       '',
+		       '$compiled_start_hook = q{ 1;};',
+		       ''));
+
+FML::Config->set_compiled_cache_dir("$dir/cache");
+
+# 1. compiled from the file, and replayed from the cache on memory.
+my $config = new FML::Config;
+$config->load_file($file);
+my $parsed = dump_config($FML::Config::_fml_config);
+
+$config->set_context('compiled');
+$config->load_file($file);
+
+$tool->set_title("compiled config");
+$tool->diff(dump_config($FML::Config::_fml_config), $parsed);
+
+$tool->set_title("compiled hook");
+$tool->diff($config->get_hook('compiled_start_hook'), "no strict;\n 1;");
+
+$tool->set_title("compiled cache file");
+$tool->diff(scalar(() = glob("$dir/cache/*")), 1);
+
+# 2. values expanded on demand.
+$tool->set_title("expanded on demand");
+$tool->diff(join("|", $config->{ yy }, $config->{ '[mysql:fml]' }->{ sql_user }),
+	    "deny_xxx deny_zzz default  READ_ONLY(a) READ_ONLY(b)|" .
+	    "default  READ_ONLY(a) READ_ONLY(b)/");
+
+$config->set('map', 'c');
+$tool->set_title("expanded again after set()");
+$tool->diff($config->{ zz }, "default READ_ONLY(c)");
+
+# 3. all variables in the default configuration.
+$config->set_context('default_config');
+$config->set('ml_name',        'elena');
+$config->set('ml_domain',      'fml.org');
+$config->set('ml_home_prefix', '/var/spool/ml');
+$config->load_file("../../fml/etc/default_config.cf.ja.in");
+$config->load_file("../simulation/config.cf");
+{
+    my $lazy = {};
+    for my $k (keys %$FML::Config::_fml_config) {
+	next if ref($FML::Config::_fml_config->{ $k });
+	$lazy->{ $k } = $config->{ $k };
+    }
+
+    $config->expand_variables();
+    my $eager = {};
+    for my $k (keys %$lazy) {
+	my $v = $FML::Config::_fml_config_result->{ $k };
+	$v =~ s/\s*$//;
+	$eager->{ $k } = $v;
+    }
+
+    $tool->set_title("expanded on demand as expand_variables()");
+    $tool->diff(dump_config($lazy), dump_config($eager));
+}
+
+# 4. the modified file is compiled again.
+$config->set_context('modified');
+write_file($file, "xx = modified\n");
+$config->load_file($file);
+
+$tool->set_title("modified config");
+$tool->diff($config->{ xx }, "modified");
+
+system("rm -fr $dir");
+
+exit 0;
+
+
+# Descriptions: write $buf to $file modified two seconds ago.
+#    Arguments: STR($file) STR($buf)
+# Side Effects: create $file
+# Return Value: none
+sub write_file
+{
+    my ($file, $buf) = @_;
+
+    my $wh = new FileHandle "> $file";
+    print $wh $buf;
+    $wh->close;
+
+    my $time = time - 2;
+    utime($time, $time, $file);
+}
+
+
+# Descriptions: return $config as a string.
+#    Arguments: HASH_REF($config)
+# Side Effects: none
+# Return Value: STR
+sub dump_config
+{
+    my ($config) = @_;
+    my $buf = '';
+
+    for my $k (sort keys %$config) {
+	next if $k =~ /^_/;
+	my $v = $config->{ $k };
+	if (ref($v) eq 'HASH') {
+	    for my $x (sort keys %$v) { $buf .= "$k $x = $v->{ $x }\n";}
+	}
+	else {
+	    $buf .= "$k = $v\n";
+	}
+    }
+
+    return $buf;
+}
@@ -0,0 +1,92 @@
+#!/usr/bin/env perl
+#-*- perl -*-
+#
+#  Copyright (C) 2012 Ken'ichi Fukamachi
+#   All rights reserved. This program is free software; you can
+#   redistribute it and/or modify it under the same terms as Perl itself.
+#
+# $FML$
+#
+
+#
+# FML::Header::extract() and dup() should build the same field table
+# as Mail::Header and leave the same lines in the array.
+#
+
+use strict;
+use lib qw(../lib ../../fml/lib ../../cpan/lib);
+use Mail::Header;
+use FML::Header;
+
+use FML::Test::Utils;
+my $tool = new FML::Test::Utils;
+
+my (@received) = map {
+    ("Received: from host$_.example.org\n",
+     "\tby mx.example.org with ESMTP id $_;\n",
+     "  Mon, 1 Jan 2012 00:00:00 +0900\n")
+} (1 .. 100);
+
+my %header = (
+    'simple'   => [ "Subject: simple\n", "To: rudo\@example.org\n",
+		    "\n", "body\n" ],
+    'folded'   => [ @received, "received: lower case\n",
+		    "To: a\@example.org,\n", "\tb\@example.org\n",
+		    "X-Empty: \n", "x-empty:nospace\n", "\n" ],
+    'crlf'     => [ "Subject: crlf\r\n", " folded\r\n", "\r\n", "body" ],
+    'bad line' => [ "Subject: bad\n", "bad line\n", "To: b\n", "\n" ],
+    'no eoln'  => [ "Subject: no eoln" ],
+    'case'     => [ "message-id: <a\@b>\n", "MIME-version: 1.0\n",
+		    "content-TYPE: text/plain\n", "\n" ],
+);
+
+for my $name (sort keys %header) {
+    my (@a) = @{ $header{ $name } };
+    my (@b) = @{ $header{ $name } };
+    my $base = new Mail::Header;
+    my $fml  = new FML::Header;
+    $base->extract(\@a);
+    $fml->extract(\@b);
+
+    $tool->set_title("extract $name: header");
+    $tool->diff($fml->as_string, $base->as_string);
+
+    $tool->set_title("extract $name: fields");
+    $tool->diff(fields($fml), fields($base));
+
+    $tool->set_title("extract $name: rest");
+    $tool->diff(join("", @b), join("", @a));
+
+    my $fml_dup  = $fml->dup();
+    my $base_dup = $base->dup();
+    for my $dup ($fml_dup, $base_dup) {
+	$dup->delete('Received');
+	$dup->add('X-Dup', 'yes');
+    }
+
+    $tool->set_title("dup $name: fields");
+    $tool->diff(fields($fml_dup), fields($base_dup));
+
+    $tool->set_title("dup $name: original");
+    $tool->diff(fields($fml), fields($base));
+}
+
+exit 0;
+
+
+# Descriptions: return the field table as a string.
+#    Arguments: OBJ($header)
+# Side Effects: none
+# Return Value: STR
+sub fields
+{
+    my ($header) = @_;
+    my $buf = '';
+
+    for my $tag (sort $header->tags) {
+	$buf .= join("|", $tag, $header->count($tag),
+		     Mail::Header::get($header, $tag)). "\n";
+    }
+
+    return $buf;
+}
@@ -0,0 +1,85 @@
+#!/usr/bin/env perl
+#-*- perl -*-
+#
+#  Copyright (C) 2012 Ken'ichi Fukamachi
+#   All rights reserved. This program is free software; you can
+#   redistribute it and/or modify it under the same terms as Perl itself.
+#
+# $FML$
+#
+
+#
+# parse() should cut off the same header and body from a file and a
+# pipe.
+#
+
+use strict;
+use Carp;
+use lib qw(../lib ../../fml/lib ../../cpan/lib);
+use Mail::Message;
+
+use FML::Test::Utils;
+my $tool = new FML::Test::Utils;
+my $tmp  = "/tmp/parse_input.$$";
+
+# header and body: the body is larger than the chunk read from a pipe.
+my $large = join("", map { "line $_ " . ('x' x ($_ % 80)) . "\n" } (1 .. 50000));
+my %message = (
+    'simple'  => [ "Subject: simple\nX-A: b\n", "hello\n\nworld\n" ],
+    'no-body' => [ "Subject: no body\n", "" ],
+    'large'   => [ "Subject: large\n", $large ],
+);
+
+for my $name (sort keys %message) {
+    my ($header, $body) = @{ $message{ $name } };
+    my $text = "$header\n$body";
+
+    for my $input (qw(file pipe)) {
+	my $msg = parse($text, $input);
+
+	$tool->set_title("parse $name from $input: header");
+	$tool->diff($msg->whole_message_header->as_string, $header);
+
+	$tool->set_title("parse $name from $input: body");
+	$tool->diff($msg->whole_message_body->message_text || "", $body);
+
+	$tool->set_title("parse $name from $input: size");
+	$tool->diff($msg->{ data_info }->{ total_read_size }, length($text));
+    }
+}
+
+# no separator: all is the header.
+for my $input (qw(file pipe)) {
+    my $text = "Subject: header only\n";
+    my $msg  = parse($text, $input);
+
+    $tool->set_title("parse header only from $input");
+    $tool->diff($msg->{ data_info }->{ header_size }, length($text));
+}
+
+unlink($tmp);
+
+exit 0;
+
+
+# Descriptions: parse $text given from $input.
+#    Arguments: STR($text) STR($input)
+# Side Effects: create $tmp
+# Return Value: OBJ
+sub parse
+{
+    my ($text, $input) = @_;
+
+    use FileHandle;
+    my $wh = new FileHandle "> $tmp";
+    print $wh $text;
+    $wh->close;
+
+    if ($input eq 'file') {
+	return Mail::Message->parse( { file => $tmp } );
+    }
+    else {
+	my $fh = new FileHandle "cat $tmp |";
+	return Mail::Message->parse( { fd => $fh } );
+    }
+}
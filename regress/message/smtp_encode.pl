@@ -0,0 +1,107 @@
+#!/usr/bin/env perl
+#-*- perl -*-
+#
+#  Copyright (C) 2012 Ken'ichi Fukamachi
+#   All rights reserved. This program is free software; you can
+#   redistribute it and/or modify it under the same terms as Perl itself.
+#
+# $FML$
+#
+
+#
+# print() in smtp mode should be the same as the raw mode output
+# converted line by line ("\n" -> "\r\n" and "^." -> "..").
+#
+
+use strict;
+use Carp;
+use lib qw(../lib ../../fml/lib ../../cpan/lib);
+use Mail::Message;
+
+use FML::Test::Utils;
+my $tool = new FML::Test::Utils;
+
+# synthetic messages: dots, CRLF, no trailing newline and a body
+# larger than one chunk written by print().
+my (@body) = map { ($_ % 7 ? '' : '.') . ('x' x ($_ % 91)) } (1 .. 20000);
+my %message = (
+    'dots'   => "Subject: dots\n\n.\n..x\nabc\n.end\n",
+    'crlf'   => "Subject: crlf\n\nline1\r\n.dot\r\nline3\nlast",
+    'no-nl'  => "Subject: no-nl\n\nhello\nno newline",
+    'large'  => "Subject: large\n\n" . join("\n", @body) . "\n",
+    'mime'   => join("\n",
+		     "Subject: mime",
+		     "MIME-Version: 1.0",
+		     "Content-Type: multipart/mixed; boundary=\"b\"",
+		     "",
+		     "--b",
+		     "Content-Type: text/plain",
+		     "",
+		     @body[0 .. 5000],
+		     "--b",
+		     "",
+		     ".abc",
+		     "no newline",
+		     "--b--",
+		     "trailer"),
+);
+
+for my $name (sort keys %message) {
+    my $text = $message{ $name };
+    open(my $fh, '<', \$text) || croak("open: $!");
+    check($name, Mail::Message->parse( { fd => $fh } ));
+}
+
+for my $file (@ARGV) {
+    use FileHandle;
+    my $fh = new FileHandle $file;
+    use File::Basename;
+    check(basename($file), Mail::Message->parse( { fd => $fh } ));
+}
+
+exit 0;
+
+
+# Descriptions: compare smtp mode output with the raw mode one.
+#    Arguments: STR($name) OBJ($msg)
+# Side Effects: none
+# Return Value: none
+sub check
+{
+    my ($name, $msg) = @_;
+
+    my $raw  = output($msg, 'raw');
+    my $smtp = output($msg, 'smtp');
+
+    my $expected = '';
+    for my $line (split(/^/, $raw)) {
+	if ($line !~ /\r\n$/) { $line =~ s/\n$/\r\n/;}
+	$line =~ s/^\./../;
+	$expected .= $line;
+    }
+
+    $tool->set_title("smtp encode $name");
+    $tool->diff($smtp, $expected);
+
+    $tool->set_title("smtp encode $name write count");
+    $tool->diff(Mail::Message::_get_write_count($msg), length($expected));
+}
+
+
+# Descriptions: print $msg into a string in $mode.
+#    Arguments: OBJ($msg) STR($mode)
+# Side Effects: none
+# Return Value: STR
+sub output
+{
+    my ($msg, $mode) = @_;
+    my $buf = '';
+
+    open(my $wh, '>', \$buf) || croak("open: $!");
+    $msg->set_print_mode($mode);
+    $msg->print($wh);
+    close($wh);
+    $msg->reset_print_mode();
+
+    return $buf;
+}
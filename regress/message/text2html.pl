@@ -0,0 +1,71 @@
+#!/usr/bin/env perl
+#-*- perl -*-
+#
+#  Copyright (C) 2012 Ken'ichi Fukamachi
+#   All rights reserved. This program is free software; you can
+#   redistribute it and/or modify it under the same terms as Perl itself.
+#
+# $FML$
+#
+
+#
+# __text2html() of Mail::Message::ToHTML should be same as text2html()
+# of HTML::FromText for ASCII, and keep multibyte characters as they are.
+#
+
+use strict;
+use Carp;
+use lib qw(../lib ../../fml/lib ../../cpan/lib ../../img/lib);
+use Mail::Message::ToHTML;
+use HTML::FromText;
+
+use FML::Test::Utils;
+my $tool = new FML::Test::Utils;
+
+my (@ascii) = (
+    "plain text\n",
+    "<tag> & \"quoted\" 'single' \x01 ~\n\n\n",
+    "tab\tseparated\tline\n> quoted\tline\n",
+    "see http://www.fml.org/software/fml8/ and http://www.fml.org/.",
+    "ftp://ftp.fml.org/pub/fml8/ news:fj.mail.ml mailto:fml\@fml.org",
+    "url http://www.fml.org/?a=b&c=d#e <http://www.fml.org/>",
+);
+
+my $i = 0;
+for my $str (@ascii) {
+    $i++;
+    for my $pre (0, 1) {
+	for my $urls (0, 1) {
+	    # text2html() does not separate "http://..." from the trailor.
+	    my $s = $str;
+	    $s =~ s#(http://[^\s<>'"]+[\w/])#$1 #g;
+	    my $expected = text2html($s, urls => $urls, pre => $pre);
+
+	    $tool->set_title("ascii $i pre=$pre urls=$urls");
+	    $tool->diff(Mail::Message::ToHTML::__text2html($str, $urls, $pre),
+			$expected);
+	}
+    }
+}
+
+my $euc = "\xa4\xb3\xa4\xf3\xa4\xcb\xa4\xc1\xa4\xcf";
+my $jis = "\e\$B\x24\x33\x24\x73\x24\x4b\x24\x41\x24\x4f\e(B";
+my $utf = "\xe3\x81\x93\xe3\x82\x93\xe3\x81\xab\xe3\x81\xa1\xe3\x81\xaf";
+for my $t ([ 'euc-jp' => $euc ], [ 'iso-2022-jp' => $jis ], [ 'utf-8' => $utf ]) {
+    my ($code, $s) = @$t;
+    my $str = "$s <a> http://www.fml.org/$s & $s\n";
+
+    $tool->set_title("$code");
+    $tool->diff(Mail::Message::ToHTML::__text2html($str, 1, 0),
+		"$s &lt;a&gt; " .
+		"<a href=\"http://www.fml.org/\" class=\"hft-urls\">" .
+		"http://www.fml.org/</a> $s &amp; $s");
+}
+
+# the whole body is converted without subject tag regexp.
+$tool->set_title("multiple lines");
+$tool->diff(Mail::Message::ToHTML::__sprintf_safe_str(0, undef,
+						      "1st <line>\n2nd line\n"),
+	    "1st &lt;line&gt;\n2nd line");
+
+exit 0;
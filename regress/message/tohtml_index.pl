@@ -0,0 +1,146 @@
+#!/usr/bin/env perl
+#-*- perl -*-
+#
+#  Copyright (C) 2012 Ken'ichi Fukamachi
+#   All rights reserved. This program is free software; you can
+#   redistribute it and/or modify it under the same terms as Perl itself.
+#
+# $FML$
+#
+
+#
+# indexes updated by reusing <LI> entries in the old ones should be
+# same as the ones created from scratch.
+#
+
+use strict;
+use Carp;
+use lib qw(../lib ../../fml/lib ../../cpan/lib ../../img/lib);
+use FileHandle;
+use Mail::Message::ToHTML;
+
+use FML::Test::Utils;
+my $tool  = new FML::Test::Utils;
+my $debug = defined $ENV{'debug'} ? 1 : 0;
+my $tmp   = "/tmp/tohtml_index.$$";
+my $max   = 12;
+my (@index) = qw(month.202401.html thread.202401.html);
+
+mkdir($tmp, 0755) || croak("cannot mkdir $tmp");
+mkdir("$tmp/spool", 0755);
+
+for my $id (1 .. $max) {
+    my $subject = $id % 4 ? "test $id <tag> & more" :
+	"=?ISO-2022-JP?B?GyRCJUYlOSVIGyhC?= $id";
+    my $irt     = $id % 3 ? "In-Reply-To: <$id.prev\@example.org>\n" : "";
+    my $prev    = $id - 1;
+    $irt =~ s/$id\.prev/$prev/;
+
+    my $wh = new FileHandle "> $tmp/spool/$id";
+    print $wh "From: user$id <user$id\@example.org>\n";
+    print $wh "Subject: $subject\n";
+    print $wh "Date: Mon, 1 Jan 2024 10:00:00 +0900\n";
+    print $wh "Message-Id: <$id\@example.org>\n";
+    print $wh $irt, "\n", "hello $id\n";
+    $wh->close;
+}
+
+htmlify("incremental", 0);
+htmlify("scratch",     1);
+
+for my $index (@index) {
+    $tool->set_title("$index");
+    $tool->diff(read_file("$tmp/incremental/html/$index"),
+		read_file("$tmp/scratch/html/$index"));
+}
+
+{
+    my $file = "$tmp/incremental/html/$index[0]";
+    my $html = new Mail::Message::ToHTML args("incremental");
+    $html->_index_fragment_load($file);
+
+    $tool->set_title("reused entries");
+    $tool->diff(scalar(keys %{ $html->{ _index_fragment }->{ $file } }), $max);
+}
+
+# entries are dropped after indexes are rewritten.
+{
+    my $args = args("incremental");
+    my $html = new Mail::Message::ToHTML $args;
+    $html->htmlify_file("$tmp/spool/$max", $args);
+
+    $tool->set_title("entries dropped");
+    $tool->diff(scalar(keys %{ $html->{ _index_fragment } }), 0);
+}
+
+system("rm -fr $tmp") unless $debug;
+
+exit 0;
+
+
+# Descriptions: return arguments for Mail::Message::ToHTML.
+#    Arguments: STR($name)
+# Side Effects: none
+# Return Value: HASH_REF
+sub args
+{
+    my ($name) = @_;
+
+    return {
+	output_dir  => "$tmp/$name/html",
+	db_base_dir => "$tmp/$name/db",
+	db_name     => "elena",
+	charset     => "euc-jp",
+    };
+}
+
+
+# Descriptions: convert articles to HTML one by one.
+#               remove the style of <LI> entries from indexes to create
+#               them from scratch if $scratch given.
+#    Arguments: STR($name) NUM($scratch)
+# Side Effects: create files in $tmp/$name
+# Return Value: none
+sub htmlify
+{
+    my ($name, $scratch) = @_;
+    my $args = args($name);
+
+    mkdir("$tmp/$name",      0755);
+    mkdir("$tmp/$name/html", 0755);
+    mkdir("$tmp/$name/db",   0755);
+
+    for my $id (1 .. $max) {
+	if ($scratch && $id > 1) {
+	    for my $index (@index) {
+		my $file = "$tmp/$name/html/$index";
+		my $buf  = read_file($file);
+		$buf =~ s/<!-- LI style=\S+ -->\n//;
+
+		my $wh = new FileHandle "> $file";
+		print $wh $buf;
+		$wh->close;
+	    }
+	}
+
+	my $html = new Mail::Message::ToHTML $args;
+	$html->htmlify_file("$tmp/spool/$id", $args);
+    }
+}
+
+
+# Descriptions: return the content of $file.
+#    Arguments: STR($file)
+# Side Effects: none
+# Return Value: STR
+sub read_file
+{
+    my ($file) = @_;
+    my $fh = new FileHandle $file;
+    return '' unless defined $fh;
+
+    local($/) = undef;
+    my $buf = <$fh>;
+    $fh->close;
+    return $buf;
+}
@@ -0,0 +1,134 @@
+#!/usr/bin/env perl
+#-*- perl -*-
+#
+#  Copyright (C) 2012 Ken'ichi Fukamachi
+#   All rights reserved. This program is free software; you can
+#   redistribute it and/or modify it under the same terms as Perl itself.
+#
+# $FML$
+#
+
+#
+# html files created by htmlify_dir() in the rebuild mode should be
+# same as the ones created one by one, of which links and indexes are
+# up to date.
+#
+
+use strict;
+use Carp;
+use lib qw(../lib ../../fml/lib ../../cpan/lib ../../img/lib);
+use FileHandle;
+use File::Find;
+use Mail::Message::ToHTML;
+
+use FML::Test::Utils;
+my $tool  = new FML::Test::Utils;
+my $debug = defined $ENV{'debug'} ? 1 : 0;
+my $tmp   = "/tmp/tohtml_rebuild.$$";
+my $max   = 30;
+
+mkdir($tmp, 0755) || croak("cannot mkdir $tmp");
+mkdir("$tmp/spool", 0755);
+
+for my $id (1 .. $max) {
+    my $month = 1 + int(($id - 1) / 12);
+    my $prev  = $id - 2;
+    my $irt   = ($id % 3 && $prev > 0) ?
+	"In-Reply-To: <$prev\@example.org>\n" : "";
+
+    my $wh = new FileHandle "> $tmp/spool/$id";
+    print $wh "From: user$id <user$id\@example.org>\n";
+    print $wh "Subject: test $id <tag> & more\n";
+    print $wh "Date: Fri, 5 ", (qw(Jan Feb Mar))[$month - 1],
+	" 2024 10:00:00 +0900\n";
+    print $wh "Message-Id: <$id\@example.org>\n";
+    print $wh $irt, "\n", "hello $id\nhttp://www.fml.org/\n";
+    $wh->close;
+}
+
+# 1. one by one, and then rewrite links and indexes of all articles
+#    since the old ones may not be updated after replies come.
+{
+    my $args = args("serial");
+    $args->{ has_fork } = 0;
+
+    my $html = new Mail::Message::ToHTML $args;
+    $html->htmlify_dir("$tmp/spool", $args);
+
+    $html = new Mail::Message::ToHTML $args;
+    for my $id (1 .. $max) {
+	$html->{ _debug_id } = $id;
+	$html->_msg_file_rewrite_links($id);
+    }
+    $html->{ _affected_idlist } = [ 1 .. $max ];
+    $html->_update_indexes($max);
+}
+
+# 2. rebuild mode.
+for my $workers (1, 3) {
+    my $args = args("rebuild$workers");
+    $args->{ rebuild_workers } = $workers;
+
+    my $html = new Mail::Message::ToHTML $args;
+    $html->htmlify_dir("$tmp/spool", $args);
+
+    my $serial  = read_dir("$tmp/serial/html");
+    my $rebuild = read_dir("$tmp/rebuild$workers/html");
+
+    $tool->set_title("rebuild workers=$workers files");
+    $tool->diff(join(" ", sort keys %$rebuild), join(" ", sort keys %$serial));
+
+    for my $file (sort keys %$serial) {
+	$tool->set_title("rebuild workers=$workers $file");
+	$tool->diff($rebuild->{ $file }, $serial->{ $file });
+    }
+}
+
+system("rm -fr $tmp") unless $debug;
+
+exit 0;
+
+
+# Descriptions: return arguments for Mail::Message::ToHTML.
+#    Arguments: STR($name)
+# Side Effects: create directories
+# Return Value: HASH_REF
+sub args
+{
+    my ($name) = @_;
+
+    mkdir("$tmp/$name",      0755);
+    mkdir("$tmp/$name/html", 0755);
+    mkdir("$tmp/$name/db",   0755);
+
+    return {
+	output_dir  => "$tmp/$name/html",
+	db_base_dir => "$tmp/$name/db",
+	db_name     => "elena",
+	charset     => "euc-jp",
+    };
+}
+
+
+# Descriptions: return contents of files under $dir.
+#    Arguments: STR($dir)
+# Side Effects: none
+# Return Value: HASH_REF
+sub read_dir
+{
+    my ($dir) = @_;
+    my $files = {};
+
+    find(sub {
+	return unless -f $_;
+	my $file = $File::Find::name;
+	$file =~ s@^$dir/@@;
+
+	my $fh = new FileHandle $_;
+	local($/) = undef;
+	$files->{ $file } = <$fh>;
+	$fh->close;
+    }, $dir);
+
+    return $files;
+}
@@ -0,0 +1,312 @@
+#!/usr/bin/env perl
+#
+#  Copyright (C) 2012 Ken'ichi Fukamachi
+#   All rights reserved. This program is free software; you can
+#   redistribute it and/or modify it under the same terms as Perl itself.
+#
+# $FML$
+#
+
+#
+# deliver a message to local stub SMTP servers by Mail::Delivery::SMTP
+# with max_concurrency and check that every recipient arrives once.
+#
+
+use strict;
+use Carp;
+use lib qw(../lib ../../fml/lib ../../cpan/lib ../../img/lib);
+use IO::Socket;
+use Mail::Message;
+use Mail::Delivery::SMTP;
+use POSIX;
+
+$| = 1;
+
+use FML::Test::Utils;
+my $tool  = new FML::Test::Utils;
+my $debug = defined $ENV{'debug'} ? 1 : 0;
+
+my (@rcpt) = map { "rcpt$_\@example.org" } (1 .. 2500);
+my $all    = join(" ", sort @rcpt);
+
+#
+# 1. four workers to one MTA.
+#
+{
+    my $r = deliver( { concurrency => 4, n_mta => 1 } );
+
+    $tool->set_title("concurrency 4: all recipients once");
+    $tool->diff(join(" ", sort @{ $r->{ rcpt } }), $all);
+
+    $tool->set_title("concurrency 4: connections");
+    $tool->diff($r->{ conn }, 4);
+
+    $tool->set_title("concurrency 4: total");
+    $tool->diff($r->{ total }, 2500);
+
+    $tool->set_title("concurrency 4: smtp log from workers");
+    $tool->diff($r->{ smtplog_rcpt }, 2500);
+}
+
+#
+# 2. workers are spread over MTA's.
+#
+{
+    my $r = deliver( { concurrency => 4, n_mta => 2 } );
+
+    $tool->set_title("2 MTA's: all recipients once");
+    $tool->diff(join(" ", sort @{ $r->{ rcpt } }), $all);
+
+    $tool->set_title("2 MTA's: both used");
+    $tool->diff($r->{ servers }, 2);
+}
+
+#
+# 3. a dead MTA: the workers starting from it try the next one.
+#
+{
+    my $r = deliver( { concurrency => 4, n_mta => 1, dead_mta => 1 } );
+
+    $tool->set_title("dead MTA: all recipients once");
+    $tool->diff(join(" ", sort @{ $r->{ rcpt } }), $all);
+}
+
+#
+# 4. concurrency 1: as usual.
+#
+{
+    my $r = deliver( { concurrency => 1, n_mta => 1 } );
+
+    $tool->set_title("concurrency 1: all recipients once");
+    $tool->diff(join(" ", sort @{ $r->{ rcpt } }), $all);
+
+    $tool->set_title("concurrency 1: connections");
+    $tool->diff($r->{ conn }, 3);
+}
+
+#
+# 5. a worker dies: the parent queues the recipients of the worker.
+#
+{
+    my $dir = "/tmp/concurrency.$$";
+    my $r   = deliver( { concurrency => 4, n_mta => 1,
+			 kill_at => 'rcpt1800@example.org',
+			 queue_dir => $dir } );
+
+    # the third partition is rcpt1251 ... rcpt1875.
+    my (@lost) = @rcpt[ 1250 .. 1874 ];
+    my %lost   = map { $_ => 1 } @lost;
+    my (@sent) = grep { ! $lost{ $_ } } @rcpt;
+
+    $tool->set_title("dead worker: the others delivered");
+    $tool->diff(join(" ", sort @{ $r->{ rcpt } }), join(" ", sort @sent));
+
+    $tool->set_title("dead worker: its recipients queued");
+    $tool->diff(join(" ", sort @{ $r->{ queued } }), join(" ", sort @lost));
+
+    system("rm", "-rf", $dir);
+}
+
+exit 0;
+
+
+# Descriptions: run stub servers and deliver to them.
+#    Arguments: HASH_REF($args)
+# Side Effects: fork(2)
+# Return Value: HASH_REF
+sub deliver
+{
+    my ($args) = @_;
+    my (@mta)  = ();
+    my (@pid)  = ();
+
+    pipe(my $rh, my $wh) || croak("pipe: $!");
+
+    if ($args->{ dead_mta }) {
+	# nobody listens on the port after close().
+	my $s = new IO::Socket::INET
+	    Listen => 1, LocalAddr => '127.0.0.1', LocalPort => 0, Proto => 'tcp';
+	push(@mta, "127.0.0.1:".$s->sockport);
+	close($s);
+    }
+
+    for my $i (1 .. $args->{ n_mta }) {
+	my $listen = new IO::Socket::INET
+	    Listen    => 16,
+	    LocalAddr => '127.0.0.1',
+	    LocalPort => 0,
+	    Proto     => 'tcp',
+	    ReuseAddr => 1;
+	croak("cannot listen: $!") unless defined $listen;
+	push(@mta, "127.0.0.1:".$listen->sockport);
+
+	my $pid = fork;
+	croak("fork: $!") unless defined $pid;
+	if ($pid == 0) {
+	    close($rh);
+	    stub_server($listen, $wh, $i);
+	    exit 0;
+	}
+	close($listen);
+	push(@pid, $pid);
+    }
+    close($wh);
+
+    my $text    = "From: rudo\@example.org\nSubject: test\n\nhello\n";
+    open(my $fh, '<', \$text) || croak("open: $!");
+    my $message = Mail::Message->parse( { fd => $fh } );
+
+    # a worker dies when it sees $args->{ kill_at }.
+    my $parent   = $$;
+    my $validate = sub {
+	my ($rcpt) = @_;
+	if ($$ != $parent && $rcpt eq ($args->{ kill_at } || '')) {
+	    POSIX::_exit(1);
+	}
+	return 1;
+    };
+
+    my $queue_dir = $args->{ queue_dir } || '';
+    my $queue     = undef;
+    if ($queue_dir) {
+	use Mail::Delivery::Queue;
+	$queue = new Mail::Delivery::Queue { directory => $queue_dir };
+    }
+
+    my $smtplog = '';
+    my $service = new Mail::Delivery::SMTP {
+	default_io_timeout => 10,
+	log_function       => sub { print STDERR @_, "\n" if $debug;},
+	smtp_log_function  => sub { $smtplog .= join('', @_);},
+	address_validate_function => $validate,
+    };
+    $service->deliver(
+		      {
+			  smtp_servers      => join(" ", @mta),
+			  smtp_sender       => 'rudo@example.org',
+			  recipient_array   => \@rcpt,
+			  recipient_limit   => 1000,
+			  max_concurrency   => $args->{ concurrency },
+			  message           => $message,
+			  queue             => $queue,
+			  use_queue_dir     => $queue_dir ? 1 : 0,
+			  queue_dir         => $queue_dir,
+		      });
+
+    # stop the servers and read what they saw.
+    kill('TERM', @pid);
+    for my $pid (@pid) { waitpid($pid, 0);}
+
+    my (@rcpt)  = ();
+    my $conn    = 0;
+    my %servers = ();
+    while (<$rh>) {
+	chomp;
+	if (/^rcpt (\S+)/) { push(@rcpt, $1);}
+	if (/^conn (\d+)/) { $conn++; $servers{ $1 } = 1;}
+    }
+    close($rh);
+
+    # recipients in the queue.
+    my (@queued) = ();
+    if (defined $queue) {
+	for my $qid (@{ $queue->list_all() }) {
+	    push(@queued, @{ $queue->get_recipient_as_array_ref($qid) });
+	}
+    }
+
+    my (@smtplog_rcpt) = ($smtplog =~ /^RCPT TO:/mg);
+    return {
+	queued       => \@queued,
+	rcpt         => \@rcpt,
+	conn         => $conn,
+	servers      => scalar(keys %servers),
+	total        => $service->{ _num_recipients },
+	smtplog_rcpt => scalar(@smtplog_rcpt),
+    };
+}
+
+
+# Descriptions: accept SMTP sessions, each in a child process,
+#               and report connections and recipients to $wh.
+#    Arguments: HANDLE($listen) HANDLE($wh) NUM($id)
+# Side Effects: fork(2)
+# Return Value: none
+sub stub_server
+{
+    my ($listen, $wh, $id) = @_;
+    my (@child) = ();
+
+    $wh->autoflush(1);
+    $SIG{ TERM } = sub {
+	for my $pid (@child) { waitpid($pid, 0);}
+	exit 0;
+    };
+
+    while (1) {
+	my $s = $listen->accept || next;
+	my $pid = fork;
+	if ($pid == 0) {
+	    $SIG{ TERM } = 'DEFAULT';
+	    print $wh "conn $id\n";
+	    stub_session($s, $wh);
+	    exit 0;
+	}
+	push(@child, $pid);
+	close($s);
+    }
+}
+
+
+# Descriptions: one SMTP session.
+#               report recipients of the transactions completed.
+#    Arguments: HANDLE($s) HANDLE($wh)
+# Side Effects: none
+# Return Value: none
+sub stub_session
+{
+    my ($s, $wh) = @_;
+    my $in_data = 0;
+    my (@rcpt)  = ();
+
+    $s->autoflush(1);
+    print $s "220 stub ESMTP\r\n";
+
+  LINE:
+    while (my $line = <$s>) {
+	$line =~ s/\r?\n$//;
+
+	if ($in_data) {
+	    if ($line eq '.') {
+		$in_data = 0;
+		for my $rcpt (@rcpt) { print $wh "rcpt $rcpt\n";}
+		@rcpt = ();
+		print $s "250 queued\r\n";
+	    }
+	    next LINE;
+	}
+
+	if ($line =~ /^EHLO/i) {
+	    print $s "250-stub\r\n";
+	    print $s "250-PIPELINING\r\n";
+	    print $s "250 SIZE 10240000\r\n";
+	}
+	elsif ($line =~ /^RCPT TO:<(.*)>/i) {
+	    push(@rcpt, $1);
+	    print $s "250 ok\r\n";
+	}
+	elsif ($line =~ /^DATA/i) {
+	    $in_data = 1;
+	    print $s "354 go ahead\r\n";
+	}
+	elsif ($line =~ /^QUIT/i) {
+	    print $s "221 bye\r\n";
+	    last LINE;
+	}
+	else {
+	    print $s "250 ok\r\n";
+	}
+    }
+
+    close($s);
+}
@@ -0,0 +1,269 @@
+#!/usr/bin/env perl
+#
+#  Copyright (C) 2012 Ken'ichi Fukamachi
+#   All rights reserved. This program is free software; you can
+#   redistribute it and/or modify it under the same terms as Perl itself.
+#
+# $FML$
+#
+
+#
+# run a LMTP session of FML::Process::LMTPD with a stub program and
+# check replies for each recipient and the message the program reads.
+#
+
+use strict;
+use Carp;
+use lib qw(../lib ../../fml/lib ../../cpan/lib ../../img/lib);
+use FileHandle;
+use FML::Process::LMTPD;
+
+use FML::Test::Utils;
+my $tool  = new FML::Test::Utils;
+my $debug = defined $ENV{'debug'} ? 1 : 0;
+my $dir   = "/tmp/lmtpd.$$";
+
+mkdir($dir, 0755) || croak("cannot mkdir $dir");
+
+my $session = join("", map { "$_\r\n" } (
+    "LHLO client.example.org",
+    "MAIL FROM:<rudo\@example.org> SIZE=100",
+    "RCPT TO:<elena\@fml.org>",
+    "RCPT TO:<Elena-ctl\@FML.org>",
+    "RCPT TO:<elena-error\@fml.org>",
+    "RCPT TO:<elena-admin\@fml.org>",
+    "RCPT TO:<nobody\@fml.org>",
+    "DATA",
+    "Subject: test",
+    "",
+    "..dot line",
+    "hello",
+    ".",
+    "MAIL FROM:<>",
+    "DATA",
+    "RSET",
+    "RCPT TO:<elena\@fml.org>",
+    "NOOP",
+    "EHLO client.example.org",
+    "QUIT",
+));
+
+my $expected = join("", map { "$_\r\n" } (
+    "220 lmtp.example.org LMTP fml8 ready",
+    "250-lmtp.example.org",
+    "250-PIPELINING",
+    "250-SIZE 10485760",
+    "250-ENHANCEDSTATUSCODES",
+    "250 8BITMIME",
+    "250 2.1.0 Ok",
+    "250 2.1.5 Ok",
+    "250 2.1.5 Ok",
+    "250 2.1.5 Ok",
+    "550 5.1.1 <elena-admin\@fml.org>: no such mailing list",
+    "550 5.1.1 <nobody\@fml.org>: no such mailing list",
+    "354 End data with <CR><LF>.<CR><LF>",
+    "250 2.0.0 <elena\@fml.org> Ok",
+    "250 2.0.0 <Elena-ctl\@FML.org> Ok",
+    "451 4.3.0 <elena-error\@fml.org> Error: temporary failure",
+    "250 2.1.0 Ok",
+    "503 5.5.1 Error: need RCPT command",
+    "250 2.0.0 Ok",
+    "503 5.5.1 Error: need MAIL command",
+    "250 2.0.0 Ok",
+    "500 5.5.2 Error: command not recognized",
+    "221 2.0.0 Bye",
+));
+
+# 1. run the session from a file.
+$tool->set_title("lmtp replies");
+$tool->diff(run_session($session, { lmtpd_timeout => 10 }), $expected);
+
+my $message = "Subject: test\n\n.dot line\nhello\n";
+
+$tool->set_title("lmtp distribute");
+$tool->diff(read_file("$dir/elena.distribute"),
+	    "Return-Path: <rudo\@example.org>\n" .
+	    "Delivered-To: elena\@fml.org\n" . $message);
+
+$tool->set_title("lmtp command");
+$tool->diff(read_file("$dir/elena.command"),
+	    "Return-Path: <rudo\@example.org>\n" .
+	    "Delivered-To: Elena-ctl\@FML.org\n" . $message);
+
+# 2. messages over the size limit are rejected.
+unlink("$dir/elena.distribute");
+$session = join("", map { "$_\r\n" } (
+    "LHLO client.example.org",
+    "MAIL FROM:<rudo\@example.org> SIZE=100",
+    "MAIL FROM:<rudo\@example.org>",
+    "RCPT TO:<elena\@fml.org>",
+    "DATA",
+    "Subject: test",
+    "",
+    "hello",
+    ".",
+    "QUIT",
+));
+
+$expected = join("", map { "$_\r\n" } (
+    "220 lmtp.example.org LMTP fml8 ready",
+    "250-lmtp.example.org",
+    "250-PIPELINING",
+    "250-SIZE 10",
+    "250-ENHANCEDSTATUSCODES",
+    "250 8BITMIME",
+    "552 5.3.4 Error: message size exceeds limit",
+    "250 2.1.0 Ok",
+    "250 2.1.5 Ok",
+    "354 End data with <CR><LF>.<CR><LF>",
+    "552 5.3.4 Error: message size exceeds limit",
+    "221 2.0.0 Bye",
+));
+
+$tool->set_title("lmtp size limit");
+$tool->diff(run_session($session, { lmtpd_timeout            => 10,
+				    lmtpd_message_size_limit => 10 }),
+	    $expected);
+
+$tool->set_title("lmtp size limit not distribute");
+$tool->diff(-f "$dir/elena.distribute" ? 1 : 0, 0);
+
+# 3. the exit status of the program decides the reply.
+#    a sender with CR is rejected not to break the Return-Path: header.
+$session = join("", map { "$_\r\n" } (
+    "LHLO client.example.org",
+    "MAIL FROM:<rudo\@example.org\rX-Injected: yes>",
+    "MAIL FROM:<rudo\@example.org>",
+    "RCPT TO:<elena\@fml.org>",
+    "DATA",
+    "X-Exit: 1",
+    "",
+    "hello",
+    ".",
+    "MAIL FROM:<rudo\@example.org>",
+    "RCPT TO:<elena\@fml.org>",
+    "DATA",
+    "X-Kill: TERM",
+    "",
+    "hello",
+    ".",
+    "QUIT",
+));
+
+$expected = join("", map { "$_\r\n" } (
+    "220 lmtp.example.org LMTP fml8 ready",
+    "250-lmtp.example.org",
+    "250-PIPELINING",
+    "250-SIZE 10485760",
+    "250-ENHANCEDSTATUSCODES",
+    "250 8BITMIME",
+    "501 5.1.7 Error: bad sender address syntax",
+    "250 2.1.0 Ok",
+    "250 2.1.5 Ok",
+    "354 End data with <CR><LF>.<CR><LF>",
+    "550 5.3.0 <elena\@fml.org> Error: permanent failure",
+    "250 2.1.0 Ok",
+    "250 2.1.5 Ok",
+    "354 End data with <CR><LF>.<CR><LF>",
+    "451 4.3.0 <elena\@fml.org> Error: temporary failure",
+    "221 2.0.0 Bye",
+));
+
+$tool->set_title("lmtp exit status");
+$tool->diff(run_session($session, { lmtpd_timeout => 10 }), $expected);
+
+unlink(glob("$dir/*"));
+rmdir($dir);
+
+exit 0;
+
+
+# Descriptions: run LMTP $session under $config and return replies.
+#    Arguments: STR($session) HASH_REF($config)
+# Side Effects: create files in $dir
+# Return Value: STR
+sub run_session
+{
+    my ($session, $config) = @_;
+
+    my $wh = new FileHandle "> $dir/in";
+    print $wh $session;
+    $wh->close;
+
+    my $curproc = bless {
+	config => $config,
+	dir    => $dir,
+    }, 'LMTPD::Stub';
+
+    my $rh  = new FileHandle "$dir/in";
+    my $out = new FileHandle "> $dir/out";
+    $curproc->_lmtpd_session($rh, $out);
+    $rh->close;
+    $out->close;
+
+    return read_file("$dir/out");
+}
+
+
+# Descriptions: return the content of $file.
+#    Arguments: STR($file)
+# Side Effects: none
+# Return Value: STR
+sub read_file
+{
+    my ($file) = @_;
+    my $fh = new FileHandle $file;
+    return '' unless defined $fh;
+
+    local($/) = undef;
+    my $buf = <$fh>;
+    $fh->close;
+    return $buf;
+}
+
+
+package LMTPD::Stub;
+
+use vars qw(@ISA);
+BEGIN { @ISA = qw(FML::Process::LMTPD);}
+
+
+# Descriptions: only elena@fml.org exists.
+#    Arguments: OBJ($curproc) STR($ml_name) STR($ml_domain)
+# Side Effects: none
+# Return Value: NUM
+sub is_config_cf_exist
+{
+    my ($curproc, $ml_name, $ml_domain) = @_;
+    return( ($ml_name eq 'elena' && $ml_domain eq 'fml.org') ? 1 : 0 );
+}
+
+
+# Descriptions: save STDIN to a file, error exits as EX_TEMPFAIL.
+#               exit or kill itself as X-Exit: or X-Kill: says.
+#    Arguments: OBJ($curproc) HASH_REF($rcpt)
+# Side Effects: create a file
+# Return Value: none
+sub _lmtpd_run_program
+{
+    my ($curproc, $rcpt) = @_;
+    my $program = $rcpt->{ program };
+    my $file    = "$curproc->{ dir }/$rcpt->{ ml_name }.$program";
+
+    exit(75) if $program eq 'error';
+
+    my $wh = new FileHandle "> $file";
+    while (<STDIN>) {
+	print $wh $_;
+	exit($1)        if /^X-Exit: (\d+)/o;
+	kill($1 => $$)  if /^X-Kill: (\w+)/o;
+    }
+    $wh->close;
+}
+
+
+sub _lmtpd_hostname { return 'lmtp.example.org';}
+sub log      { 1;}
+sub logwarn  { 1;}
+sub logerror { print STDERR "error: $_[1]\n" if $debug;}
+sub logdebug { 1;}
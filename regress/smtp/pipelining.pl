@@ -0,0 +1,267 @@
+#!/usr/bin/env perl
+#
+#  Copyright (C) 2012 Ken'ichi Fukamachi
+#   All rights reserved. This program is free software; you can
+#   redistribute it and/or modify it under the same terms as Perl itself.
+#
+# $FML$
+#
+
+#
+# send a message to a local stub SMTP server by Mail::Delivery::SMTP and
+# check how RCPT TO commands arrive with and without PIPELINING.
+#
+
+use strict;
+use Carp;
+use lib qw(../lib ../../fml/lib ../../cpan/lib ../../img/lib);
+use IO::Socket;
+use Mail::Message;
+use Mail::Delivery::SMTP;
+
+$| = 1;
+
+use FML::Test::Utils;
+my $tool  = new FML::Test::Utils;
+my $debug = defined $ENV{'debug'} ? 1 : 0;
+
+my (@rcpt) = map { "rcpt$_\@example.org" } (1 .. 250);
+
+#
+# 1. PIPELINING: RCPT TO's are sent in windows.
+#
+{
+    my $r = deliver( { pipelining => 1, window => 100, rcpt => \@rcpt } );
+
+    $tool->set_title("pipelining: all RCPT TO");
+    $tool->diff(join(" ", @{ $r->{ rcpt } }), join(" ", @rcpt));
+
+    $tool->set_title("pipelining: RCPT TO in windows");
+    $tool->diff($r->{ max_batch }, 100);
+
+    $tool->set_title("pipelining: no error");
+    $tool->diff($r->{ error }, '');
+}
+
+#
+# 2. no PIPELINING: one RCPT TO at a time.
+#
+{
+    my $r = deliver( { pipelining => 0, window => 100, rcpt => \@rcpt } );
+
+    $tool->set_title("no pipelining: all RCPT TO");
+    $tool->diff(join(" ", @{ $r->{ rcpt } }), join(" ", @rcpt));
+
+    $tool->set_title("no pipelining: one RCPT TO at a time");
+    $tool->diff($r->{ max_batch }, 1);
+}
+
+#
+# 3. window 0 disables pipelining.
+#
+{
+    my $r = deliver( { pipelining => 1, window => 0, rcpt => \@rcpt } );
+
+    $tool->set_title("window 0: one RCPT TO at a time");
+    $tool->diff($r->{ max_batch }, 1);
+}
+
+#
+# 4. temporary errors in a window go to the retry table.
+#
+{
+    my (@r) = @rcpt;
+    $r[ 6 ]  = 'retry7@example.org';
+    $r[ 42 ] = 'retry43@example.org';
+    my $r = deliver( { pipelining => 1, window => 100, rcpt => \@r } );
+
+    $tool->set_title("pipelining: retry table");
+    $tool->diff($r->{ retry }, 'retry43@example.org retry7@example.org');
+}
+
+#
+# 5. without PIPELINING, a timeout does not stop the rest.
+#
+{
+    my (@r) = @rcpt[ 0 .. 9 ];
+    $r[ 3 ] = 'slow4@example.org';
+    my $r = deliver( { pipelining => 0, window => 100, rcpt => \@r,
+		       timeout    => 1 } );
+
+    $tool->set_title("no pipelining: all RCPT TO after timeout");
+    $tool->diff(join(" ", @{ $r->{ rcpt } }), join(" ", @r));
+}
+
+#
+# 6. a write error is an IO error.
+#
+{
+    my $service = new Mail::Delivery::SMTP {
+	smtp_log_function => sub { print STDERR @_ if $debug;},
+    };
+    $service->set_socket(bless {}, 'BrokenSocket');
+
+    $tool->set_title("pipelining: write error");
+    $tool->diff($service->_send_commands([ "RCPT TO:<$rcpt[0]>",
+					   "RCPT TO:<$rcpt[1]>" ]), 0);
+
+    $tool->set_title("pipelining: write error status");
+    $tool->diff($service->get_send_command_status(), 'SMTP IO ERROR');
+}
+
+exit 0;
+
+
+# Descriptions: run a stub server and deliver to it.
+#    Arguments: HASH_REF($args)
+# Side Effects: fork(2)
+# Return Value: HASH_REF
+sub deliver
+{
+    my ($args) = @_;
+
+    my $listen = new IO::Socket::INET
+	Listen    => 5,
+	LocalAddr => '127.0.0.1',
+	LocalPort => 0,
+	Proto     => 'tcp',
+	ReuseAddr => 1;
+    croak("cannot listen: $!") unless defined $listen;
+    my $port = $listen->sockport;
+
+    pipe(my $rh, my $wh) || croak("pipe: $!");
+    my $pid = fork;
+    croak("fork: $!") unless defined $pid;
+    if ($pid == 0) {
+	close($rh);
+	stub_server($listen, $wh, $args->{ pipelining });
+	exit 0;
+    }
+    close($wh);
+    close($listen);
+
+    my $text    = "From: rudo\@example.org\nSubject: test\n\nhello\n";
+    open(my $fh, '<', \$text) || croak("open: $!");
+    my $message = Mail::Message->parse( { fd => $fh } );
+
+    my $service = new Mail::Delivery::SMTP {
+	default_io_timeout => 10,
+	smtp_log_function  => sub { print STDERR @_ if $debug;},
+    };
+    # the fallback into the queue needs a queue object we do not have.
+    eval {
+    $service->deliver(
+		      {
+			  smtp_servers       => "127.0.0.1:$port",
+			  smtp_sender        => 'rudo@example.org',
+			  recipient_array    => $args->{ rcpt },
+			  recipient_limit    => 1000,
+			  pipelining_window  => $args->{ window },
+			  default_io_timeout => $args->{ timeout } || 10,
+			  message            => $message,
+		      });
+    };
+    my $socket = $service->get_socket;
+    close($socket) if defined $socket;
+
+    # what the server saw.
+    my (@rcpt)    = ();
+    my $max_batch = 0;
+    while (<$rh>) {
+	chomp;
+	if (/^rcpt (\S+)/)  { push(@rcpt, $1);}
+	if (/^batch (\d+)/) { $max_batch = $1 if $1 > $max_batch;}
+    }
+    close($rh);
+    waitpid($pid, 0);
+
+    my (@retry) = sort keys %{ $service->{ _retry_recipient_table } || {} };
+    return {
+	rcpt      => \@rcpt,
+	max_batch => $max_batch,
+	retry     => join(" ", @retry),
+	error     => $service->error || '',
+    };
+}
+
+
+# Descriptions: accept one SMTP session and report each RCPT TO and
+#               how many RCPT TO's came in one read(2) to $wh.
+#    Arguments: HANDLE($listen) HANDLE($wh) NUM($pipelining)
+# Side Effects: none
+# Return Value: none
+sub stub_server
+{
+    my ($listen, $wh, $pipelining) = @_;
+    my $s = $listen->accept || croak("accept: $!");
+
+    $s->autoflush(1);
+    print $s "220 stub ESMTP\r\n";
+
+    my $buf     = '';
+    my $in_data = 0;
+  READ:
+    while (sysread($s, $buf, 65536, length $buf)) {
+	my $batch = 0;
+	while ($buf =~ s/^([^\n]*)\n//) {
+	    my $line = $1;
+	    $line =~ s/\r$//;
+
+	    if ($in_data) {
+		if ($line eq '.') {
+		    $in_data = 0;
+		    print $s "250 queued\r\n";
+		}
+		next;
+	    }
+
+	    if ($line =~ /^EHLO/i) {
+		print $s "250-stub\r\n";
+		print $s "250-PIPELINING\r\n" if $pipelining;
+		print $s "250 SIZE 10240000\r\n";
+	    }
+	    elsif ($line =~ /^MAIL FROM/i) {
+		print $s "250 ok\r\n";
+	    }
+	    elsif ($line =~ /^RCPT TO:<(.*)>/i) {
+		my $rcpt = $1;
+		$batch++;
+		print $wh "rcpt $rcpt\n";
+		if ($rcpt =~ /^retry/) {
+		    print $s "450 try again later\r\n";
+		}
+		elsif ($rcpt =~ /^slow/) {
+		    sleep 2;
+		    print $s "250 ok\r\n";
+		}
+		else {
+		    print $s "250 ok\r\n";
+		}
+	    }
+	    elsif ($line =~ /^DATA/i) {
+		$in_data = 1;
+		print $s "354 go ahead\r\n";
+	    }
+	    elsif ($line =~ /^QUIT/i) {
+		print $s "221 bye\r\n";
+		last READ;
+	    }
+	    else {
+		print $s "250 ok\r\n";
+	    }
+	}
+	print $wh "batch $batch\n" if $batch;
+    }
+
+    close($s);
+    close($wh);
+}
+
+
+package BrokenSocket;
+
+# Descriptions: fail to write as a closed socket does.
+#    Arguments: OBJ($self) STR($buf)
+# Side Effects: none
+# Return Value: NUM(0)
+sub print { return 0;}